@@ -0,0 +1,59 @@
+#include "benchmark/benchmark.h"
+#include "matrix4.hpp"
+
+#include <span>
+
+#include "linear_algebra.hpp"
+#include "transform.hpp"
+
+// Returns a non-affine matrix with a non-zero determinant
+static gfx::Matrix4 createGeneralBenchMatrix()
+{
+    return gfx::Matrix4{ -5.0, 2.0, 6.0, -8.0,
+                         1.0, -5.0, 1.0, 8.0,
+                         7.0, 7.0, -6.0, -7.0,
+                         1.0, -3.0, 7.0, 4.0 };
+}
+
+// Returns an affine matrix combining a rotation, scaling, and translation
+static gfx::Matrix4 createAffineBenchMatrix()
+{
+    return gfx::createTranslationMatrix(2, -1.5, 4) *
+           gfx::createYRotationMatrix(0.6) *
+           gfx::createScalingMatrix(1.5, 0.5, 2);
+}
+
+// Benchmarks inverting a matrix through recursive cofactor expansion, the previous implementation of inverse()
+static void BM_InverseCofactorExpansion(benchmark::State& state)
+{
+    const gfx::Matrix4 matrix{ createGeneralBenchMatrix() };
+    const std::span<const double, 16> matrix_values{ matrix.data(), 16 };
+    for (auto _ : state) {
+        const double determinant{ gfx::calculateDeterminant(matrix_values) };
+        benchmark::DoNotOptimize(gfx::Matrix4{
+                std::span<const double, 16>(gfx::calculateInverse(matrix_values, determinant)) });
+    }
+}
+BENCHMARK(BM_InverseCofactorExpansion);
+
+// Benchmarks inverting a general matrix with the closed-form inverse
+static void BM_InverseGeneral(benchmark::State& state)
+{
+    gfx::Matrix4 matrix{ createGeneralBenchMatrix() };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(matrix.inverse());
+    }
+}
+BENCHMARK(BM_InverseGeneral);
+
+// Benchmarks inverting an affine matrix with the affine fast path
+static void BM_InverseAffine(benchmark::State& state)
+{
+    gfx::Matrix4 matrix{ createAffineBenchMatrix() };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(matrix.inverse());
+    }
+}
+BENCHMARK(BM_InverseAffine);
\ No newline at end of file
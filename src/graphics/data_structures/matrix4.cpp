@@ -4,7 +4,6 @@
 #include <stdexcept>
 
 #include "util_functions.hpp"
-#include "linear_algebra.hpp"
 
 namespace gfx {
     // Equality Operator
@@ -18,23 +17,6 @@ namespace gfx {
         return true;
     }
 
-    // Matrix Multiplication Shorthand Operator
-    Matrix4& Matrix4::operator*=(const Matrix4& rhs)
-    {
-        std::array<double, 16> matrix_product_vals{};
-        for (int row = 0; row < 4; ++row)
-            for (int col = 0; col < 4; ++col) {
-                matrix_product_vals[row * 4 + col] =
-                        m_data[row * 4 + 0] * rhs[0, col] +
-                        m_data[row * 4 + 1] * rhs[1, col] +
-                        m_data[row * 4 + 2] * rhs[2, col] +
-                        m_data[row * 4 + 3] * rhs[3, col];
-            }
-
-        m_data = matrix_product_vals;
-        return *this;
-    }
-
     // Identity matrix identifier
     bool Matrix4::isIdentityMatrix() const
     {
@@ -67,32 +49,105 @@ namespace gfx {
             // Inverse of identity matrix is the identity matrix
             return Matrix4{ };
 
-        const double determinant{ calculateDeterminant(m_data) };
+        // Most transforms are affine, which only requires inverting the upper-left 3x3 block
+        if (this->isAffine())
+            return this->calculateAffineInverse();
+
+        return this->calculateGeneralInverse();
+    }
+
+    // Affine Matrix Inverse
+    Matrix4 Matrix4::calculateAffineInverse() const
+    {
+        const double a00{ m_data[0] }, a01{ m_data[1] }, a02{ m_data[2] }, tx{ m_data[3] };
+        const double a10{ m_data[4] }, a11{ m_data[5] }, a12{ m_data[6] }, ty{ m_data[7] };
+        const double a20{ m_data[8] }, a21{ m_data[9] }, a22{ m_data[10] }, tz{ m_data[11] };
+
+        // The determinant of an affine matrix is the determinant of its linear block
+        const double cofactor_00{ a11 * a22 - a12 * a21 };
+        const double cofactor_01{ a12 * a20 - a10 * a22 };
+        const double cofactor_02{ a10 * a21 - a11 * a20 };
+        const double determinant{ a00 * cofactor_00 + a01 * cofactor_01 + a02 * cofactor_02 };
         if (determinant == 0)
             // Matrix with 0 determinant is not invertible
             throw std::invalid_argument{ "Matrix determinant cannot be zero." };
 
-        return Matrix4{ std::span<const double, 16>(calculateInverse(m_data, determinant)) };
+        // Invert the linear block using its adjugate
+        const double inverse_determinant{ 1.0 / determinant };
+        const double i00{ cofactor_00 * inverse_determinant };
+        const double i01{ (a02 * a21 - a01 * a22) * inverse_determinant };
+        const double i02{ (a01 * a12 - a02 * a11) * inverse_determinant };
+        const double i10{ cofactor_01 * inverse_determinant };
+        const double i11{ (a00 * a22 - a02 * a20) * inverse_determinant };
+        const double i12{ (a02 * a10 - a00 * a12) * inverse_determinant };
+        const double i20{ cofactor_02 * inverse_determinant };
+        const double i21{ (a01 * a20 - a00 * a21) * inverse_determinant };
+        const double i22{ (a00 * a11 - a01 * a10) * inverse_determinant };
+
+        // Undo the translation by applying the inverted linear block to the negated translation
+        return Matrix4{ i00, i01, i02, -(i00 * tx + i01 * ty + i02 * tz),
+                        i10, i11, i12, -(i10 * tx + i11 * ty + i12 * tz),
+                        i20, i21, i22, -(i20 * tx + i21 * ty + i22 * tz),
+                        0.0, 0.0, 0.0, 1.0 };
     }
 
-    // Identity Matrix Factory Function
-    Matrix4 createIdentityMatrix()
+    // General Matrix Inverse
+    Matrix4 Matrix4::calculateGeneralInverse() const
     {
-        return Matrix4{ };
+        const double a00{ m_data[0] }, a01{ m_data[1] }, a02{ m_data[2] }, a03{ m_data[3] };
+        const double a10{ m_data[4] }, a11{ m_data[5] }, a12{ m_data[6] }, a13{ m_data[7] };
+        const double a20{ m_data[8] }, a21{ m_data[9] }, a22{ m_data[10] }, a23{ m_data[11] };
+        const double a30{ m_data[12] }, a31{ m_data[13] }, a32{ m_data[14] }, a33{ m_data[15] };
+
+        // Each 3x3 minor is a combination of 2x2 sub-determinants of the top two and bottom two rows, so computing
+        // those once yields every cofactor without any recursion
+        const double top_01{ a00 * a11 - a10 * a01 };
+        const double top_02{ a00 * a12 - a10 * a02 };
+        const double top_03{ a00 * a13 - a10 * a03 };
+        const double top_12{ a01 * a12 - a11 * a02 };
+        const double top_13{ a01 * a13 - a11 * a03 };
+        const double top_23{ a02 * a13 - a12 * a03 };
+        const double bottom_01{ a20 * a31 - a30 * a21 };
+        const double bottom_02{ a20 * a32 - a30 * a22 };
+        const double bottom_03{ a20 * a33 - a30 * a23 };
+        const double bottom_12{ a21 * a32 - a31 * a22 };
+        const double bottom_13{ a21 * a33 - a31 * a23 };
+        const double bottom_23{ a22 * a33 - a32 * a23 };
+
+        const double determinant{ top_01 * bottom_23 - top_02 * bottom_13 + top_03 * bottom_12 +
+                                  top_12 * bottom_03 - top_13 * bottom_02 + top_23 * bottom_01 };
+        if (determinant == 0)
+            // Matrix with 0 determinant is not invertible
+            throw std::invalid_argument{ "Matrix determinant cannot be zero." };
+
+        // Divide the adjugate (the transposed cofactor matrix) by the determinant
+        const double inverse_determinant{ 1.0 / determinant };
+        return Matrix4{
+                (a11 * bottom_23 - a12 * bottom_13 + a13 * bottom_12) * inverse_determinant,
+                (-a01 * bottom_23 + a02 * bottom_13 - a03 * bottom_12) * inverse_determinant,
+                (a31 * top_23 - a32 * top_13 + a33 * top_12) * inverse_determinant,
+                (-a21 * top_23 + a22 * top_13 - a23 * top_12) * inverse_determinant,
+
+                (-a10 * bottom_23 + a12 * bottom_03 - a13 * bottom_02) * inverse_determinant,
+                (a00 * bottom_23 - a02 * bottom_03 + a03 * bottom_02) * inverse_determinant,
+                (-a30 * top_23 + a32 * top_03 - a33 * top_02) * inverse_determinant,
+                (a20 * top_23 - a22 * top_03 + a23 * top_02) * inverse_determinant,
+
+                (a10 * bottom_13 - a11 * bottom_03 + a13 * bottom_01) * inverse_determinant,
+                (-a00 * bottom_13 + a01 * bottom_03 - a03 * bottom_01) * inverse_determinant,
+                (a30 * top_13 - a31 * top_03 + a33 * top_01) * inverse_determinant,
+                (-a20 * top_13 + a21 * top_03 - a23 * top_01) * inverse_determinant,
+
+                (-a10 * bottom_12 + a11 * bottom_02 - a12 * bottom_01) * inverse_determinant,
+                (a00 * bottom_12 - a01 * bottom_02 + a02 * bottom_01) * inverse_determinant,
+                (-a30 * top_12 + a31 * top_02 - a32 * top_01) * inverse_determinant,
+                (a20 * top_12 - a21 * top_02 + a22 * top_01) * inverse_determinant
+        };
     }
 
-    // Matrix Multiplication Operator
-    Matrix4 operator*(const Matrix4& lhs, const Matrix4& rhs)
+    // Identity Matrix Factory Function
+    Matrix4 createIdentityMatrix()
     {
-        Matrix4 return_matrix{ };
-        for (int row = 0; row < 4; ++row)
-            for (int col = 0; col < 4; ++col) {
-                return_matrix[row, col] =
-                        lhs[row, 0] * rhs[0, col] +
-                        lhs[row, 1] * rhs[1, col] +
-                        lhs[row, 2] * rhs[2, col] +
-                        lhs[row, 3] * rhs[3, col];
-            }
-        return return_matrix;
+        return Matrix4{ };
     }
 }
\ No newline at end of file
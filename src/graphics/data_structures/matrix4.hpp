@@ -3,6 +3,8 @@
 #include <array>
 #include <span>
 
+#include "simd_kernels.hpp"
+
 namespace gfx {
     class Matrix4
     {
@@ -52,13 +54,23 @@ namespace gfx {
         [[nodiscard]] double& operator[](const size_t row, const size_t col)
         { return m_data[row * 4 + col]; }
 
+        // Returns a pointer to the sixteen contiguous elements of the matrix in row-major order
+        [[nodiscard]] const double* data() const
+        { return m_data.data(); }
+
         /* Comparison Operator Overloads */
 
         [[nodiscard]] bool operator==(const Matrix4& rhs) const;
 
         /* Arithmetic Operator Overloads */
 
-        Matrix4& operator*=(const Matrix4& rhs);
+        Matrix4& operator*=(const Matrix4& rhs)
+        {
+            std::array<double, 16> matrix_product_vals{};
+            simd::multiplyMatrixMatrix(m_data.data(), rhs.data(), matrix_product_vals.data());
+            m_data = matrix_product_vals;
+            return *this;
+        }
 
         /* Matrix Operations */
 
@@ -68,10 +80,23 @@ namespace gfx {
         // Returns the transpose of this matrix
         [[nodiscard]] Matrix4 transpose() const;
 
+        // Returns true if the bottom row of this matrix is exactly (0, 0, 0, 1), i.e. the matrix only combines a
+        // linear transformation with a translation
+        [[nodiscard]] bool isAffine() const
+        { return m_data[12] == 0.0 && m_data[13] == 0.0 && m_data[14] == 0.0 && m_data[15] == 1.0; }
+
         // Returns the inverse of this matrix
         [[nodiscard]] Matrix4 inverse() const;
 
     private:
+        /* Helper Methods */
+
+        // Returns the inverse of an affine matrix from the inverse of its upper-left 3x3 block and its translation
+        [[nodiscard]] Matrix4 calculateAffineInverse() const;
+
+        // Returns the inverse of a general matrix using the closed-form adjugate built from 2x2 sub-determinants
+        [[nodiscard]] Matrix4 calculateGeneralInverse() const;
+
         /* Data Members */
 
         std::array<double, 16> m_data{ 1.0, 0.0, 0.0, 0.0,
@@ -87,5 +112,11 @@ namespace gfx {
 
     /* Global Arithmetic Operator Overloads */
 
-    [[nodiscard]] Matrix4 operator*(const Matrix4& lhs, const Matrix4& rhs);
+    // Matrix Multiplication Operator
+    [[nodiscard]] inline Matrix4 operator*(const Matrix4& lhs, const Matrix4& rhs)
+    {
+        std::array<double, 16> matrix_product_vals{};
+        simd::multiplyMatrixMatrix(lhs.data(), rhs.data(), matrix_product_vals.data());
+        return Matrix4{ std::span<const double, 16>{ matrix_product_vals } };
+    }
 }
@@ -1,7 +1,12 @@
 #include "gtest/gtest.h"
 #include "matrix4.hpp"
 
+#include <span>
+#include <stdexcept>
+#include <vector>
+
 #include "vector4.hpp"
+#include "linear_algebra.hpp"
 
 // Tests the default constructor
 TEST(GraphicsMatrix4, DefaultConstructor)
@@ -312,6 +317,77 @@ TEST(GraphicsMatrix4, InvertMatrix)
     EXPECT_TRUE(matrix_c_inverse_actual == matrix_c_inverse_expected);
 }
 
+// Tests inversion of an affine matrix, which only inverts the upper-left 3x3 block and the translation
+TEST(GraphicsMatrix4, InvertAffineMatrix)
+{
+    const gfx::Matrix4 matrix_affine{
+            2.0, 0.5, -1.0, 3.0,
+            0.0, 1.5, 2.0, -4.0,
+            1.0, -2.0, 0.5, 7.0,
+            0.0, 0.0, 0.0, 1.0
+    };
+    const gfx::Matrix4 matrix_identity{ gfx::createIdentityMatrix() };
+
+    const std::vector<double> affine_values{
+            2.0, 0.5, -1.0, 3.0,
+            0.0, 1.5, 2.0, -4.0,
+            1.0, -2.0, 0.5, 7.0,
+            0.0, 0.0, 0.0, 1.0
+    };
+    const gfx::Matrix4 matrix_inverse_expected{ std::span<const double, 16>{
+            gfx::calculateInverse(affine_values, gfx::calculateDeterminant(affine_values)) } };
+
+    const gfx::Matrix4 matrix_inverse_actual{ matrix_affine.inverse() };
+
+    EXPECT_EQ(matrix_inverse_actual, matrix_inverse_expected);
+    EXPECT_EQ(matrix_affine * matrix_inverse_actual, matrix_identity);
+}
+
+// Tests that inverting a matrix with a determinant of zero throws an exception
+TEST(GraphicsMatrix4, InvertSingularMatrix)
+{
+    const gfx::Matrix4 matrix_singular_affine{
+            1.0, 2.0, 3.0, 4.0,
+            2.0, 4.0, 6.0, 5.0,
+            0.0, 1.0, 1.0, 6.0,
+            0.0, 0.0, 0.0, 1.0
+    };
+    const gfx::Matrix4 matrix_singular_general{
+            1.0, 2.0, 3.0, 4.0,
+            2.0, 4.0, 6.0, 8.0,
+            0.0, 1.0, 1.0, 6.0,
+            1.0, 0.0, 2.0, 1.0
+    };
+
+    EXPECT_THROW({
+        const gfx::Matrix4 matrix_inverse{ matrix_singular_affine.inverse() };
+        }, std::invalid_argument);
+    EXPECT_THROW({
+        const gfx::Matrix4 matrix_inverse{ matrix_singular_general.inverse() };
+        }, std::invalid_argument);
+}
+
+// Tests identifying affine matrices
+TEST(GraphicsMatrix4, IsAffine)
+{
+    const gfx::Matrix4 matrix_affine{
+            2.0, 0.5, -1.0, 3.0,
+            0.0, 1.5, 2.0, -4.0,
+            1.0, -2.0, 0.5, 7.0,
+            0.0, 0.0, 0.0, 1.0
+    };
+    const gfx::Matrix4 matrix_projective{
+            1.0, 0.0, 0.0, 0.0,
+            0.0, 1.0, 0.0, 0.0,
+            0.0, 0.0, 1.0, 0.0,
+            0.0, 0.0, -1.0, 0.0
+    };
+
+    EXPECT_TRUE(matrix_affine.isAffine());
+    EXPECT_TRUE(gfx::createIdentityMatrix().isAffine());
+    EXPECT_FALSE(matrix_projective.isAffine());
+}
+
 // Tests inversion of the identity matrix
 TEST(GraphicsMatrix4, InvertIdentityMatrix)
 {
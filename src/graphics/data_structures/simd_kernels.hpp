@@ -0,0 +1,486 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "util_functions.hpp"
+
+#if defined(GFX_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(GFX_SIMD_SSE)
+#include <emmintrin.h>
+#endif
+
+// Low-level kernels backing the Vector4 and Matrix4 arithmetic and the bounding volume hierarchy box tests. The
+// instruction set is chosen at build time through the GFX_SIMD_LEVEL CMake cache variable, which defines
+// GFX_SIMD_AVX2 or GFX_SIMD_SSE for the matching kernels and falls back to the portable scalar kernels otherwise.
+// Matrices are passed as 16 doubles in row-major order.
+namespace gfx::simd {
+    // Tolerance applied when comparing the entry and exit distances of a box, matching BoundingBox::isIntersectedBy
+    constexpr float BOX_TEST_TOLERANCE{ static_cast<float>(utils::EPSILON) };
+
+    /* Scalar Kernels */
+
+    // The scalar kernels are always available, both as the portable fallback and as a reference for the benchmarks
+    namespace scalar {
+        // Returns the dot product of two 4-element vectors
+        [[nodiscard]] inline double dotProduct(const double* lhs, const double* rhs)
+        {
+            return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3] * rhs[3];
+        }
+
+        // Writes the cross product of the xyz-components of two vectors to the output, with a w-component of 0
+        inline void crossProduct(const double* lhs, const double* rhs, double* out)
+        {
+            out[0] = lhs[1] * rhs[2] - lhs[2] * rhs[1];
+            out[1] = lhs[2] * rhs[0] - lhs[0] * rhs[2];
+            out[2] = lhs[0] * rhs[1] - lhs[1] * rhs[0];
+            out[3] = 0.0;
+        }
+
+        // Writes each element of a vector divided by a scalar to the output
+        inline void divide(const double* src, const double scalar, double* out)
+        {
+            out[0] = src[0] / scalar;
+            out[1] = src[1] / scalar;
+            out[2] = src[2] / scalar;
+            out[3] = src[3] / scalar;
+        }
+
+        // Writes the product of a 4x4 matrix and a 4-element column vector to the output
+        inline void multiplyMatrixVector(const double* matrix, const double* vector, double* out)
+        {
+            for (int row = 0; row < 4; ++row) {
+                out[row] =
+                        matrix[row * 4 + 0] * vector[0] +
+                        matrix[row * 4 + 1] * vector[1] +
+                        matrix[row * 4 + 2] * vector[2] +
+                        matrix[row * 4 + 3] * vector[3];
+            }
+        }
+
+        // Writes the product of two 4x4 matrices to the output, which must not alias either input
+        inline void multiplyMatrixMatrix(const double* lhs, const double* rhs, double* out)
+        {
+            for (int row = 0; row < 4; ++row)
+                for (int col = 0; col < 4; ++col) {
+                    out[row * 4 + col] =
+                            lhs[row * 4 + 0] * rhs[0 * 4 + col] +
+                            lhs[row * 4 + 1] * rhs[1 * 4 + col] +
+                            lhs[row * 4 + 2] * rhs[2 * 4 + col] +
+                            lhs[row * 4 + 3] * rhs[3 * 4 + col];
+                }
+        }
+
+        // Tests a ray against a group of boxes stored as six rows of Width floats, holding the minimum x, y, and z
+        // extents followed by the maximum extents. For each axis, near_rows and far_rows select the rows of the
+        // planes the ray enters and exits through, which are swapped for a negative direction. Writes the entry
+        // t-value of each box and returns a mask with bit i set if box i is intersected within [t_min, t_max].
+        // An axis the ray runs parallel to and lies exactly on the boundary of yields NaN and is ignored.
+        template<size_t Width>
+        [[nodiscard]] unsigned intersectBoxes(const float* extents,
+                                              const size_t* near_rows,
+                                              const size_t* far_rows,
+                                              const float* origin,
+                                              const float* inverse_direction,
+                                              const float t_min,
+                                              const float t_max,
+                                              float* entry_ts)
+        {
+            unsigned hit_mask{ 0 };
+            for (size_t lane = 0; lane < Width; ++lane) {
+                float entry_t{ t_min };
+                float exit_t{ t_max };
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    const float near_plane{ extents[near_rows[axis] * Width + lane] };
+                    const float far_plane{ extents[far_rows[axis] * Width + lane] };
+                    entry_t = std::fmax(entry_t, (near_plane - origin[axis]) * inverse_direction[axis]);
+                    exit_t = std::fmin(exit_t, (far_plane - origin[axis]) * inverse_direction[axis]);
+                }
+
+                entry_ts[lane] = entry_t;
+                if (entry_t <= exit_t + BOX_TEST_TOLERANCE * (1.0f + std::fabs(exit_t)))
+                    hit_mask |= 1u << lane;
+            }
+            return hit_mask;
+        }
+
+        // Tests a group of Width rays against a single box, given as the minimum x, y, and z extents followed by
+        // the maximum extents. Each ray attribute is stored as three rows of Width floats, one per axis, spaced
+        // row_stride elements apart. A negative direction row holds all bits set in the lanes of rays travelling
+        // towards the minimum extent along that axis, which enter the box through its maximum extent. Writes the
+        // entry t-value of each ray and returns a mask with bit i set if ray i intersects the box within
+        // [t_mins[i], t_maxes[i]].
+        template<size_t Width>
+        [[nodiscard]] unsigned intersectRaysWithBox(const float* box_extents,
+                                                    const float* origins,
+                                                    const float* inverse_directions,
+                                                    const uint32_t* negative_direction_masks,
+                                                    const size_t row_stride,
+                                                    const float* t_mins,
+                                                    const float* t_maxes,
+                                                    float* entry_ts)
+        {
+            unsigned hit_mask{ 0 };
+            for (size_t lane = 0; lane < Width; ++lane) {
+                float entry_t{ t_mins[lane] };
+                float exit_t{ t_maxes[lane] };
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    const size_t row_lane{ axis * row_stride + lane };
+                    const bool is_direction_negative{ negative_direction_masks[row_lane] != 0 };
+                    const float near_plane{ box_extents[is_direction_negative ? axis + 3 : axis] };
+                    const float far_plane{ box_extents[is_direction_negative ? axis : axis + 3] };
+                    entry_t = std::fmax(entry_t, (near_plane - origins[row_lane]) * inverse_directions[row_lane]);
+                    exit_t = std::fmin(exit_t, (far_plane - origins[row_lane]) * inverse_directions[row_lane]);
+                }
+
+                entry_ts[lane] = entry_t;
+                if (entry_t <= exit_t + BOX_TEST_TOLERANCE * (1.0f + std::fabs(exit_t)))
+                    hit_mask |= 1u << lane;
+            }
+            return hit_mask;
+        }
+    }
+
+    /* Build-Selected Kernels */
+
+#if defined(GFX_SIMD_AVX2)
+
+    // Name of the instruction set the kernels were built for
+    constexpr const char* KERNEL_INSTRUCTION_SET{ "AVX2" };
+
+    // Loads a 4-element vector into a register element by element. Vectors are usually built from scalars just
+    // before use, and a single wide load spanning several narrower stores would stall on store forwarding.
+    [[nodiscard]] inline __m256d loadVector(const double* values)
+    {
+        return _mm256_set_pd(values[3], values[2], values[1], values[0]);
+    }
+
+    // Returns the sum of the four lanes of a register
+    [[nodiscard]] inline double horizontalSum(const __m256d values)
+    {
+        const __m128d pair_sums{ _mm_add_pd(_mm256_castpd256_pd128(values), _mm256_extractf128_pd(values, 1)) };
+        return _mm_cvtsd_f64(_mm_add_sd(pair_sums, _mm_unpackhi_pd(pair_sums, pair_sums)));
+    }
+
+    [[nodiscard]] inline double dotProduct(const double* lhs, const double* rhs)
+    {
+        return horizontalSum(_mm256_mul_pd(loadVector(lhs), loadVector(rhs)));
+    }
+
+    inline void crossProduct(const double* lhs, const double* rhs, double* out)
+    {
+        // Rotate the xyz-lanes to form (y, z, x) and (z, x, y), leaving the w-lane in place
+        const __m256d lhs_values{ loadVector(lhs) };
+        const __m256d rhs_values{ loadVector(rhs) };
+        const __m256d lhs_yzx{ _mm256_permute4x64_pd(lhs_values, _MM_SHUFFLE(3, 0, 2, 1)) };
+        const __m256d rhs_yzx{ _mm256_permute4x64_pd(rhs_values, _MM_SHUFFLE(3, 0, 2, 1)) };
+        const __m256d lhs_zxy{ _mm256_permute4x64_pd(lhs_values, _MM_SHUFFLE(3, 1, 0, 2)) };
+        const __m256d rhs_zxy{ _mm256_permute4x64_pd(rhs_values, _MM_SHUFFLE(3, 1, 0, 2)) };
+        const __m256d cross{ _mm256_sub_pd(_mm256_mul_pd(lhs_yzx, rhs_zxy), _mm256_mul_pd(lhs_zxy, rhs_yzx)) };
+
+        // Clear the w-lane explicitly, since it would otherwise be NaN for infinite inputs
+        _mm256_storeu_pd(out, _mm256_blend_pd(cross, _mm256_setzero_pd(), 0b1000));
+    }
+
+    inline void divide(const double* src, const double scalar, double* out)
+    {
+        _mm256_storeu_pd(out, _mm256_div_pd(loadVector(src), _mm256_set1_pd(scalar)));
+    }
+
+    inline void multiplyMatrixVector(const double* matrix, const double* vector, double* out)
+    {
+        // Multiply each row by the vector, then transpose-and-add the partial sums so that lane i holds row i's sum
+        const __m256d vector_values{ loadVector(vector) };
+        const __m256d row_0{ _mm256_mul_pd(_mm256_loadu_pd(matrix + 0), vector_values) };
+        const __m256d row_1{ _mm256_mul_pd(_mm256_loadu_pd(matrix + 4), vector_values) };
+        const __m256d row_2{ _mm256_mul_pd(_mm256_loadu_pd(matrix + 8), vector_values) };
+        const __m256d row_3{ _mm256_mul_pd(_mm256_loadu_pd(matrix + 12), vector_values) };
+        const __m256d sums_01{ _mm256_hadd_pd(row_0, row_1) };
+        const __m256d sums_23{ _mm256_hadd_pd(row_2, row_3) };
+        const __m256d low_halves{ _mm256_permute2f128_pd(sums_01, sums_23, 0x20) };
+        const __m256d high_halves{ _mm256_permute2f128_pd(sums_01, sums_23, 0x31) };
+        _mm256_storeu_pd(out, _mm256_add_pd(low_halves, high_halves));
+    }
+
+    inline void multiplyMatrixMatrix(const double* lhs, const double* rhs, double* out)
+    {
+        // Each output row is a linear combination of the rows of the right-hand matrix
+        const __m256d rhs_row_0{ _mm256_loadu_pd(rhs + 0) };
+        const __m256d rhs_row_1{ _mm256_loadu_pd(rhs + 4) };
+        const __m256d rhs_row_2{ _mm256_loadu_pd(rhs + 8) };
+        const __m256d rhs_row_3{ _mm256_loadu_pd(rhs + 12) };
+        for (int row = 0; row < 4; ++row) {
+            const double* lhs_row{ lhs + row * 4 };
+            const __m256d sum_01{ _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(lhs_row[0]), rhs_row_0),
+                                                _mm256_mul_pd(_mm256_set1_pd(lhs_row[1]), rhs_row_1)) };
+            const __m256d sum_23{ _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(lhs_row[2]), rhs_row_2),
+                                                _mm256_mul_pd(_mm256_set1_pd(lhs_row[3]), rhs_row_3)) };
+            _mm256_storeu_pd(out + row * 4, _mm256_add_pd(sum_01, sum_23));
+        }
+    }
+
+    // Number of boxes tested at once by the box intersection kernel, and of rays tested at once by the packet kernel
+    constexpr size_t BOX_KERNEL_WIDTH{ 8 };
+
+    [[nodiscard]] inline unsigned intersectBoxes(const float* extents,
+                                                 const size_t* near_rows,
+                                                 const size_t* far_rows,
+                                                 const float* origin,
+                                                 const float* inverse_direction,
+                                                 const float t_min,
+                                                 const float t_max,
+                                                 float* entry_ts)
+    {
+        // The accumulated bounds are passed as the second operand of max and min, which is returned for NaN lanes
+        __m256 entry_t{ _mm256_set1_ps(t_min) };
+        __m256 exit_t{ _mm256_set1_ps(t_max) };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const __m256 axis_origin{ _mm256_set1_ps(origin[axis]) };
+            const __m256 axis_inverse_direction{ _mm256_set1_ps(inverse_direction[axis]) };
+            const __m256 near_planes{ _mm256_loadu_ps(extents + near_rows[axis] * BOX_KERNEL_WIDTH) };
+            const __m256 far_planes{ _mm256_loadu_ps(extents + far_rows[axis] * BOX_KERNEL_WIDTH) };
+            entry_t = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(near_planes, axis_origin), axis_inverse_direction),
+                                    entry_t);
+            exit_t = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(far_planes, axis_origin), axis_inverse_direction),
+                                   exit_t);
+        }
+        _mm256_storeu_ps(entry_ts, entry_t);
+
+        const __m256 exit_t_magnitude{ _mm256_andnot_ps(_mm256_set1_ps(-0.0f), exit_t) };
+        const __m256 padded_exit_t{ _mm256_add_ps(exit_t, _mm256_mul_ps(
+                _mm256_set1_ps(BOX_TEST_TOLERANCE), _mm256_add_ps(_mm256_set1_ps(1.0f), exit_t_magnitude))) };
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(entry_t, padded_exit_t, _CMP_LE_OQ)));
+    }
+
+    [[nodiscard]] inline unsigned intersectRaysWithBox(const float* box_extents,
+                                                       const float* origins,
+                                                       const float* inverse_directions,
+                                                       const uint32_t* negative_direction_masks,
+                                                       const size_t row_stride,
+                                                       const float* t_mins,
+                                                       const float* t_maxes,
+                                                       float* entry_ts)
+    {
+        __m256 entry_t{ _mm256_loadu_ps(t_mins) };
+        __m256 exit_t{ _mm256_loadu_ps(t_maxes) };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const __m256 min_planes{ _mm256_set1_ps(box_extents[axis]) };
+            const __m256 max_planes{ _mm256_set1_ps(box_extents[axis + 3]) };
+            const __m256 is_direction_negative{ _mm256_castsi256_ps(_mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(negative_direction_masks + axis * row_stride))) };
+            const __m256 near_planes{ _mm256_blendv_ps(min_planes, max_planes, is_direction_negative) };
+            const __m256 far_planes{ _mm256_blendv_ps(max_planes, min_planes, is_direction_negative) };
+            const __m256 axis_origins{ _mm256_loadu_ps(origins + axis * row_stride) };
+            const __m256 axis_inverse_directions{ _mm256_loadu_ps(inverse_directions + axis * row_stride) };
+            entry_t = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(near_planes, axis_origins), axis_inverse_directions),
+                                    entry_t);
+            exit_t = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(far_planes, axis_origins), axis_inverse_directions),
+                                   exit_t);
+        }
+        _mm256_storeu_ps(entry_ts, entry_t);
+
+        const __m256 exit_t_magnitude{ _mm256_andnot_ps(_mm256_set1_ps(-0.0f), exit_t) };
+        const __m256 padded_exit_t{ _mm256_add_ps(exit_t, _mm256_mul_ps(
+                _mm256_set1_ps(BOX_TEST_TOLERANCE), _mm256_add_ps(_mm256_set1_ps(1.0f), exit_t_magnitude))) };
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(entry_t, padded_exit_t, _CMP_LE_OQ)));
+    }
+
+#elif defined(GFX_SIMD_SSE)
+
+    // Name of the instruction set the kernels were built for
+    constexpr const char* KERNEL_INSTRUCTION_SET{ "SSE2" };
+
+    // Loads two adjacent vector elements into a register element by element, avoiding the store forwarding stall
+    // of a wide load spanning the separate stores which usually produce a freshly built vector
+    [[nodiscard]] inline __m128d loadVectorPair(const double* values)
+    {
+        return _mm_set_pd(values[1], values[0]);
+    }
+
+    // Returns the sum of the two lanes of a register
+    [[nodiscard]] inline double horizontalSum(const __m128d values)
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(values, _mm_unpackhi_pd(values, values)));
+    }
+
+    [[nodiscard]] inline double dotProduct(const double* lhs, const double* rhs)
+    {
+        const __m128d products_xy{ _mm_mul_pd(loadVectorPair(lhs), loadVectorPair(rhs)) };
+        const __m128d products_zw{ _mm_mul_pd(loadVectorPair(lhs + 2), loadVectorPair(rhs + 2)) };
+        return horizontalSum(_mm_add_pd(products_xy, products_zw));
+    }
+
+    inline void crossProduct(const double* lhs, const double* rhs, double* out)
+    {
+        // The x- and y-components share a register, computed from the (y, z) and (z, x) lane pairs
+        const __m128d lhs_xy{ loadVectorPair(lhs) };
+        const __m128d lhs_zw{ loadVectorPair(lhs + 2) };
+        const __m128d rhs_xy{ loadVectorPair(rhs) };
+        const __m128d rhs_zw{ loadVectorPair(rhs + 2) };
+        const __m128d lhs_yz{ _mm_shuffle_pd(lhs_xy, lhs_zw, 0b01) };
+        const __m128d rhs_yz{ _mm_shuffle_pd(rhs_xy, rhs_zw, 0b01) };
+        const __m128d lhs_zx{ _mm_shuffle_pd(lhs_zw, lhs_xy, 0b00) };
+        const __m128d rhs_zx{ _mm_shuffle_pd(rhs_zw, rhs_xy, 0b00) };
+        _mm_storeu_pd(out, _mm_sub_pd(_mm_mul_pd(lhs_yz, rhs_zx), _mm_mul_pd(lhs_zx, rhs_yz)));
+
+        // The z-component only needs the low lanes, with the w-component cleared
+        const __m128d lhs_yy{ _mm_unpackhi_pd(lhs_xy, lhs_xy) };
+        const __m128d rhs_yy{ _mm_unpackhi_pd(rhs_xy, rhs_xy) };
+        const __m128d cross_z{ _mm_sub_sd(_mm_mul_sd(lhs_xy, rhs_yy), _mm_mul_sd(lhs_yy, rhs_xy)) };
+        _mm_storeu_pd(out + 2, _mm_move_sd(_mm_setzero_pd(), cross_z));
+    }
+
+    inline void divide(const double* src, const double scalar, double* out)
+    {
+        const __m128d divisor{ _mm_set1_pd(scalar) };
+        _mm_storeu_pd(out, _mm_div_pd(loadVectorPair(src), divisor));
+        _mm_storeu_pd(out + 2, _mm_div_pd(loadVectorPair(src + 2), divisor));
+    }
+
+    inline void multiplyMatrixVector(const double* matrix, const double* vector, double* out)
+    {
+        // Each output element is the dot product of a matrix row with the vector
+        const __m128d vector_xy{ loadVectorPair(vector) };
+        const __m128d vector_zw{ loadVectorPair(vector + 2) };
+        for (int row = 0; row < 4; row += 2) {
+            const double* row_a{ matrix + row * 4 };
+            const double* row_b{ row_a + 4 };
+            const __m128d sums_a{ _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(row_a), vector_xy),
+                                             _mm_mul_pd(_mm_loadu_pd(row_a + 2), vector_zw)) };
+            const __m128d sums_b{ _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(row_b), vector_xy),
+                                             _mm_mul_pd(_mm_loadu_pd(row_b + 2), vector_zw)) };
+
+            // Add the lanes of each row's partial sums pairwise, producing both results in one register
+            _mm_storeu_pd(out + row, _mm_add_pd(_mm_unpacklo_pd(sums_a, sums_b), _mm_unpackhi_pd(sums_a, sums_b)));
+        }
+    }
+
+    inline void multiplyMatrixMatrix(const double* lhs, const double* rhs, double* out)
+    {
+        // Each output row is a linear combination of the rows of the right-hand matrix, computed in two halves
+        for (int row = 0; row < 4; ++row) {
+            const double* lhs_row{ lhs + row * 4 };
+            const __m128d factor_0{ _mm_set1_pd(lhs_row[0]) };
+            const __m128d factor_1{ _mm_set1_pd(lhs_row[1]) };
+            const __m128d factor_2{ _mm_set1_pd(lhs_row[2]) };
+            const __m128d factor_3{ _mm_set1_pd(lhs_row[3]) };
+            for (int half = 0; half < 4; half += 2) {
+                const __m128d sum_01{ _mm_add_pd(_mm_mul_pd(factor_0, _mm_loadu_pd(rhs + 0 + half)),
+                                                 _mm_mul_pd(factor_1, _mm_loadu_pd(rhs + 4 + half))) };
+                const __m128d sum_23{ _mm_add_pd(_mm_mul_pd(factor_2, _mm_loadu_pd(rhs + 8 + half)),
+                                                 _mm_mul_pd(factor_3, _mm_loadu_pd(rhs + 12 + half))) };
+                _mm_storeu_pd(out + row * 4 + half, _mm_add_pd(sum_01, sum_23));
+            }
+        }
+    }
+
+    // Number of boxes tested at once by the box intersection kernel, and of rays tested at once by the packet kernel
+    constexpr size_t BOX_KERNEL_WIDTH{ 4 };
+
+    [[nodiscard]] inline unsigned intersectBoxes(const float* extents,
+                                                 const size_t* near_rows,
+                                                 const size_t* far_rows,
+                                                 const float* origin,
+                                                 const float* inverse_direction,
+                                                 const float t_min,
+                                                 const float t_max,
+                                                 float* entry_ts)
+    {
+        // The accumulated bounds are passed as the second operand of max and min, which is returned for NaN lanes
+        __m128 entry_t{ _mm_set1_ps(t_min) };
+        __m128 exit_t{ _mm_set1_ps(t_max) };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const __m128 axis_origin{ _mm_set1_ps(origin[axis]) };
+            const __m128 axis_inverse_direction{ _mm_set1_ps(inverse_direction[axis]) };
+            const __m128 near_planes{ _mm_loadu_ps(extents + near_rows[axis] * BOX_KERNEL_WIDTH) };
+            const __m128 far_planes{ _mm_loadu_ps(extents + far_rows[axis] * BOX_KERNEL_WIDTH) };
+            entry_t = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(near_planes, axis_origin), axis_inverse_direction), entry_t);
+            exit_t = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(far_planes, axis_origin), axis_inverse_direction), exit_t);
+        }
+        _mm_storeu_ps(entry_ts, entry_t);
+
+        const __m128 exit_t_magnitude{ _mm_andnot_ps(_mm_set1_ps(-0.0f), exit_t) };
+        const __m128 padded_exit_t{ _mm_add_ps(exit_t, _mm_mul_ps(
+                _mm_set1_ps(BOX_TEST_TOLERANCE), _mm_add_ps(_mm_set1_ps(1.0f), exit_t_magnitude))) };
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(entry_t, padded_exit_t)));
+    }
+
+    [[nodiscard]] inline unsigned intersectRaysWithBox(const float* box_extents,
+                                                       const float* origins,
+                                                       const float* inverse_directions,
+                                                       const uint32_t* negative_direction_masks,
+                                                       const size_t row_stride,
+                                                       const float* t_mins,
+                                                       const float* t_maxes,
+                                                       float* entry_ts)
+    {
+        // SSE2 has no blend instruction, so the planes of each lane are selected with bitwise masking
+        __m128 entry_t{ _mm_loadu_ps(t_mins) };
+        __m128 exit_t{ _mm_loadu_ps(t_maxes) };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const __m128 min_planes{ _mm_set1_ps(box_extents[axis]) };
+            const __m128 max_planes{ _mm_set1_ps(box_extents[axis + 3]) };
+            const __m128 is_direction_negative{ _mm_castsi128_ps(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(negative_direction_masks + axis * row_stride))) };
+            const __m128 near_planes{ _mm_or_ps(_mm_and_ps(is_direction_negative, max_planes),
+                                                _mm_andnot_ps(is_direction_negative, min_planes)) };
+            const __m128 far_planes{ _mm_or_ps(_mm_and_ps(is_direction_negative, min_planes),
+                                               _mm_andnot_ps(is_direction_negative, max_planes)) };
+            const __m128 axis_origins{ _mm_loadu_ps(origins + axis * row_stride) };
+            const __m128 axis_inverse_directions{ _mm_loadu_ps(inverse_directions + axis * row_stride) };
+            entry_t = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(near_planes, axis_origins), axis_inverse_directions), entry_t);
+            exit_t = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(far_planes, axis_origins), axis_inverse_directions), exit_t);
+        }
+        _mm_storeu_ps(entry_ts, entry_t);
+
+        const __m128 exit_t_magnitude{ _mm_andnot_ps(_mm_set1_ps(-0.0f), exit_t) };
+        const __m128 padded_exit_t{ _mm_add_ps(exit_t, _mm_mul_ps(
+                _mm_set1_ps(BOX_TEST_TOLERANCE), _mm_add_ps(_mm_set1_ps(1.0f), exit_t_magnitude))) };
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(entry_t, padded_exit_t)));
+    }
+
+#else
+
+    // Name of the instruction set the kernels were built for
+    constexpr const char* KERNEL_INSTRUCTION_SET{ "Scalar" };
+
+    using scalar::dotProduct;
+    using scalar::crossProduct;
+    using scalar::divide;
+    using scalar::multiplyMatrixVector;
+    using scalar::multiplyMatrixMatrix;
+
+    // Number of boxes tested at once by the box intersection kernel, and of rays tested at once by the packet kernel
+    constexpr size_t BOX_KERNEL_WIDTH{ 4 };
+
+    [[nodiscard]] inline unsigned intersectBoxes(const float* extents,
+                                                 const size_t* near_rows,
+                                                 const size_t* far_rows,
+                                                 const float* origin,
+                                                 const float* inverse_direction,
+                                                 const float t_min,
+                                                 const float t_max,
+                                                 float* entry_ts)
+    {
+        return scalar::intersectBoxes<BOX_KERNEL_WIDTH>(extents, near_rows, far_rows, origin, inverse_direction,
+                                                        t_min, t_max, entry_ts);
+    }
+
+    [[nodiscard]] inline unsigned intersectRaysWithBox(const float* box_extents,
+                                                       const float* origins,
+                                                       const float* inverse_directions,
+                                                       const uint32_t* negative_direction_masks,
+                                                       const size_t row_stride,
+                                                       const float* t_mins,
+                                                       const float* t_maxes,
+                                                       float* entry_ts)
+    {
+        return scalar::intersectRaysWithBox<BOX_KERNEL_WIDTH>(box_extents, origins, inverse_directions,
+                                                              negative_direction_masks, row_stride, t_mins, t_maxes,
+                                                              entry_ts);
+    }
+
+#endif
+}
@@ -2,7 +2,6 @@
 
 #include <ranges>
 #include <stdexcept>
-#include <cmath>
 
 #include "util_functions.hpp"
 
@@ -95,109 +94,16 @@ namespace gfx {
     {
         // Populate the array with the dot product of each row with the vector
         std::array<double, 4> vector_values{};
-        for (int row = 0; row < 4; ++row) {
-            vector_values[row] =
-                    m_data[0] * rhs[row, 0] +
-                    m_data[1] * rhs[row, 1] +
-                    m_data[2] * rhs[row, 2] +
-                    m_data[3] * rhs[row, 3];
-        }
+        simd::multiplyMatrixVector(rhs.data(), m_data.data(), vector_values.data());
 
         // Assign the new values and return
         m_data = vector_values;
         return *this;
     }
 
-    // Vector Magnitude
-    double Vector4::magnitude() const
-    {
-        return std::sqrt(
-                    std::pow(m_data[0], 2) +
-                    std::pow(m_data[1], 2) +
-                    std::pow(m_data[2], 2) +
-                    std::pow(m_data[3], 2)
-        );
-    }
-
-    // Vector Cross Product
-    Vector4 Vector4::crossProduct(const Vector4& rhs) const
-    {
-        return Vector4{ m_data[1] * rhs.z() - m_data[2] * rhs.y(), m_data[2] * rhs.x() - m_data[0] * rhs.z(),
-                        m_data[0] * rhs.y() - m_data[1] * rhs.x(), 0.0 };
-    }
-
     // Vector Reflection
     Vector4 Vector4::reflect(const Vector4& axis) const
     {
         return *this - axis * 2 * dotProduct(*this, axis);
     }
-
-    // Vector Factory Function
-    Vector4 createVector(const double x, const double y, const double z)
-    {
-        return Vector4{ x, y, z, 0.0 };
-    }
-
-    // Point Factory Function
-    Vector4 createPoint(const double x, const double y, const double z)
-    {
-        return Vector4{ x, y, z, 1.0 };
-    }
-
-    // Addition Operator
-    Vector4 operator+(const Vector4& lhs, const Vector4& rhs)
-    {
-        const double w_sum = lhs.w() + rhs.w();
-        if (w_sum > 1) {
-            throw std::invalid_argument{ "Cannot add two points" };
-        }
-
-        return Vector4{ lhs.x() + rhs.x(), lhs.y() + rhs.y(), lhs.z() + rhs.z(), w_sum };
-    }
-
-    // Subtraction Operator
-    Vector4 operator-(const Vector4& lhs, const Vector4& rhs)
-    {
-        return Vector4{ lhs.x() - rhs.x(), lhs.y() - rhs.y(), lhs.z() - rhs.z(), lhs.w() - rhs.w() };
-    }
-
-    // Scalar Multiplication Operator (Vector Left-Hand)
-    Vector4 operator*(const Vector4& lhs, const double rhs)
-    {
-        return Vector4{ lhs.x() * rhs, lhs.y() * rhs, lhs.z() * rhs, lhs.w() * rhs };
-    }
-
-    // Scalar Multiplication Operator (Vector Right-Hand)
-    Vector4 operator*(const double lhs, const Vector4& rhs)
-    {
-        return rhs * lhs;
-    }
-
-    // Matrix-Vector Multiplication Operator
-    Vector4 operator*(const Matrix4& lhs, const Vector4& rhs)
-    {
-        std::array<double, 4> vector_values{};
-        for (int row = 0; row < 4; ++row) {
-            vector_values[row] =
-                    lhs[row, 0] * rhs.x() +
-                    lhs[row, 1] * rhs.y() +
-                    lhs[row, 2] * rhs.z() +
-                    lhs[row, 3] * rhs.w();
-        }
-
-        return Vector4{ vector_values };
-    }
-
-    // Normalize Vector
-    Vector4 normalize(const Vector4& src)
-    {
-        const double magnitude = src.magnitude();
-        return Vector4{ src.x() / magnitude, src.y() / magnitude, src.z() / magnitude, src.w() / magnitude };
-    }
-
-    // Vector Dot Product
-    double dotProduct(const Vector4& lhs, const Vector4& rhs)
-    {
-        return lhs.x() * rhs.x() + lhs.y() * rhs.y() + lhs.z() * rhs.z() + lhs.w() * rhs.w();
-    }
 }
\ No newline at end of file
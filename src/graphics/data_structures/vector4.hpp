@@ -1,10 +1,13 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <span>
 #include <format>
+#include <stdexcept>
 
 #include "matrix4.hpp"
+#include "simd_kernels.hpp"
 
 namespace gfx {
     class Vector4
@@ -36,6 +39,10 @@ namespace gfx {
         [[nodiscard]] double z() const { return m_data[2]; }
         [[nodiscard]] double w() const { return m_data[3]; }
 
+        // Returns a pointer to the four contiguous elements of the vector, for use by the vector math kernels
+        [[nodiscard]] const double* data() const { return m_data.data(); }
+        [[nodiscard]] double* data() { return m_data.data(); }
+
         /* Mutators */
 
         // Resets the w-value to 0, for use when it might get altered in surface normal calculations
@@ -55,10 +62,16 @@ namespace gfx {
         /* Vector Operations */
 
         // Returns a double representing the magnitude of the vector
-        [[nodiscard]] double magnitude() const;
+        [[nodiscard]] double magnitude() const
+        { return std::sqrt(simd::dotProduct(m_data.data(), m_data.data())); }
 
         // Returns a vector representing the cross product of this vector and the input vector
-        [[nodiscard]] Vector4 crossProduct(const Vector4& rhs) const;
+        [[nodiscard]] Vector4 crossProduct(const Vector4& rhs) const
+        {
+            Vector4 cross_product{ };
+            simd::crossProduct(m_data.data(), rhs.data(), cross_product.data());
+            return cross_product;
+        }
 
         // Returns a vector representing the reflection of this vector around an axis defined by a passed-in vector
         [[nodiscard]] Vector4 reflect(const Vector4& axis) const;
@@ -72,27 +85,60 @@ namespace gfx {
     /* Factory Functions */
 
     // Returns a Vector4 representing a vector in space
-    [[nodiscard]] Vector4 createVector(double x, double y, double z);
+    [[nodiscard]] inline Vector4 createVector(const double x, const double y, const double z)
+    { return Vector4{ x, y, z, 0.0 }; }
 
     // Returns a Vector4 representing a point in space
-    [[nodiscard]] Vector4 createPoint(double x, double y, double z);
+    [[nodiscard]] inline Vector4 createPoint(const double x, const double y, const double z)
+    { return Vector4{ x, y, z, 1.0 }; }
 
     /* Global Arithmetic Operator Overloads */
 
-    [[nodiscard]] Vector4 operator+(const Vector4& lhs, const Vector4& rhs);
-    [[nodiscard]] Vector4 operator-(const Vector4& lhs, const Vector4& rhs);
-    [[nodiscard]] Vector4 operator*(const Vector4& lhs, double rhs);
-    [[nodiscard]] Vector4 operator*(double lhs, const Vector4& rhs);
-    [[nodiscard]] Vector4 operator*(const Matrix4& lhs, const Vector4& rhs);
+    // Addition Operator
+    [[nodiscard]] inline Vector4 operator+(const Vector4& lhs, const Vector4& rhs)
+    {
+        const double w_sum = lhs.w() + rhs.w();
+        if (w_sum > 1) {
+            throw std::invalid_argument{ "Cannot add two points" };
+        }
+
+        return Vector4{ lhs.x() + rhs.x(), lhs.y() + rhs.y(), lhs.z() + rhs.z(), w_sum };
+    }
+
+    // Subtraction Operator
+    [[nodiscard]] inline Vector4 operator-(const Vector4& lhs, const Vector4& rhs)
+    { return Vector4{ lhs.x() - rhs.x(), lhs.y() - rhs.y(), lhs.z() - rhs.z(), lhs.w() - rhs.w() }; }
+
+    // Scalar Multiplication Operator (Vector Left-Hand)
+    [[nodiscard]] inline Vector4 operator*(const Vector4& lhs, const double rhs)
+    { return Vector4{ lhs.x() * rhs, lhs.y() * rhs, lhs.z() * rhs, lhs.w() * rhs }; }
+
+    // Scalar Multiplication Operator (Vector Right-Hand)
+    [[nodiscard]] inline Vector4 operator*(const double lhs, const Vector4& rhs)
+    { return rhs * lhs; }
+
+    // Matrix-Vector Multiplication Operator
+    [[nodiscard]] inline Vector4 operator*(const Matrix4& lhs, const Vector4& rhs)
+    {
+        Vector4 product{ };
+        simd::multiplyMatrixVector(lhs.data(), rhs.data(), product.data());
+        return product;
+    }
 
     /* Global Vector Operations */
 
     // Returns a normalized version of the input vector, i.e. a vector with the
     // same direction but a magnitude of 1
-    [[nodiscard]] Vector4 normalize(const Vector4& src);
+    [[nodiscard]] inline Vector4 normalize(const Vector4& src)
+    {
+        Vector4 normalized{ };
+        simd::divide(src.data(), src.magnitude(), normalized.data());
+        return normalized;
+    }
 
     // Returns the dot product of this vector with the input vector
-    [[nodiscard]] double dotProduct(const Vector4& lhs, const Vector4& rhs);
+    [[nodiscard]] inline double dotProduct(const Vector4& lhs, const Vector4& rhs)
+    { return simd::dotProduct(lhs.data(), rhs.data()); }
 }
 
 /* Template Specializations */
@@ -109,5 +155,3 @@ struct std::formatter<gfx::Vector4> : std::formatter<std::string>
                             ctx);
     }
 };
-
-
@@ -429,4 +429,38 @@ TEST(GraphicsVector4, FormatterSpecialization)
     const std::string str_actual{ std::format("{}", vec) };
 
     EXPECT_TRUE(str_actual == str_expected);
+}
+
+// Tests that the vector math kernels selected at build time agree with the scalar kernels
+TEST(GraphicsVector4, SimdKernelsMatchScalar)
+{
+    const std::array<double, 16> matrix{ 1.5, -2.0, 0.25, 3.0,
+                                         0.0, 4.0, -1.0, 2.5,
+                                         -3.5, 0.5, 2.0, -1.0,
+                                         0.0, 0.0, 0.0, 1.0 };
+    const std::array<double, 4> lhs{ 1.25, -3.0, 2.5, 1.0 };
+    const std::array<double, 4> rhs{ -0.5, 4.0, 1.5, 0.0 };
+
+    EXPECT_DOUBLE_EQ(gfx::simd::dotProduct(lhs.data(), rhs.data()),
+                     gfx::simd::scalar::dotProduct(lhs.data(), rhs.data()));
+
+    std::array<double, 4> vector_expected{ };
+    std::array<double, 4> vector_actual{ };
+    gfx::simd::scalar::crossProduct(lhs.data(), rhs.data(), vector_expected.data());
+    gfx::simd::crossProduct(lhs.data(), rhs.data(), vector_actual.data());
+    EXPECT_EQ(gfx::Vector4{ vector_actual }, gfx::Vector4{ vector_expected });
+
+    gfx::simd::scalar::divide(lhs.data(), 2.5, vector_expected.data());
+    gfx::simd::divide(lhs.data(), 2.5, vector_actual.data());
+    EXPECT_EQ(gfx::Vector4{ vector_actual }, gfx::Vector4{ vector_expected });
+
+    gfx::simd::scalar::multiplyMatrixVector(matrix.data(), lhs.data(), vector_expected.data());
+    gfx::simd::multiplyMatrixVector(matrix.data(), lhs.data(), vector_actual.data());
+    EXPECT_EQ(gfx::Vector4{ vector_actual }, gfx::Vector4{ vector_expected });
+
+    std::array<double, 16> matrix_expected{ };
+    std::array<double, 16> matrix_actual{ };
+    gfx::simd::scalar::multiplyMatrixMatrix(matrix.data(), matrix.data(), matrix_expected.data());
+    gfx::simd::multiplyMatrixMatrix(matrix.data(), matrix.data(), matrix_actual.data());
+    EXPECT_EQ(gfx::Matrix4{ matrix_actual }, gfx::Matrix4{ matrix_expected });
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "benchmark/benchmark.h"
+#include "simd_kernels.hpp"
+
+#include <array>
+
+// Operands shared by the kernel benchmarks, chosen to resemble a typical affine transform and direction vector
+static constexpr std::array<double, 16> BENCH_MATRIX{ 0.8, -0.6, 0.0, 2.0,
+                                                      0.6, 0.8, 0.0, -1.5,
+                                                      0.0, 0.0, 1.0, 4.0,
+                                                      0.0, 0.0, 0.0, 1.0 };
+static constexpr std::array<double, 4> BENCH_VECTOR{ 0.267, -0.534, 0.802, 0.0 };
+static constexpr std::array<double, 4> BENCH_OTHER_VECTOR{ -0.707, 0.0, 0.707, 0.0 };
+
+// Benchmarks the scalar dot product kernel
+static void BM_DotProductScalar(benchmark::State& state)
+{
+    std::array<double, 4> lhs{ BENCH_VECTOR };
+    std::array<double, 4> rhs{ BENCH_OTHER_VECTOR };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        benchmark::DoNotOptimize(gfx::simd::scalar::dotProduct(lhs.data(), rhs.data()));
+    }
+}
+BENCHMARK(BM_DotProductScalar);
+
+// Benchmarks the dot product kernel selected at build time
+static void BM_DotProduct(benchmark::State& state)
+{
+    std::array<double, 4> lhs{ BENCH_VECTOR };
+    std::array<double, 4> rhs{ BENCH_OTHER_VECTOR };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        benchmark::DoNotOptimize(gfx::simd::dotProduct(lhs.data(), rhs.data()));
+    }
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_DotProduct);
+
+// Benchmarks the scalar cross product kernel
+static void BM_CrossProductScalar(benchmark::State& state)
+{
+    std::array<double, 4> lhs{ BENCH_VECTOR };
+    std::array<double, 4> rhs{ BENCH_OTHER_VECTOR };
+    std::array<double, 4> out{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        gfx::simd::scalar::crossProduct(lhs.data(), rhs.data(), out.data());
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_CrossProductScalar);
+
+// Benchmarks the cross product kernel selected at build time
+static void BM_CrossProduct(benchmark::State& state)
+{
+    std::array<double, 4> lhs{ BENCH_VECTOR };
+    std::array<double, 4> rhs{ BENCH_OTHER_VECTOR };
+    std::array<double, 4> out{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        gfx::simd::crossProduct(lhs.data(), rhs.data(), out.data());
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_CrossProduct);
+
+// Benchmarks the scalar matrix-vector multiplication kernel
+static void BM_MatrixVectorScalar(benchmark::State& state)
+{
+    std::array<double, 16> matrix{ BENCH_MATRIX };
+    std::array<double, 4> vector{ BENCH_VECTOR };
+    std::array<double, 4> out{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(vector);
+        gfx::simd::scalar::multiplyMatrixVector(matrix.data(), vector.data(), out.data());
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_MatrixVectorScalar);
+
+// Benchmarks the matrix-vector multiplication kernel selected at build time
+static void BM_MatrixVector(benchmark::State& state)
+{
+    std::array<double, 16> matrix{ BENCH_MATRIX };
+    std::array<double, 4> vector{ BENCH_VECTOR };
+    std::array<double, 4> out{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(vector);
+        gfx::simd::multiplyMatrixVector(matrix.data(), vector.data(), out.data());
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_MatrixVector);
+
+// Benchmarks the scalar matrix-matrix multiplication kernel
+static void BM_MatrixMatrixScalar(benchmark::State& state)
+{
+    std::array<double, 16> lhs{ BENCH_MATRIX };
+    std::array<double, 16> rhs{ BENCH_MATRIX };
+    std::array<double, 16> out{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        gfx::simd::scalar::multiplyMatrixMatrix(lhs.data(), rhs.data(), out.data());
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_MatrixMatrixScalar);
+
+// Benchmarks the matrix-matrix multiplication kernel selected at build time
+static void BM_MatrixMatrix(benchmark::State& state)
+{
+    std::array<double, 16> lhs{ BENCH_MATRIX };
+    std::array<double, 16> rhs{ BENCH_MATRIX };
+    std::array<double, 16> out{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        gfx::simd::multiplyMatrixMatrix(lhs.data(), rhs.data(), out.data());
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_MatrixMatrix);
\ No newline at end of file
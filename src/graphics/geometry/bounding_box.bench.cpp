@@ -0,0 +1,40 @@
+#include "benchmark/benchmark.h"
+#include "bounding_box.hpp"
+
+#include "ray.hpp"
+
+// Benchmarks testing a ray against a bounding box it passes through
+static void BM_BoundingBoxHit(benchmark::State& state)
+{
+    const gfx::BoundingBox box{ -1, -1, -1, 1, 1, 1 };
+    gfx::Ray ray{ -5, 0.25, -0.5, 1, 0.05, 0.1 };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ray);
+        benchmark::DoNotOptimize(box.isIntersectedBy(ray));
+    }
+}
+BENCHMARK(BM_BoundingBoxHit);
+
+// Benchmarks testing a ray against a bounding box it misses
+static void BM_BoundingBoxMiss(benchmark::State& state)
+{
+    const gfx::BoundingBox box{ -1, -1, -1, 1, 1, 1 };
+    gfx::Ray ray{ -5, 2.5, -0.5, 1, 0.05, 0.1 };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ray);
+        benchmark::DoNotOptimize(box.isIntersectedBy(ray));
+    }
+}
+BENCHMARK(BM_BoundingBoxMiss);
+
+// Benchmarks testing a ray against a bounding box within a distance interval, as the hierarchy traversal does
+static void BM_BoundingBoxHitInterval(benchmark::State& state)
+{
+    const gfx::BoundingBox box{ -1, -1, -1, 1, 1, 1 };
+    gfx::Ray ray{ -5, 0.25, -0.5, 1, 0.05, 0.1 };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ray);
+        benchmark::DoNotOptimize(box.isIntersectedBy(ray, 0, 10));
+    }
+}
+BENCHMARK(BM_BoundingBoxHitInterval);
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include "bounding_box.hpp"
 
+#include <cmath>
+
 #include "util_functions.hpp"
 #include "intersection.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     void BoundingBox::addPoint(const Vector4& point)
@@ -50,6 +53,8 @@ namespace gfx {
 
     bool BoundingBox::isIntersectedBy(const Ray& ray) const
     {
+        RenderStatisticsCollector::recordBoundingBoxTest();
+
         const auto [ t_min, t_max ] { calculateBoxIntersectionTs(ray,
                                                                  this->getMinExtentPoint(),
                                                                  this->getMaxExtentPoint()) };
@@ -57,6 +62,18 @@ namespace gfx {
         return utils::isLessOrEqual(t_min, t_max);
     }
 
+    bool BoundingBox::isIntersectedBy(const Ray& ray, const double t_min, const double t_max) const
+    {
+        RenderStatisticsCollector::recordBoundingBoxTest();
+
+        const auto [ box_t_min, box_t_max ] { calculateBoxIntersectionTs(ray,
+                                                                         this->getMinExtentPoint(),
+                                                                         this->getMaxExtentPoint()) };
+
+        // Clip the span of the ray within the box to the interval
+        return utils::isLessOrEqual(std::fmax(box_t_min, t_min), std::fmin(box_t_max, t_max));
+    }
+
     BoundingBox BoundingBox::transform(const Matrix4& transform_matrix) const
     {
         std::array<Vector4, 8> bounding_volume_vertices {
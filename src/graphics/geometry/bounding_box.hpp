@@ -133,6 +133,9 @@ namespace gfx {
         // Returns true if a ray intersects with this bounding box
         [[nodiscard]] bool isIntersectedBy(const Ray& ray) const;
 
+        // Returns true if a ray intersects with this bounding box at a t-value within the interval [t_min, t_max]
+        [[nodiscard]] bool isIntersectedBy(const Ray& ray, double t_min, double t_max) const;
+
         /* Transformation Operations */
 
         // Returns a new axis-aligned bounding box enclosing the transformed bounds volume
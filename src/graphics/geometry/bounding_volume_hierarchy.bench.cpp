@@ -0,0 +1,187 @@
+#include "benchmark/benchmark.h"
+#include "bounding_volume_hierarchy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "composite_surface.hpp"
+#include "sphere.hpp"
+#include "triangle_mesh.hpp"
+#include "intersection.hpp"
+#include "simd_kernels.hpp"
+#include "transform.hpp"
+
+// Returns small spheres arranged in a square grid in the xy-plane, with their depths varying in z
+static std::vector<std::shared_ptr<gfx::Object>> createSphereGrid(const int size)
+{
+    std::vector<std::shared_ptr<gfx::Object>> spheres{ };
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x) {
+            spheres.push_back(std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(x, y, (x * 7 + y * 3) % 5) *
+                                                            gfx::createScalingMatrix(0.4)));
+        }
+    return spheres;
+}
+
+// Returns rays cast along the z-axis through a grid of points covering the passed-in extent of the xy-plane
+static std::vector<gfx::Ray> createRayGrid(const double extent)
+{
+    constexpr int rays_per_side{ 32 };
+    std::vector<gfx::Ray> rays{ };
+    for (int y = 0; y < rays_per_side; ++y)
+        for (int x = 0; x < rays_per_side; ++x) {
+            rays.emplace_back(extent * (x + 0.37) / rays_per_side, extent * (y + 0.61) / rays_per_side, -10,
+                              0.01, -0.02, 1);
+        }
+    return rays;
+}
+
+// Builds a pointer-based hierarchy of nested groups in the style of the book, recursively splitting the objects at
+// the median along the axis of greatest spread until each group holds at most the passed-in number of objects
+static std::shared_ptr<gfx::Object> createNestedGroup(std::span<std::shared_ptr<gfx::Object>> objects,
+                                                      const size_t max_group_size)
+{
+    auto group{ std::make_shared<gfx::CompositeSurface>() };
+    if (objects.size() <= max_group_size) {
+        for (const auto& object : objects) {
+            group->addChild(object);
+        }
+        return group;
+    }
+
+    gfx::BoundingBox centroid_bounds{ };
+    for (const auto& object : objects) {
+        centroid_bounds.addPoint(gfx::getBoundingBoxCentroid(object->getLocalSpaceBounds()));
+    }
+    const gfx::Vector4 spread{ centroid_bounds.getMaxExtentPoint() - centroid_bounds.getMinExtentPoint() };
+    const auto get_axis_value{ [&](const std::shared_ptr<gfx::Object>& object) {
+        const gfx::Vector4 centroid{ gfx::getBoundingBoxCentroid(object->getLocalSpaceBounds()) };
+        return spread.x() >= spread.y() && spread.x() >= spread.z() ? centroid.x()
+             : spread.y() >= spread.z() ? centroid.y() : centroid.z();
+    } };
+
+    const size_t middle{ objects.size() / 2 };
+    std::nth_element(objects.begin(), objects.begin() + static_cast<std::ptrdiff_t>(middle), objects.end(),
+                     [&](const auto& lhs, const auto& rhs) { return get_axis_value(lhs) < get_axis_value(rhs); });
+    group->addChild(createNestedGroup(objects.first(middle), max_group_size));
+    group->addChild(createNestedGroup(objects.subspan(middle), max_group_size));
+    return group;
+}
+
+// Runs the closest intersection benchmark loop for an object over a set of rays
+static void benchmarkClosestIntersections(benchmark::State& state,
+                                          const gfx::Object& object,
+                                          const std::vector<gfx::Ray>& rays)
+{
+    for (auto _ : state) {
+        for (const gfx::Ray& ray : rays) {
+            benchmark::DoNotOptimize(object.getClosestIntersection(ray, 0, std::numeric_limits<double>::infinity()));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+
+// Benchmarks finding the closest sphere in a group whose children are organized into a flattened hierarchy
+static void BM_FlatHierarchyClosestIntersection(benchmark::State& state)
+{
+    const int grid_size{ static_cast<int>(state.range(0)) };
+    std::vector<std::shared_ptr<gfx::Object>> spheres{ createSphereGrid(grid_size) };
+    gfx::CompositeSurface group{ };
+    for (const auto& sphere : spheres) {
+        group.addChild(sphere);
+    }
+    group.divide();
+
+    benchmarkClosestIntersections(state, group, createRayGrid(grid_size));
+}
+BENCHMARK(BM_FlatHierarchyClosestIntersection)->Arg(16)->Arg(64);
+
+// Benchmarks finding the closest sphere in a tree of nested groups, chasing a child pointer at each level
+static void BM_NestedGroupClosestIntersection(benchmark::State& state)
+{
+    const int grid_size{ static_cast<int>(state.range(0)) };
+    std::vector<std::shared_ptr<gfx::Object>> spheres{ createSphereGrid(grid_size) };
+    const auto nested_group{ createNestedGroup(spheres, gfx::DEFAULT_BVH_MAX_LEAF_SIZE) };
+
+    benchmarkClosestIntersections(state, *nested_group, createRayGrid(grid_size));
+}
+BENCHMARK(BM_NestedGroupClosestIntersection)->Arg(16)->Arg(64);
+
+// Benchmarks finding the closest triangle of a large mesh, where the time is dominated by hierarchy traversal
+static void BM_FlatHierarchyMeshClosestIntersection(benchmark::State& state)
+{
+    const auto size{ static_cast<uint32_t>(state.range(0)) };
+    std::vector<gfx::Vector4> vertices{ };
+    for (uint32_t y = 0; y <= size; ++y)
+        for (uint32_t x = 0; x <= size; ++x) {
+            vertices.push_back(gfx::createPoint(x, y, ((x * 7 + y * 13) % 17) * 0.05));
+        }
+    std::vector<uint32_t> indices{ };
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x) {
+            const uint32_t corner{ y * (size + 1) + x };
+            indices.insert(indices.end(), { corner, corner + 1, corner + size + 1 });
+            indices.insert(indices.end(), { corner + 1, corner + size + 2, corner + size + 1 });
+        }
+    const gfx::TriangleMesh mesh{ std::make_shared<const gfx::TriangleMeshData>(std::move(vertices),
+                                                                                std::move(indices)) };
+
+    benchmarkClosestIntersections(state, mesh, createRayGrid(size));
+}
+BENCHMARK(BM_FlatHierarchyMeshClosestIntersection)->Arg(64)->Arg(1024);
+
+// Returns the extents of a row of unit boxes, one per lane of the box kernel, in the layout of a wide node
+static std::array<std::array<float, gfx::simd::BOX_KERNEL_WIDTH>, 6> createBoxKernelExtents()
+{
+    std::array<std::array<float, gfx::simd::BOX_KERNEL_WIDTH>, 6> extents{ };
+    for (size_t lane = 0; lane < gfx::simd::BOX_KERNEL_WIDTH; ++lane) {
+        const auto x{ static_cast<float>(2 * lane) };
+        extents[0][lane] = x;
+        extents[3][lane] = x + 1;
+        extents[4][lane] = extents[5][lane] = 1;
+    }
+    return extents;
+}
+
+// Benchmarks testing a ray against a full wide node of boxes using the scalar box kernel
+static void BM_BoxKernelScalar(benchmark::State& state)
+{
+    const auto extents{ createBoxKernelExtents() };
+    constexpr std::array<size_t, 3> near_rows{ 0, 1, 2 };
+    constexpr std::array<size_t, 3> far_rows{ 3, 4, 5 };
+    std::array<float, 3> origin{ -5, 0.25, 0.5 };
+    std::array<float, 3> inverse_direction{ 1, 20, 10 };
+    std::array<float, gfx::simd::BOX_KERNEL_WIDTH> entry_ts{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(origin);
+        benchmark::DoNotOptimize(gfx::simd::scalar::intersectBoxes<gfx::simd::BOX_KERNEL_WIDTH>(
+                extents.front().data(), near_rows.data(), far_rows.data(), origin.data(), inverse_direction.data(),
+                0, 100, entry_ts.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(gfx::simd::BOX_KERNEL_WIDTH));
+}
+BENCHMARK(BM_BoxKernelScalar);
+
+// Benchmarks testing a ray against a full wide node of boxes using the box kernel selected at build time
+static void BM_BoxKernel(benchmark::State& state)
+{
+    const auto extents{ createBoxKernelExtents() };
+    constexpr std::array<size_t, 3> near_rows{ 0, 1, 2 };
+    constexpr std::array<size_t, 3> far_rows{ 3, 4, 5 };
+    std::array<float, 3> origin{ -5, 0.25, 0.5 };
+    std::array<float, 3> inverse_direction{ 1, 20, 10 };
+    std::array<float, gfx::simd::BOX_KERNEL_WIDTH> entry_ts{ };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(origin);
+        benchmark::DoNotOptimize(gfx::simd::intersectBoxes(
+                extents.front().data(), near_rows.data(), far_rows.data(), origin.data(), inverse_direction.data(),
+                0, 100, entry_ts.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(gfx::simd::BOX_KERNEL_WIDTH));
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_BoxKernel);
@@ -0,0 +1,446 @@
+#include "bounding_volume_hierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace gfx {
+    BoundingVolumeHierarchy::BoundingVolumeHierarchy(const std::vector<BoundingBox>& primitive_bounds,
+                                                     const size_t max_leaf_size,
+                                                     const BvhSplitMethod split_method)
+            : m_primitive_indices(primitive_bounds.size())
+    {
+        if (max_leaf_size == 0)
+            throw std::invalid_argument{ "Bounding volume hierarchy leaves must hold at least one primitive." };
+
+        if (max_leaf_size > std::numeric_limits<uint16_t>::max())
+            throw std::invalid_argument{ "Bounding volume hierarchy leaves must hold at most 65535 primitives." };
+
+        if (primitive_bounds.empty())
+            return;
+
+        // A binary tree with single-primitive leaves has at most 2n - 1 nodes. The binary nodes are only needed until
+        // they are collapsed, so they are released once the wide nodes are built.
+        std::iota(m_primitive_indices.begin(), m_primitive_indices.end(), 0);
+        std::vector<Node> nodes{ };
+        nodes.reserve(2 * primitive_bounds.size() - 1);
+        this->buildNode(nodes, 0, primitive_bounds.size(), 0, primitive_bounds, max_leaf_size, split_method);
+        this->buildWideNodes(nodes);
+        this->bindOwnedStorage();
+    }
+
+    BoundingVolumeHierarchy::BoundingVolumeHierarchy(const std::span<const WideNode> wide_nodes,
+                                                     const std::span<const uint32_t> primitive_indices,
+                                                     std::shared_ptr<const void> storage)
+            : m_primitive_indices{ },
+              m_wide_nodes{ },
+              m_primitive_index_view{ primitive_indices },
+              m_wide_node_view{ wide_nodes },
+              m_storage{ std::move(storage) }
+    {
+        if (wide_nodes.empty() != primitive_indices.empty())
+            throw std::invalid_argument{ "Bounding volume hierarchy must have nodes if and only if it has primitives." };
+
+        if (!wide_nodes.empty() && !m_storage)
+            throw std::invalid_argument{ "Externally stored bounding volume hierarchy requires an owner." };
+
+        this->validateWideNodes();
+    }
+
+    BoundingVolumeHierarchy::BoundingVolumeHierarchy(const BoundingVolumeHierarchy& other)
+            : m_primitive_indices{ other.m_primitive_indices },
+              m_wide_nodes{ other.m_wide_nodes },
+              m_primitive_index_view{ other.m_primitive_index_view },
+              m_wide_node_view{ other.m_wide_node_view },
+              m_storage{ other.m_storage }
+    {
+        // Copied nodes live at a new address, while externally stored nodes are shared
+        if (!m_storage)
+            this->bindOwnedStorage();
+    }
+
+    BoundingVolumeHierarchy& BoundingVolumeHierarchy::operator=(const BoundingVolumeHierarchy& other)
+    {
+        if (this != &other) {
+            m_primitive_indices = other.m_primitive_indices;
+            m_wide_nodes = other.m_wide_nodes;
+            m_primitive_index_view = other.m_primitive_index_view;
+            m_wide_node_view = other.m_wide_node_view;
+            m_storage = other.m_storage;
+            if (!m_storage)
+                this->bindOwnedStorage();
+        }
+
+        return *this;
+    }
+
+    BoundingBox BoundingVolumeHierarchy::getBounds() const
+    {
+        // The root of the wide tree holds the bounds of the top few subtrees, which together enclose everything
+        BoundingBox bounds{ };
+        if (m_wide_node_view.empty())
+            return bounds;
+
+        const WideNode& root{ m_wide_node_view.front() };
+        for (size_t lane = 0; lane < root.child_count; ++lane) {
+            bounds.mergeWithBox(BoundingBox{ root.child_extents[0][lane],
+                                             root.child_extents[1][lane],
+                                             root.child_extents[2][lane],
+                                             root.child_extents[3][lane],
+                                             root.child_extents[4][lane],
+                                             root.child_extents[5][lane] });
+        }
+        return bounds;
+    }
+
+    void BoundingVolumeHierarchy::validateWideNodes() const
+    {
+        if (m_wide_node_view.empty())
+            return;
+
+        // Walk the tree from the root with the range of nodes each subtree must lie within. The wide children of a
+        // node must follow it in increasing order, with each subtree ending where the next begins, which also rules
+        // out cycles and shared subtrees, so every node is visited at most once. The depth of each node is tracked
+        // as well, since the traversal stacks only have room for the children deferred above the maximum depth.
+        std::vector<std::tuple<size_t, size_t, size_t>> pending_subtrees{ { 0, m_wide_node_view.size(), 0 } };
+        while (!pending_subtrees.empty()) {
+            const auto [ node_index, subtree_end, depth ] { pending_subtrees.back() };
+            pending_subtrees.pop_back();
+
+            if (depth >= MAX_TRAVERSAL_DEPTH)
+                throw std::invalid_argument{ "Bounding volume hierarchy is too deep to be traversed." };
+
+            const WideNode& node{ m_wide_node_view[node_index] };
+            if (node.child_count == 0 || node.child_count > WIDE_NODE_WIDTH)
+                throw std::invalid_argument{
+                        "Bounding volume hierarchy wide nodes must have between one and the node width children." };
+
+            // The box kernel tests every lane, so an unused lane must hold an empty box which no ray can hit
+            for (size_t lane = node.child_count; lane < WIDE_NODE_WIDTH; ++lane) {
+                for (size_t row = 0; row < 3; ++row) {
+                    if (node.child_extents[row][lane] != std::numeric_limits<float>::infinity() ||
+                            node.child_extents[row + 3][lane] != -std::numeric_limits<float>::infinity())
+                        throw std::invalid_argument{
+                                "Bounding volume hierarchy wide nodes must hold empty boxes in their unused lanes." };
+                }
+                if (node.child_offsets[lane] != 0 || node.child_primitive_counts[lane] != 0)
+                    throw std::invalid_argument{
+                            "Bounding volume hierarchy wide nodes must not reference children from unused lanes." };
+            }
+
+            std::array<size_t, WIDE_NODE_WIDTH> wide_children{ };
+            size_t wide_child_count{ 0 };
+            size_t next_child_index{ node_index + 1 };
+            for (size_t lane = 0; lane < node.child_count; ++lane) {
+                const size_t offset{ node.child_offsets[lane] };
+                const size_t leaf_size{ node.child_primitive_counts[lane] };
+                if (leaf_size > 0 && offset + leaf_size > m_primitive_index_view.size())
+                    throw std::invalid_argument{
+                            "Bounding volume hierarchy leaves must reference a range of the primitive index list." };
+                if (leaf_size > 0)
+                    continue;
+
+                if (offset < next_child_index || offset >= subtree_end)
+                    throw std::invalid_argument{
+                            "Bounding volume hierarchy interior nodes must reference children within their subtree." };
+
+                wide_children[wide_child_count++] = offset;
+                next_child_index = offset + 1;
+            }
+
+            for (size_t i = 0; i < wide_child_count; ++i) {
+                pending_subtrees.emplace_back(wide_children[i],
+                                              i + 1 < wide_child_count ? wide_children[i + 1] : subtree_end,
+                                              depth + 1);
+            }
+        }
+
+        const size_t primitive_count{ m_primitive_index_view.size() };
+        if (std::ranges::any_of(m_primitive_index_view,
+                                [&](const uint32_t primitive_index) { return primitive_index >= primitive_count; }))
+            throw std::invalid_argument{ "Bounding volume hierarchy primitive indices must be within the hierarchy." };
+    }
+
+    void BoundingVolumeHierarchy::bindOwnedStorage()
+    {
+        m_primitive_index_view = m_primitive_indices;
+        m_wide_node_view = m_wide_nodes;
+    }
+
+    void BoundingVolumeHierarchy::buildNode(std::vector<Node>& nodes,
+                                            const size_t first_primitive,
+                                            const size_t primitive_count,
+                                            const size_t depth,
+                                            const std::vector<BoundingBox>& primitive_bounds,
+                                            const size_t max_leaf_size,
+                                            const BvhSplitMethod split_method)
+    {
+        const auto primitives_begin{ m_primitive_indices.begin() + static_cast<std::ptrdiff_t>(first_primitive) };
+        const auto primitives_end{ primitives_begin + static_cast<std::ptrdiff_t>(primitive_count) };
+
+        // Enclose every primitive in the range, tracking the spread of their centroids to choose a split axis
+        BoundingBox node_bounds{ };
+        BoundingBox centroid_bounds{ };
+        for (auto it = primitives_begin; it != primitives_end; ++it) {
+            node_bounds.mergeWithBox(primitive_bounds[*it]);
+            centroid_bounds.addPoint(getBoundingBoxCentroid(primitive_bounds[*it]));
+        }
+        const size_t node_index{ nodes.size() };
+        nodes.emplace_back();
+        setNodeBounds(nodes[node_index], node_bounds);
+
+        // Split along the axis with the largest centroid spread
+        const std::array<double, 3> centroid_mins{ centroid_bounds.getMinX(),
+                                                   centroid_bounds.getMinY(),
+                                                   centroid_bounds.getMinZ() };
+        const std::array<double, 3> centroid_extents{ centroid_bounds.getMaxX() - centroid_bounds.getMinX(),
+                                                      centroid_bounds.getMaxY() - centroid_bounds.getMinY(),
+                                                      centroid_bounds.getMaxZ() - centroid_bounds.getMinZ() };
+        const size_t split_axis{ static_cast<size_t>(std::distance(
+                centroid_extents.begin(),
+                std::max_element(centroid_extents.begin(), centroid_extents.end()))) };
+
+        size_t left_count{ 0 };
+        if (split_method == BvhSplitMethod::SurfaceAreaHeuristic && depth < MAX_SAH_BUILD_DEPTH && primitive_count > 1) {
+            left_count = this->partitionBySurfaceArea(first_primitive, primitive_count, split_axis,
+                                                      centroid_mins[split_axis], centroid_extents[split_axis],
+                                                      node_bounds, primitive_bounds, max_leaf_size);
+        }
+
+        if (left_count == 0) {
+            // Small ranges are stored directly in a leaf
+            if (primitive_count <= max_leaf_size) {
+                nodes[node_index].offset = static_cast<uint32_t>(first_primitive);
+                nodes[node_index].primitive_count = static_cast<uint32_t>(primitive_count);
+                return;
+            }
+
+            // Otherwise split the range at the median centroid
+            left_count = primitive_count / 2;
+            std::nth_element(primitives_begin,
+                             primitives_begin + static_cast<std::ptrdiff_t>(left_count),
+                             primitives_end,
+                             [&](const uint32_t lhs, const uint32_t rhs) {
+                                 return getCentroidAlongAxis(primitive_bounds[lhs], split_axis) <
+                                        getCentroidAlongAxis(primitive_bounds[rhs], split_axis);
+                             });
+        }
+
+        // The left subtree is laid out directly after the interior node, so the node only needs to store the index of
+        // the right child, which follows the whole left subtree
+        this->buildNode(nodes, first_primitive, left_count, depth + 1, primitive_bounds, max_leaf_size, split_method);
+        nodes[node_index].offset = static_cast<uint32_t>(nodes.size());
+        this->buildNode(nodes, first_primitive + left_count, primitive_count - left_count, depth + 1,
+                        primitive_bounds, max_leaf_size, split_method);
+    }
+
+    size_t BoundingVolumeHierarchy::partitionBySurfaceArea(const size_t first_primitive,
+                                                           const size_t primitive_count,
+                                                           const size_t split_axis,
+                                                           const double centroid_min,
+                                                           const double centroid_extent,
+                                                           const BoundingBox& node_bounds,
+                                                           const std::vector<BoundingBox>& primitive_bounds,
+                                                           const size_t max_leaf_size)
+    {
+        // Splits cannot be ranked if the primitives share a centroid or the node has no area to compare against
+        const double node_area{ getBoundingBoxSurfaceArea(node_bounds) };
+        if (!(centroid_extent > 0) || !(node_area > 0))
+            return 0;
+
+        const auto get_bucket_index{ [&](const uint32_t primitive_index) {
+            const double centroid{ getCentroidAlongAxis(primitive_bounds[primitive_index], split_axis) };
+            const double relative_offset{ std::max(0.0, (centroid - centroid_min) / centroid_extent) };
+            const auto bucket_index{ static_cast<size_t>(SAH_BUCKET_COUNT * relative_offset) };
+            return std::min(bucket_index, SAH_BUCKET_COUNT - 1);
+        } };
+
+        // Bin the primitives into equal-width buckets along the split axis by their centroids
+        struct Bucket {
+            size_t primitive_count{ 0 };
+            BoundingBox bounds{ };
+        };
+        std::array<Bucket, SAH_BUCKET_COUNT> buckets{ };
+        const auto primitives_begin{ m_primitive_indices.begin() + static_cast<std::ptrdiff_t>(first_primitive) };
+        const auto primitives_end{ primitives_begin + static_cast<std::ptrdiff_t>(primitive_count) };
+        for (auto it = primitives_begin; it != primitives_end; ++it) {
+            Bucket& bucket{ buckets[get_bucket_index(*it)] };
+            ++bucket.primitive_count;
+            bucket.bounds.mergeWithBox(primitive_bounds[*it]);
+        }
+
+        // Sweep from the right to find the size and area of every possible right child
+        std::array<double, SAH_BUCKET_COUNT> right_area_costs{ };
+        BoundingBox right_bounds{ };
+        size_t right_count{ 0 };
+        for (size_t i = SAH_BUCKET_COUNT - 1; i > 0; --i) {
+            if (buckets[i].primitive_count > 0) {
+                right_bounds.mergeWithBox(buckets[i].bounds);
+                right_count += buckets[i].primitive_count;
+            }
+            right_area_costs[i] = static_cast<double>(right_count) * getBoundingBoxSurfaceArea(right_bounds);
+        }
+
+        // Sweep from the left, evaluating the cost of splitting after each bucket
+        size_t best_split_bucket{ 0 };
+        double best_split_cost{ std::numeric_limits<double>::infinity() };
+        BoundingBox left_bounds{ };
+        size_t left_count{ 0 };
+        for (size_t i = 0; i < SAH_BUCKET_COUNT - 1; ++i) {
+            if (buckets[i].primitive_count > 0) {
+                left_bounds.mergeWithBox(buckets[i].bounds);
+                left_count += buckets[i].primitive_count;
+            }
+            if (left_count == 0 || left_count == primitive_count)
+                continue;
+
+            const double left_area_cost{ static_cast<double>(left_count) * getBoundingBoxSurfaceArea(left_bounds) };
+            const double split_cost{ SAH_TRAVERSAL_COST + (left_area_cost + right_area_costs[i + 1]) / node_area };
+            if (split_cost < best_split_cost) {
+                best_split_cost = split_cost;
+                best_split_bucket = i;
+            }
+        }
+
+        // Keep the primitives together if no split separates them or if testing them all is cheaper than splitting
+        const auto leaf_cost{ static_cast<double>(primitive_count) };
+        if (std::isinf(best_split_cost) || (primitive_count <= max_leaf_size && leaf_cost <= best_split_cost))
+            return 0;
+
+        const auto split_point{ std::partition(primitives_begin, primitives_end, [&](const uint32_t primitive_index) {
+            return get_bucket_index(primitive_index) <= best_split_bucket;
+        }) };
+        return static_cast<size_t>(std::distance(primitives_begin, split_point));
+    }
+
+    void BoundingVolumeHierarchy::buildWideNodes(const std::span<const Node> nodes)
+    {
+        m_wide_nodes.clear();
+        if (nodes.empty())
+            return;
+
+        // Every wide node but the root replaces at least two binary nodes
+        m_wide_nodes.reserve(nodes.size() / 2 + 1);
+        this->buildWideNode(nodes, 0);
+    }
+
+    uint32_t BoundingVolumeHierarchy::buildWideNode(const std::span<const Node> nodes, const uint32_t binary_node_index)
+    {
+        // Gather the binary nodes beneath this one, repeatedly opening the interior node with the largest surface
+        // area, which is the one most likely to be intersected, until the wide node is full or only leaves remain
+        std::array<uint32_t, WIDE_NODE_WIDTH> children{ };
+        size_t child_count{ 0 };
+        const Node& root{ nodes[binary_node_index] };
+        if (root.isLeaf()) {
+            children[child_count++] = binary_node_index;
+        } else {
+            children[child_count++] = binary_node_index + 1;
+            children[child_count++] = root.offset;
+        }
+
+        while (child_count < WIDE_NODE_WIDTH) {
+            size_t opened_child{ child_count };
+            double largest_area{ -1 };
+            for (size_t i = 0; i < child_count; ++i) {
+                const Node& child{ nodes[children[i]] };
+                const double area{ getBoundingBoxSurfaceArea(child.getBounds()) };
+                if (!child.isLeaf() && area > largest_area) {
+                    opened_child = i;
+                    largest_area = area;
+                }
+            }
+            if (opened_child == child_count)
+                break;
+
+            const uint32_t opened_node_index{ children[opened_child] };
+            children[opened_child] = opened_node_index + 1;
+            children[child_count++] = nodes[opened_node_index].offset;
+        }
+
+        // Fill the lanes, leaving empty boxes in those which are unused
+        const auto wide_node_index{ static_cast<uint32_t>(m_wide_nodes.size()) };
+        m_wide_nodes.emplace_back();
+        WideNode wide_node{ };
+        for (size_t row = 0; row < 3; ++row) {
+            wide_node.child_extents[row].fill(std::numeric_limits<float>::infinity());
+            wide_node.child_extents[row + 3].fill(-std::numeric_limits<float>::infinity());
+        }
+        wide_node.child_count = static_cast<uint8_t>(child_count);
+
+        for (size_t lane = 0; lane < child_count; ++lane) {
+            const Node& child{ nodes[children[lane]] };
+            for (size_t axis = 0; axis < 3; ++axis) {
+                wide_node.child_extents[axis][lane] = child.min_extents[axis];
+                wide_node.child_extents[axis + 3][lane] = child.max_extents[axis];
+            }
+
+            if (child.isLeaf()) {
+                wide_node.child_offsets[lane] = child.offset;
+                wide_node.child_primitive_counts[lane] = static_cast<uint16_t>(child.primitive_count);
+            } else {
+                wide_node.child_offsets[lane] = this->buildWideNode(nodes, children[lane]);
+            }
+        }
+
+        m_wide_nodes[wide_node_index] = wide_node;
+        return wide_node_index;
+    }
+
+    void BoundingVolumeHierarchy::setNodeBounds(Node& node, const BoundingBox& bounds)
+    {
+        // Round each extent outwards when narrowing it, so the node never clips the primitives it encloses
+        const auto round_down{ [](const double value) {
+            const auto narrowed{ static_cast<float>(value) };
+            return narrowed > value ? std::nextafter(narrowed, -std::numeric_limits<float>::infinity()) : narrowed;
+        } };
+        const auto round_up{ [](const double value) {
+            const auto narrowed{ static_cast<float>(value) };
+            return narrowed < value ? std::nextafter(narrowed, std::numeric_limits<float>::infinity()) : narrowed;
+        } };
+
+        node.min_extents = { round_down(bounds.getMinX()), round_down(bounds.getMinY()), round_down(bounds.getMinZ()) };
+        node.max_extents = { round_up(bounds.getMaxX()), round_up(bounds.getMaxY()), round_up(bounds.getMaxZ()) };
+    }
+
+    double BoundingVolumeHierarchy::getCentroidAlongAxis(const BoundingBox& box, const size_t axis)
+    {
+        switch (axis) {
+            case 0:
+                return (box.getMinX() + box.getMaxX()) / 2;
+            case 1:
+                return (box.getMinY() + box.getMaxY()) / 2;
+            default:
+                return (box.getMinZ() + box.getMaxZ()) / 2;
+        }
+    }
+
+    bool isFiniteBoundingBox(const BoundingBox& box)
+    {
+        return
+                std::isfinite(box.getMinX()) && std::isfinite(box.getMaxX()) &&
+                std::isfinite(box.getMinY()) && std::isfinite(box.getMaxY()) &&
+                std::isfinite(box.getMinZ()) && std::isfinite(box.getMaxZ());
+    }
+
+    Vector4 getBoundingBoxCentroid(const BoundingBox& box)
+    {
+        return createPoint((box.getMinX() + box.getMaxX()) / 2,
+                           (box.getMinY() + box.getMaxY()) / 2,
+                           (box.getMinZ() + box.getMaxZ()) / 2);
+    }
+
+    double getBoundingBoxSurfaceArea(const BoundingBox& box)
+    {
+        const double width{ box.getMaxX() - box.getMinX() };
+        const double height{ box.getMaxY() - box.getMinY() };
+        const double depth{ box.getMaxZ() - box.getMinZ() };
+        if (width < 0 || height < 0 || depth < 0)
+            return 0;
+
+        return 2 * (width * height + width * depth + height * depth);
+    }
+}
\ No newline at end of file
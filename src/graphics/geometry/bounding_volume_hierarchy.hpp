@@ -0,0 +1,522 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "bounding_box.hpp"
+#include "ray.hpp"
+#include "ray_packet.hpp"
+#include "render_statistics.hpp"
+#include "simd_kernels.hpp"
+
+namespace gfx {
+    // Default maximum number of primitives stored in a single leaf of the hierarchy
+    constexpr size_t DEFAULT_BVH_MAX_LEAF_SIZE{ 4 };
+
+    // Strategies for choosing where to partition the primitives at each interior node of the hierarchy
+    enum class BvhSplitMethod {
+        Median,               // Splits the primitives into equal halves along the axis of greatest centroid spread
+        SurfaceAreaHeuristic  // Chooses the split minimizing the expected ray traversal cost, estimated by box area
+    };
+
+    // A tree of bounding boxes over a list of primitives, used to cull primitives which cannot be intersected by a
+    // ray. The hierarchy only stores indices into the primitive list it was built from, so the owner of the
+    // primitives is responsible for keeping that list in the same order for the lifetime of the hierarchy. A
+    // hierarchy may either be built in memory or reference nodes stored elsewhere, such as in a memory-mapped file.
+    // It is built as a binary tree, which is collapsed into the wide tree that rays traverse and then discarded, so
+    // only the wide nodes are held in memory or stored externally.
+    class BoundingVolumeHierarchy
+    {
+    public:
+        /* Helper Types */
+
+        // Number of children of each node in the wide hierarchy, matching the number of boxes the box kernel tests
+        // at once: eight when built for AVX2 and four otherwise
+        static constexpr size_t WIDE_NODE_WIDTH{ simd::BOX_KERNEL_WIDTH };
+
+        // A node of the wide hierarchy that rays traverse, collapsed from the binary tree so that the boxes of all of
+        // its children are tested in a single pass. The child bounds are stored as six rows holding one extent of
+        // each child, in the order min x, y, z and max x, y, z. Unused lanes hold empty boxes, which no ray hits.
+        struct alignas(64) WideNode {
+            std::array<std::array<float, WIDE_NODE_WIDTH>, 6> child_extents{ };
+            std::array<uint32_t, WIDE_NODE_WIDTH> child_offsets{ };           // Wide node or first primitive index
+            std::array<uint16_t, WIDE_NODE_WIDTH> child_primitive_counts{ };  // Zero for wide node children
+            uint8_t child_count{ 0 };
+        };
+
+        /* Constructors */
+
+        // Default Constructor (Empty Hierarchy)
+        BoundingVolumeHierarchy() = default;
+
+        // Standard Constructor
+        explicit BoundingVolumeHierarchy(const std::vector<BoundingBox>& primitive_bounds,
+                                         size_t max_leaf_size = DEFAULT_BVH_MAX_LEAF_SIZE,
+                                         BvhSplitMethod split_method = BvhSplitMethod::Median);
+
+        // External Storage Constructor, referencing the wide nodes of a previously built hierarchy without copying
+        // them. The storage pointer keeps the memory holding the nodes and primitive indices alive for the lifetime
+        // of the hierarchy.
+        BoundingVolumeHierarchy(std::span<const WideNode> wide_nodes,
+                                std::span<const uint32_t> primitive_indices,
+                                std::shared_ptr<const void> storage);
+
+        // Copy Constructor
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy& other);
+
+        // Move Constructor
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) = default;
+
+        /* Destructor */
+
+        ~BoundingVolumeHierarchy() = default;
+
+        /* Assignment Operators */
+
+        BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy& other);
+        BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) = default;
+
+        /* Accessors */
+
+        [[nodiscard]] bool isEmpty() const
+        { return m_wide_node_view.empty(); }
+
+        // Returns the number of wide nodes
+        [[nodiscard]] size_t getNodeCount() const
+        { return m_wide_node_view.size(); }
+
+        [[nodiscard]] size_t getPrimitiveCount() const
+        { return m_primitive_index_view.size(); }
+
+        // Returns the primitive indices in leaf order, such that each leaf references a contiguous range of the list
+        [[nodiscard]] std::span<const uint32_t> getPrimitiveIndices() const
+        { return m_primitive_index_view; }
+
+        // Returns the nodes of the wide hierarchy that rays traverse, in depth-first order starting from the root
+        [[nodiscard]] std::span<const WideNode> getWideNodes() const
+        { return m_wide_node_view; }
+
+        // Returns the bounding box enclosing every primitive in the hierarchy
+        [[nodiscard]] BoundingBox getBounds() const;
+
+        /* Traversal Operations */
+
+        // Calls the passed-in visitor with the index of every primitive contained by a leaf whose bounding box is
+        // intersected by the ray, including boxes which lie behind the ray origin
+        template<typename PrimitiveVisitor>
+        void forEachCandidate(const Ray& ray, PrimitiveVisitor&& visit_primitive) const
+        {
+            constexpr double unbounded_t_max{ std::numeric_limits<double>::infinity() };
+            this->forEachCandidate(ray, -unbounded_t_max, unbounded_t_max, visit_primitive);
+        }
+
+        // Calls the passed-in visitor with the index of every primitive contained by a leaf whose bounding box is
+        // intersected by the ray within the interval [t_min, t_max]. The upper bound is re-read before each node is
+        // visited, so a visitor searching for the closest intersection may shrink it as hits are found. Nearer
+        // children are visited first, so the bound shrinks as early as possible.
+        template<typename PrimitiveVisitor>
+        void forEachCandidate(const Ray& ray,
+                              const double t_min,
+                              const double& t_max,
+                              PrimitiveVisitor&& visit_primitive) const
+        {
+            this->forEachCandidateLeaf(ray, t_min, t_max, [&](const uint32_t first, const uint32_t count) {
+                for (uint32_t i = first; i < first + count; ++i) {
+                    visit_primitive(m_primitive_index_view[i]);
+                }
+            });
+        }
+
+        // Calls the passed-in visitor with the position of the first primitive index and the number of primitives
+        // held by each leaf whose bounding box is intersected by the ray within the interval [t_min, t_max], so that
+        // a caller storing its primitives in the order of the index list may test each leaf as a contiguous batch.
+        // As for single primitives, the upper bound may be shrunk by the visitor.
+        template<typename LeafVisitor>
+        void forEachCandidateLeaf(const Ray& ray,
+                                  const double t_min,
+                                  const double& t_max,
+                                  LeafVisitor&& visit_leaf) const
+        {
+            this->traverseLeaves(ray, t_min, t_max, [&](const uint32_t first, const uint32_t count) {
+                visit_leaf(first, count);
+                return false;
+            });
+        }
+
+        // Calls the passed-in predicate with the index of each primitive contained by a leaf whose bounding box is
+        // intersected by the ray within the interval [t_min, t_max], stopping as soon as the predicate returns true.
+        // Returns true if the predicate was satisfied by any primitive.
+        template<typename PrimitivePredicate>
+        [[nodiscard]] bool anyOfCandidates(const Ray& ray,
+                                           const double t_min,
+                                           const double t_max,
+                                           PrimitivePredicate&& predicate) const
+        {
+            return this->traverseLeaves(ray, t_min, t_max, [&](const uint32_t first, const uint32_t count) {
+                for (uint32_t i = first; i < first + count; ++i) {
+                    if (predicate(m_primitive_index_view[i]))
+                        return true;
+                }
+                return false;
+            });
+        }
+
+        // Calls the passed-in predicate with the range of the primitive index list held by each leaf whose bounding
+        // box is intersected by the ray within the interval [t_min, t_max], stopping as soon as the predicate
+        // returns true. Returns true if the predicate was satisfied by any leaf.
+        template<typename LeafPredicate>
+        [[nodiscard]] bool anyOfCandidateLeaves(const Ray& ray,
+                                                const double t_min,
+                                                const double t_max,
+                                                LeafPredicate&& predicate) const
+        {
+            return this->traverseLeaves(ray, t_min, t_max, predicate);
+        }
+
+        // Calls the passed-in visitor with the index of every primitive contained by a leaf whose bounding box is
+        // intersected by any ray of the packet within its interval [t_min, t_maxes[i]], along with a mask of the
+        // rays which intersect the leaf. As for a single ray, the upper bounds are re-read before each node is
+        // visited so that a visitor searching for the closest intersections may shrink them as hits are found.
+        template<typename PacketPrimitiveVisitor>
+        void forEachCandidate(const RayPacket& packet,
+                              const double t_min,
+                              const std::array<double, MAX_RAY_PACKET_SIZE>& t_maxes,
+                              PacketPrimitiveVisitor&& visit_primitive) const
+        {
+            this->forEachCandidateLeaf(packet, t_min, t_maxes,
+                                       [&](const uint32_t first, const uint32_t count, const uint32_t ray_mask) {
+                for (uint32_t i = first; i < first + count; ++i) {
+                    visit_primitive(m_primitive_index_view[i], ray_mask);
+                }
+            });
+        }
+
+        // Calls the passed-in visitor with the range of the primitive index list held by each leaf whose bounding
+        // box is intersected by any ray of the packet, along with a mask of the rays which intersect the leaf
+        template<typename PacketLeafVisitor>
+        void forEachCandidateLeaf(const RayPacket& packet,
+                                  const double t_min,
+                                  const std::array<double, MAX_RAY_PACKET_SIZE>& t_maxes,
+                                  PacketLeafVisitor&& visit_leaf) const
+        {
+            if (m_wide_node_view.empty() || packet.isEmpty())
+                return;
+
+            // The rays are tested against each box in groups as wide as the box kernel, skipping groups without any
+            // ray still active in the subtree
+            constexpr size_t group_width{ simd::BOX_KERNEL_WIDTH };
+            constexpr uint32_t group_mask{ (1u << group_width) - 1 };
+            const size_t group_count{ (packet.size() + group_width - 1) / group_width };
+
+            std::array<float, MAX_RAY_PACKET_SIZE> interval_mins;
+            std::array<float, MAX_RAY_PACKET_SIZE> interval_maxes;
+            interval_mins.fill(static_cast<float>(t_min));
+            interval_maxes.fill(-std::numeric_limits<float>::infinity());
+
+            std::array<PacketTraversalEntry, TRAVERSAL_STACK_SIZE> stack;
+            size_t stack_size{ 0 };
+            stack[stack_size++] = PacketTraversalEntry{ 0, 0, packet.getRayMask(), interval_mins.front() };
+            while (stack_size > 0) {
+                const PacketTraversalEntry entry{ stack[--stack_size] };
+
+                // Skip children which every ray enters beyond an upper bound that has shrunk since they were deferred
+                float farthest_interval_max{ -std::numeric_limits<float>::infinity() };
+                for (uint32_t ray_mask = entry.ray_mask; ray_mask != 0; ray_mask &= ray_mask - 1) {
+                    const auto ray_index{ static_cast<size_t>(std::countr_zero(ray_mask)) };
+                    interval_maxes[ray_index] = static_cast<float>(t_maxes[ray_index]);
+                    farthest_interval_max = std::max(farthest_interval_max, interval_maxes[ray_index]);
+                }
+                if (entry.entry_t > farthest_interval_max +
+                                    simd::BOX_TEST_TOLERANCE * (1.0f + std::fabs(farthest_interval_max)))
+                    continue;
+
+                if (entry.primitive_count > 0) {
+                    visit_leaf(entry.offset, entry.primitive_count, entry.ray_mask);
+                    continue;
+                }
+
+                // Rays which left the subtree hold an empty interval, so the kernel never reports them as hits
+                for (uint32_t ray_mask = packet.getRayMask() & ~entry.ray_mask; ray_mask != 0;
+                     ray_mask &= ray_mask - 1) {
+                    interval_maxes[std::countr_zero(ray_mask)] = -std::numeric_limits<float>::infinity();
+                }
+
+                const WideNode& node{ m_wide_node_view[entry.offset] };
+                RenderStatisticsCollector::recordBvhNodeVisit();
+                const size_t first_deferred{ stack_size };
+                for (size_t lane = 0; lane < node.child_count; ++lane) {
+                    std::array<float, 6> child_extents;
+                    for (size_t row = 0; row < 6; ++row) {
+                        child_extents[row] = node.child_extents[row][lane];
+                    }
+
+                    uint32_t child_ray_mask{ 0 };
+                    float child_entry_t{ std::numeric_limits<float>::infinity() };
+                    for (size_t group = 0; group < group_count; ++group) {
+                        const size_t first_ray{ group * group_width };
+                        if (((entry.ray_mask >> first_ray) & group_mask) == 0)
+                            continue;
+
+                        RenderStatisticsCollector::recordBoundingBoxTest();
+                        std::array<float, group_width> entry_ts;
+                        unsigned hit_mask{ simd::intersectRaysWithBox(child_extents.data(),
+                                                                      packet.getOrigins() + first_ray,
+                                                                      packet.getInverseDirections() + first_ray,
+                                                                      packet.getNegativeDirectionMasks() + first_ray,
+                                                                      MAX_RAY_PACKET_SIZE,
+                                                                      interval_mins.data() + first_ray,
+                                                                      interval_maxes.data() + first_ray,
+                                                                      entry_ts.data()) };
+                        hit_mask &= entry.ray_mask >> first_ray;
+                        child_ray_mask |= hit_mask << first_ray;
+                        for (; hit_mask != 0; hit_mask &= hit_mask - 1) {
+                            child_entry_t = std::min(child_entry_t, entry_ts[std::countr_zero(hit_mask)]);
+                        }
+                    }
+                    if (child_ray_mask == 0)
+                        continue;
+
+                    // Defer the intersected children sorted so that the nearest entry of any ray is on top
+                    const PacketTraversalEntry child{ node.child_offsets[lane],
+                                                      node.child_primitive_counts[lane],
+                                                      child_ray_mask,
+                                                      child_entry_t };
+                    size_t position{ stack_size++ };
+                    while (position > first_deferred && stack[position - 1].entry_t < child.entry_t) {
+                        stack[position] = stack[position - 1];
+                        --position;
+                    }
+                    stack[position] = child;
+                }
+            }
+        }
+
+    private:
+        /* Constants */
+
+        // Median splits keep the depth of the tree below log2 of the primitive count, so this comfortably covers
+        // any primitive count that fits in the 32-bit indices. Externally stored hierarchies any deeper are rejected.
+        static constexpr size_t MAX_TRAVERSAL_DEPTH{ 64 };
+
+        // Each wide node lies at least one level below its parent in the binary tree and defers at most one child
+        // fewer than its width, which bounds the number of entries on the traversal stack
+        static constexpr size_t TRAVERSAL_STACK_SIZE{ MAX_TRAVERSAL_DEPTH * (WIDE_NODE_WIDTH - 1) + 1 };
+
+        // Surface area heuristic splits may produce unbalanced trees, so nodes below this depth fall back to median
+        // splits to keep the total depth within the traversal stack
+        static constexpr size_t MAX_SAH_BUILD_DEPTH{ 24 };
+
+        // Number of buckets the centroid range is divided into when evaluating candidate surface area heuristic splits
+        static constexpr size_t SAH_BUCKET_COUNT{ 12 };
+
+        // Estimated cost of visiting an interior node, relative to the cost of testing a ray against one primitive
+        static constexpr double SAH_TRAVERSAL_COST{ 0.125 };
+
+        /* Data Members */
+
+        std::vector<uint32_t> m_primitive_indices{ };
+        std::vector<WideNode> m_wide_nodes{ };              // Nodes of a hierarchy built in memory
+        std::span<const uint32_t> m_primitive_index_view{ };
+        std::span<const WideNode> m_wide_node_view{ };      // Nodes used for traversal, wherever they are stored
+        std::shared_ptr<const void> m_storage{ };           // Owner of externally stored nodes, null if built
+
+        /* Helper Types */
+
+        // A node of the binary tree built before it is collapsed into wide nodes. The bounds are stored in single
+        // precision, rounded outwards so that every node still encloses the primitives beneath it.
+        struct alignas(32) Node {
+            std::array<float, 3> min_extents{ std::numeric_limits<float>::infinity(),
+                                              std::numeric_limits<float>::infinity(),
+                                              std::numeric_limits<float>::infinity() };
+            std::array<float, 3> max_extents{ -std::numeric_limits<float>::infinity(),
+                                              -std::numeric_limits<float>::infinity(),
+                                              -std::numeric_limits<float>::infinity() };
+            uint32_t offset{ 0 };             // Index of the second child (interior) or first primitive index (leaf)
+            uint32_t primitive_count{ 0 };    // Number of primitives in a leaf, zero for interior nodes
+
+            [[nodiscard]] bool isLeaf() const
+            { return primitive_count > 0; }
+
+            // Returns the bounds of the node in double precision
+            [[nodiscard]] BoundingBox getBounds() const
+            {
+                return BoundingBox{ min_extents[0], min_extents[1], min_extents[2],
+                                    max_extents[0], max_extents[1], max_extents[2] };
+            }
+        };
+
+        // A ray prepared for testing against many wide nodes, with its direction inverted once rather than at each
+        // node and the rows of the extents it enters and exits each slab through chosen by the sign of its direction
+        struct TraversalRay {
+            std::array<float, 3> origin{ };
+            std::array<float, 3> inverse_direction{ };
+            std::array<size_t, 3> near_rows{ };
+            std::array<size_t, 3> far_rows{ };
+
+            explicit TraversalRay(const Ray& ray)
+                    : origin{ static_cast<float>(ray.getOrigin().x()),
+                              static_cast<float>(ray.getOrigin().y()),
+                              static_cast<float>(ray.getOrigin().z()) },
+                      inverse_direction{ static_cast<float>(1.0 / ray.getDirection().x()),
+                                         static_cast<float>(1.0 / ray.getDirection().y()),
+                                         static_cast<float>(1.0 / ray.getDirection().z()) }
+            {
+                const std::array<bool, 3> is_direction_negative{ std::signbit(ray.getDirection().x()),
+                                                                 std::signbit(ray.getDirection().y()),
+                                                                 std::signbit(ray.getDirection().z()) };
+                for (size_t axis = 0; axis < 3; ++axis) {
+                    near_rows[axis] = is_direction_negative[axis] ? axis + 3 : axis;
+                    far_rows[axis] = is_direction_negative[axis] ? axis : axis + 3;
+                }
+            }
+        };
+
+        // A deferred child of a wide node, which is either another wide node or a range of primitives. Left without
+        // member initializers so that the traversal stack is not cleared before every query.
+        struct TraversalEntry {
+            uint32_t offset;            // Index of the wide node, or of the first primitive index
+            uint16_t primitive_count;   // Zero for a wide node
+            float entry_t;              // Distance along the ray at which it enters the child's bounding box
+        };
+
+        // A deferred child of a wide node visited by a packet, along with the rays of the packet which intersect it
+        struct PacketTraversalEntry {
+            uint32_t offset;            // Index of the wide node, or of the first primitive index
+            uint16_t primitive_count;   // Zero for a wide node
+            uint32_t ray_mask;          // Bit i is set if ray i of the packet intersects the child
+            float entry_t;              // Nearest distance at which any of the rays enters the child's bounding box
+        };
+
+        /* Helper Methods */
+
+        // Walks the wide tree with an explicit stack, calling the passed-in predicate with the range of the primitive
+        // index list held by each leaf whose bounding box is intersected by the ray within [t_min, t_max] and
+        // stopping once the predicate returns true. The children of each wide node are tested in a single pass of
+        // the box kernel, and those intersected are visited in order of the distance at which the ray enters them.
+        template<typename LeafPredicate>
+        bool traverseLeaves(const Ray& ray, const double t_min, const double& t_max, LeafPredicate&& predicate) const
+        {
+            if (m_wide_node_view.empty())
+                return false;
+
+            const TraversalRay traversal_ray{ ray };
+            const auto interval_min{ static_cast<float>(t_min) };
+            std::array<TraversalEntry, TRAVERSAL_STACK_SIZE> stack;
+            size_t stack_size{ 0 };
+            stack[stack_size++] = TraversalEntry{ 0, 0, interval_min };
+            while (stack_size > 0) {
+                const TraversalEntry entry{ stack[--stack_size] };
+
+                // Skip children which the ray enters beyond an upper bound that has shrunk since they were deferred
+                const auto interval_max{ static_cast<float>(t_max) };
+                if (entry.entry_t > interval_max + simd::BOX_TEST_TOLERANCE * (1.0f + std::fabs(interval_max)))
+                    continue;
+
+                if (entry.primitive_count > 0) {
+                    if (predicate(entry.offset, entry.primitive_count))
+                        return true;
+                    continue;
+                }
+
+                const WideNode& node{ m_wide_node_view[entry.offset] };
+                RenderStatisticsCollector::recordBvhNodeVisit();
+                for (size_t lane = 0; lane < node.child_count; ++lane) {
+                    RenderStatisticsCollector::recordBoundingBoxTest();
+                }
+
+                std::array<float, WIDE_NODE_WIDTH> entry_ts;
+                unsigned hit_mask{ simd::intersectBoxes(node.child_extents.front().data(),
+                                                        traversal_ray.near_rows.data(),
+                                                        traversal_ray.far_rows.data(),
+                                                        traversal_ray.origin.data(),
+                                                        traversal_ray.inverse_direction.data(),
+                                                        interval_min,
+                                                        interval_max,
+                                                        entry_ts.data()) };
+
+                // Defer the intersected children sorted so that the nearest is on top of the stack
+                const size_t first_deferred{ stack_size };
+                while (hit_mask != 0) {
+                    const auto lane{ static_cast<size_t>(std::countr_zero(hit_mask)) };
+                    hit_mask &= hit_mask - 1;
+
+                    const TraversalEntry child{ node.child_offsets[lane],
+                                                node.child_primitive_counts[lane],
+                                                entry_ts[lane] };
+                    size_t position{ stack_size++ };
+                    while (position > first_deferred && stack[position - 1].entry_t < child.entry_t) {
+                        stack[position] = stack[position - 1];
+                        --position;
+                    }
+                    stack[position] = child;
+                }
+            }
+
+            return false;
+        }
+
+        // Points the traversal views at the nodes and primitive indices owned by this hierarchy
+        void bindOwnedStorage();
+
+        // Throws if any wide node references a node or primitive outside of the hierarchy, or holds an unused lane
+        // which a ray could hit, checking externally stored nodes before they are traversed
+        void validateWideNodes() const;
+
+        // Recursively builds the binary subtree for a range of the primitive index list, appending its nodes in
+        // depth-first order, such that the first child of each interior node immediately follows it and the second
+        // child is found at the node's offset
+        void buildNode(std::vector<Node>& nodes,
+                       size_t first_primitive,
+                       size_t primitive_count,
+                       size_t depth,
+                       const std::vector<BoundingBox>& primitive_bounds,
+                       size_t max_leaf_size,
+                       BvhSplitMethod split_method);
+
+        // Collapses the binary nodes into the wide nodes used for traversal
+        void buildWideNodes(std::span<const Node> nodes);
+
+        // Recursively collapses the subtree rooted at a binary node into wide nodes, appending them in depth-first
+        // order and returning the index of the wide node for the subtree
+        uint32_t buildWideNode(std::span<const Node> nodes, uint32_t binary_node_index);
+
+        // Stores a bounding box in the single-precision extents of a node
+        static void setNodeBounds(Node& node, const BoundingBox& bounds);
+
+        // Returns the coordinate of a bounding box's centroid along the x (0), y (1), or z (2) axis
+        [[nodiscard]] static double getCentroidAlongAxis(const BoundingBox& box, size_t axis);
+
+        // Partitions a range of the primitive index list using the surface area heuristic, returning the number of
+        // primitives placed in the left child, or zero if storing the range in a single leaf is cheaper
+        [[nodiscard]] size_t partitionBySurfaceArea(size_t first_primitive,
+                                                    size_t primitive_count,
+                                                    size_t split_axis,
+                                                    double centroid_min,
+                                                    double centroid_extent,
+                                                    const BoundingBox& node_bounds,
+                                                    const std::vector<BoundingBox>& primitive_bounds,
+                                                    size_t max_leaf_size);
+    };
+
+    // Wide nodes are stored and reloaded as raw bytes, so they must be copyable without running any constructors
+    static_assert(std::is_trivially_copyable_v<BoundingVolumeHierarchy::WideNode>);
+
+    /* Global Bounding Volume Operations */
+
+    // Returns true if every extent of a bounding box is a finite value
+    [[nodiscard]] bool isFiniteBoundingBox(const BoundingBox& box);
+
+    // Returns the center point of a bounding box
+    [[nodiscard]] Vector4 getBoundingBoxCentroid(const BoundingBox& box);
+
+    // Returns the total area of the six faces of a bounding box, or zero for an empty box
+    [[nodiscard]] double getBoundingBoxSurfaceArea(const BoundingBox& box);
+}
@@ -0,0 +1,541 @@
+#include "gtest/gtest.h"
+#include "bounding_volume_hierarchy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "ray.hpp"
+#include "ray_packet.hpp"
+#include "simd_kernels.hpp"
+
+// Returns a list of unit boxes spaced two units apart along the x-axis
+static std::vector<gfx::BoundingBox> createBoxRow(const size_t box_count)
+{
+    std::vector<gfx::BoundingBox> boxes{ };
+    for (size_t i = 0; i < box_count; ++i) {
+        const double x{ 2.0 * static_cast<double>(i) };
+        boxes.emplace_back(x, 0, 0, x + 1, 1, 1);
+    }
+    return boxes;
+}
+
+// Returns the bounding box held by a lane of a wide node
+static gfx::BoundingBox getLaneBounds(const gfx::BoundingVolumeHierarchy::WideNode& node, const size_t lane)
+{
+    return gfx::BoundingBox{ node.child_extents[0][lane], node.child_extents[1][lane], node.child_extents[2][lane],
+                             node.child_extents[3][lane], node.child_extents[4][lane], node.child_extents[5][lane] };
+}
+
+// Tests the default constructor
+TEST(GraphicsBoundingVolumeHierarchy, DefaultConstructor)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ };
+
+    EXPECT_TRUE(bvh.isEmpty());
+    EXPECT_EQ(bvh.getNodeCount(), 0);
+    EXPECT_EQ(bvh.getPrimitiveCount(), 0);
+}
+
+// Tests the standard constructor
+TEST(GraphicsBoundingVolumeHierarchy, StandardConstructor)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(10), 2 };
+
+    const gfx::BoundingBox bounds_expected{ 0, 0, 0, 19, 1, 1 };
+
+    EXPECT_FALSE(bvh.isEmpty());
+    EXPECT_EQ(bvh.getPrimitiveCount(), 10);
+    EXPECT_EQ(bvh.getBounds(), bounds_expected);
+
+    // Every primitive should appear exactly once in the leaf-ordered index list
+    std::vector<uint32_t> primitive_indices{ bvh.getPrimitiveIndices().begin(), bvh.getPrimitiveIndices().end() };
+    std::sort(primitive_indices.begin(), primitive_indices.end());
+    for (uint32_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(primitive_indices[i], i);
+    }
+
+    // Leaves must not exceed the maximum leaf size and every child must be contained by its parent
+    const std::span<const gfx::BoundingVolumeHierarchy::WideNode> wide_nodes{ bvh.getWideNodes() };
+    for (const gfx::BoundingVolumeHierarchy::WideNode& node : wide_nodes) {
+        for (size_t lane = 0; lane < node.child_count; ++lane) {
+            if (node.child_primitive_counts[lane] > 0) {
+                EXPECT_LE(node.child_primitive_counts[lane], 2);
+                continue;
+            }
+
+            const gfx::BoundingVolumeHierarchy::WideNode& child{ wide_nodes[node.child_offsets[lane]] };
+            for (size_t child_lane = 0; child_lane < child.child_count; ++child_lane) {
+                EXPECT_TRUE(getLaneBounds(node, lane).containsBox(getLaneBounds(child, child_lane)));
+            }
+        }
+    }
+}
+
+// Tests building the hierarchy using the surface area heuristic
+TEST(GraphicsBoundingVolumeHierarchy, SurfaceAreaHeuristicConstructor)
+{
+    // Two distant clusters of boxes, which the first split should separate
+    std::vector<gfx::BoundingBox> boxes{ createBoxRow(8) };
+    for (size_t i = 0; i < 8; ++i) {
+        const double x{ 100.0 + 2.0 * static_cast<double>(i) };
+        boxes.emplace_back(x, 0, 0, x + 1, 1, 1);
+    }
+    const gfx::BoundingVolumeHierarchy bvh{ boxes, 2, gfx::BvhSplitMethod::SurfaceAreaHeuristic };
+
+    const gfx::BoundingBox left_bounds_expected{ 0, 0, 0, 15, 1, 1 };
+    const gfx::BoundingBox right_bounds_expected{ 100, 0, 0, 115, 1, 1 };
+
+    // Every child of the root lies within a single cluster, and together they cover both
+    EXPECT_EQ(bvh.getPrimitiveCount(), 16);
+    const gfx::BoundingVolumeHierarchy::WideNode& root{ bvh.getWideNodes().front() };
+    gfx::BoundingBox left_bounds_actual{ };
+    gfx::BoundingBox right_bounds_actual{ };
+    for (size_t lane = 0; lane < root.child_count; ++lane) {
+        const gfx::BoundingBox lane_bounds{ getLaneBounds(root, lane) };
+        ASSERT_TRUE(left_bounds_expected.containsBox(lane_bounds) || right_bounds_expected.containsBox(lane_bounds));
+        if (left_bounds_expected.containsBox(lane_bounds)) {
+            left_bounds_actual.mergeWithBox(lane_bounds);
+        } else {
+            right_bounds_actual.mergeWithBox(lane_bounds);
+        }
+    }
+    EXPECT_EQ(left_bounds_actual, left_bounds_expected);
+    EXPECT_EQ(right_bounds_actual, right_bounds_expected);
+
+    // Traversal visits only the primitives along the ray
+    const gfx::Ray ray{ 104.5, 0.5, -5, 0, 0, 1 };
+    std::vector<uint32_t> candidates{ };
+    bvh.forEachCandidate(ray, [&](const uint32_t primitive_index) { candidates.push_back(primitive_index); });
+    EXPECT_NE(std::find(candidates.begin(), candidates.end(), 10), candidates.end());
+    EXPECT_LE(candidates.size(), 2);
+}
+
+// Tests that the standard constructor throws an exception for a maximum leaf size which a node cannot store
+TEST(GraphicsBoundingVolumeHierarchy, StandardConstructorInvalidLeafSize)
+{
+    EXPECT_THROW(gfx::BoundingVolumeHierarchy(createBoxRow(4), 0), std::invalid_argument);
+    EXPECT_THROW(gfx::BoundingVolumeHierarchy(createBoxRow(4), 65536), std::invalid_argument);
+}
+
+// Tests that node bounds which are not representable in single precision are rounded outwards
+TEST(GraphicsBoundingVolumeHierarchy, NodeBoundsRounding)
+{
+    const gfx::BoundingBox box{ 0.1, -0.1, 1.0 / 3, 0.2, 0.3, 2.0 / 3 };
+    const gfx::BoundingVolumeHierarchy bvh{ std::vector<gfx::BoundingBox>{ box } };
+
+    ASSERT_EQ(bvh.getNodeCount(), 1);
+    const gfx::BoundingBox node_bounds{ bvh.getBounds() };
+    EXPECT_LE(node_bounds.getMinX(), box.getMinX());
+    EXPECT_LE(node_bounds.getMinY(), box.getMinY());
+    EXPECT_LE(node_bounds.getMinZ(), box.getMinZ());
+    EXPECT_GE(node_bounds.getMaxX(), box.getMaxX());
+    EXPECT_GE(node_bounds.getMaxY(), box.getMaxY());
+    EXPECT_GE(node_bounds.getMaxZ(), box.getMaxZ());
+}
+
+// Tests collapsing the binary tree into the wide tree traversed by rays
+TEST(GraphicsBoundingVolumeHierarchy, WideNodes)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(16), 1 };
+    const std::span<const gfx::BoundingVolumeHierarchy::WideNode> wide_nodes{ bvh.getWideNodes() };
+    constexpr size_t width{ gfx::BoundingVolumeHierarchy::WIDE_NODE_WIDTH };
+
+    // The wide tree replaces a binary tree of 31 nodes, which is not kept once collapsed
+    ASSERT_FALSE(wide_nodes.empty());
+    EXPECT_EQ(wide_nodes.size(), bvh.getNodeCount());
+    EXPECT_LT(wide_nodes.size(), 31);
+    EXPECT_EQ(wide_nodes.front().child_count, width);
+
+    // Every primitive should be referenced by exactly one leaf lane, and unused lanes should hold empty boxes
+    std::vector<uint32_t> leaf_primitive_indices{ };
+    for (const gfx::BoundingVolumeHierarchy::WideNode& wide_node : wide_nodes) {
+        EXPECT_GE(wide_node.child_count, 2);
+        EXPECT_LE(wide_node.child_count, width);
+        for (size_t lane = 0; lane < width; ++lane) {
+            if (lane >= wide_node.child_count) {
+                EXPECT_GT(wide_node.child_extents[0][lane], wide_node.child_extents[3][lane]);
+            } else if (wide_node.child_primitive_counts[lane] > 0) {
+                for (uint32_t i = 0; i < wide_node.child_primitive_counts[lane]; ++i) {
+                    leaf_primitive_indices.push_back(bvh.getPrimitiveIndices()[wide_node.child_offsets[lane] + i]);
+                }
+            } else {
+                EXPECT_LT(wide_node.child_offsets[lane], wide_nodes.size());
+            }
+        }
+    }
+    std::sort(leaf_primitive_indices.begin(), leaf_primitive_indices.end());
+    ASSERT_EQ(leaf_primitive_indices.size(), 16);
+    for (uint32_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(leaf_primitive_indices[i], i);
+    }
+}
+
+// Tests that copies of a hierarchy built in memory own their nodes
+TEST(GraphicsBoundingVolumeHierarchy, CopyConstructor)
+{
+    auto bvh{ std::make_unique<gfx::BoundingVolumeHierarchy>(createBoxRow(8), 1) };
+    const gfx::BoundingVolumeHierarchy bvh_copy{ *bvh };
+    const size_t node_count_expected{ bvh->getNodeCount() };
+    const gfx::BoundingBox bounds_expected{ bvh->getBounds() };
+    bvh.reset();
+
+    EXPECT_EQ(bvh_copy.getNodeCount(), node_count_expected);
+    EXPECT_EQ(bvh_copy.getBounds(), bounds_expected);
+
+    size_t candidate_count{ 0 };
+    bvh_copy.forEachCandidate(gfx::Ray{ -5, 0.5, 0.5, 1, 0, 0 }, [&](const uint32_t) { ++candidate_count; });
+    EXPECT_EQ(candidate_count, 8);
+}
+
+// Tests referencing the wide nodes of a hierarchy stored outside of the hierarchy
+TEST(GraphicsBoundingVolumeHierarchy, ExternalStorageConstructor)
+{
+    const auto bvh_built{ std::make_shared<const gfx::BoundingVolumeHierarchy>(createBoxRow(16), 1) };
+    const gfx::BoundingVolumeHierarchy bvh{ bvh_built->getWideNodes(), bvh_built->getPrimitiveIndices(), bvh_built };
+
+    EXPECT_EQ(bvh.getWideNodes().data(), bvh_built->getWideNodes().data());
+    EXPECT_EQ(bvh.getBounds(), bvh_built->getBounds());
+    EXPECT_EQ(bvh.getNodeCount(), bvh_built->getNodeCount());
+
+    std::vector<uint32_t> candidates{ };
+    bvh.forEachCandidate(gfx::Ray{ 6.5, 0.5, -5, 0, 0, 1 },
+                         [&](const uint32_t primitive_index) { candidates.push_back(primitive_index); });
+    ASSERT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates[0], 3);
+
+    // Test nodes without primitives, and nodes without an owner
+    EXPECT_THROW(gfx::BoundingVolumeHierarchy(bvh_built->getWideNodes(), { }, bvh_built), std::invalid_argument);
+    EXPECT_THROW(gfx::BoundingVolumeHierarchy(bvh_built->getWideNodes(), bvh_built->getPrimitiveIndices(), nullptr),
+                 std::invalid_argument);
+}
+
+// Tests that externally stored nodes referencing anything outside of the hierarchy are rejected
+TEST(GraphicsBoundingVolumeHierarchy, ExternalStorageConstructorInvalidNodes)
+{
+    using WideNode = gfx::BoundingVolumeHierarchy::WideNode;
+    constexpr size_t width{ gfx::BoundingVolumeHierarchy::WIDE_NODE_WIDTH };
+    const auto bvh_built{ std::make_shared<const gfx::BoundingVolumeHierarchy>(createBoxRow(64), 1) };
+    const std::span<const WideNode> nodes_built{ bvh_built->getWideNodes() };
+    const std::span<const uint32_t> primitive_indices_built{ bvh_built->getPrimitiveIndices() };
+    ASSERT_GT(nodes_built.size(), 2);
+    ASSERT_EQ(nodes_built[0].child_count, width);
+    ASSERT_EQ(nodes_built[0].child_primitive_counts[0], 0);
+    ASSERT_EQ(nodes_built[0].child_primitive_counts[1], 0);
+
+    // Returns true if a hierarchy referencing the modified nodes or primitive indices is rejected
+    const auto is_rejected{ [&](const auto& modify_nodes, const auto& modify_primitive_indices) {
+        std::vector<WideNode> nodes(nodes_built.begin(), nodes_built.end());
+        std::vector<uint32_t> primitive_indices(primitive_indices_built.begin(), primitive_indices_built.end());
+        modify_nodes(nodes);
+        modify_primitive_indices(primitive_indices);
+        try {
+            const gfx::BoundingVolumeHierarchy bvh{ nodes, primitive_indices, bvh_built };
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    } };
+    const auto keep_nodes{ [](std::vector<WideNode>&) {} };
+    const auto keep_primitive_indices{ [](std::vector<uint32_t>&) {} };
+
+    EXPECT_FALSE(is_rejected(keep_nodes, keep_primitive_indices));
+
+    // Test children outside of the hierarchy, before the node itself, or out of order with their siblings
+    EXPECT_TRUE(is_rejected([](auto& nodes) { nodes[0].child_offsets[1] = static_cast<uint32_t>(nodes.size()); },
+                            keep_primitive_indices));
+    EXPECT_TRUE(is_rejected([](auto& nodes) { nodes[0].child_offsets[0] = 0; }, keep_primitive_indices));
+    EXPECT_TRUE(is_rejected([](auto& nodes) { nodes[0].child_offsets[1] = 0x7fffffff; }, keep_primitive_indices));
+    EXPECT_TRUE(is_rejected([](auto& nodes) { std::swap(nodes[0].child_offsets[0], nodes[0].child_offsets[1]); },
+                            keep_primitive_indices));
+
+    // Test leaves referencing primitive indices past the end of the list
+    EXPECT_TRUE(is_rejected([](auto& nodes) {
+        nodes[0].child_offsets[0] = 63;
+        nodes[0].child_primitive_counts[0] = 2;
+    }, keep_primitive_indices));
+
+    // Test nodes without children or with more children than lanes, and unused lanes which a ray could hit
+    EXPECT_TRUE(is_rejected([](auto& nodes) { nodes[0].child_count = 0; }, keep_primitive_indices));
+    EXPECT_TRUE(is_rejected([](auto& nodes) { nodes[0].child_count = width + 1; }, keep_primitive_indices));
+    EXPECT_TRUE(is_rejected([](auto& nodes) {
+        nodes[0].child_count = 1;
+        nodes[0].child_offsets.fill(0);
+        nodes[0].child_primitive_counts.fill(0);
+        nodes[0].child_primitive_counts[0] = 1;
+    }, keep_primitive_indices));
+
+    // Test a primitive index which is out of range
+    EXPECT_TRUE(is_rejected(keep_nodes, [](auto& primitive_indices) { primitive_indices[3] = 64; }));
+}
+
+// Tests that externally stored hierarchies too deep for the traversal stack are rejected, using a chain of wide
+// nodes which each hold a leaf and the next node of the chain
+TEST(GraphicsBoundingVolumeHierarchy, ExternalStorageConstructorDeepChain)
+{
+    using WideNode = gfx::BoundingVolumeHierarchy::WideNode;
+    const auto create_chain{ [](const size_t length) {
+        std::vector<WideNode> nodes(length);
+        for (size_t i = 0; i < length; ++i) {
+            for (size_t row = 0; row < 3; ++row) {
+                nodes[i].child_extents[row].fill(std::numeric_limits<float>::infinity());
+                nodes[i].child_extents[row + 3].fill(-std::numeric_limits<float>::infinity());
+            }
+            nodes[i].child_count = i + 1 < length ? 2 : 1;
+            for (size_t lane = 0; lane < nodes[i].child_count; ++lane) {
+                for (size_t row = 0; row < 3; ++row) {
+                    nodes[i].child_extents[row][lane] = 0;
+                    nodes[i].child_extents[row + 3][lane] = 1;
+                }
+            }
+            nodes[i].child_primitive_counts[0] = 1;
+            nodes[i].child_offsets[1] = i + 1 < length ? static_cast<uint32_t>(i + 1) : 0;
+        }
+        return nodes;
+    } };
+    const std::vector<uint32_t> primitive_indices{ 0 };
+    const auto storage{ std::make_shared<const int>(0) };
+
+    const std::vector<WideNode> deepest_nodes{ create_chain(64) };
+    const gfx::BoundingVolumeHierarchy bvh{ deepest_nodes, primitive_indices, storage };
+    size_t candidate_count{ 0 };
+    bvh.forEachCandidate(gfx::Ray{ 0.5, 0.5, -5, 0, 0, 1 }, [&](const uint32_t) { ++candidate_count; });
+    EXPECT_EQ(candidate_count, 64);
+
+    const std::vector<WideNode> too_deep_nodes{ create_chain(65) };
+    EXPECT_THROW(gfx::BoundingVolumeHierarchy(too_deep_nodes, primitive_indices, storage), std::invalid_argument);
+    const std::vector<WideNode> far_too_deep_nodes{ create_chain(100000) };
+    EXPECT_THROW(gfx::BoundingVolumeHierarchy(far_too_deep_nodes, primitive_indices, storage), std::invalid_argument);
+}
+
+// Tests traversing the hierarchy with a ray which passes through a single primitive
+TEST(GraphicsBoundingVolumeHierarchy, ForEachCandidateSinglePrimitive)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(16), 1 };
+    const gfx::Ray ray{ 6.5, 0.5, -5, 0, 0, 1 };
+
+    std::vector<uint32_t> candidates{ };
+    bvh.forEachCandidate(ray, [&](const uint32_t primitive_index) { candidates.push_back(primitive_index); });
+
+    ASSERT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates[0], 3);
+}
+
+// Tests traversing the hierarchy with a ray which passes through every primitive
+TEST(GraphicsBoundingVolumeHierarchy, ForEachCandidateAllPrimitives)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(16) };
+    const gfx::Ray ray{ -5, 0.5, 0.5, 1, 0, 0 };
+
+    std::vector<uint32_t> candidates{ };
+    bvh.forEachCandidate(ray, [&](const uint32_t primitive_index) { candidates.push_back(primitive_index); });
+
+    EXPECT_EQ(candidates.size(), 16);
+}
+
+// Tests that traversal visits the children nearer to the ray origin first
+TEST(GraphicsBoundingVolumeHierarchy, ForEachCandidateFrontToBack)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(16), 1 };
+
+    std::vector<uint32_t> candidates{ };
+    bvh.forEachCandidate(gfx::Ray{ -5, 0.5, 0.5, 1, 0, 0 },
+                         [&](const uint32_t primitive_index) { candidates.push_back(primitive_index); });
+    ASSERT_EQ(candidates.size(), 16);
+    EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+
+    candidates.clear();
+    bvh.forEachCandidate(gfx::Ray{ 40, 0.5, 0.5, -1, 0, 0 },
+                         [&](const uint32_t primitive_index) { candidates.push_back(primitive_index); });
+    ASSERT_EQ(candidates.size(), 16);
+    EXPECT_TRUE(std::is_sorted(candidates.rbegin(), candidates.rend()));
+}
+
+// Tests that traversal skips children beyond an upper bound which shrinks as primitives are visited
+TEST(GraphicsBoundingVolumeHierarchy, ForEachCandidateShrinkingInterval)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(16), 1 };
+    const gfx::Ray ray{ -5, 0.5, 0.5, 1, 0, 0 };
+
+    double t_max{ std::numeric_limits<double>::infinity() };
+    std::vector<uint32_t> candidates{ };
+    bvh.forEachCandidate(ray, 0, t_max, [&](const uint32_t primitive_index) {
+        candidates.push_back(primitive_index);
+        t_max = 6;
+    });
+
+    ASSERT_FALSE(candidates.empty());
+    EXPECT_EQ(candidates.front(), 0);
+    EXPECT_LE(candidates.size(), 2);
+}
+
+// Tests that the box kernel selected at build time matches the scalar kernel, including for empty boxes and rays
+// parallel to an axis
+TEST(GraphicsBoundingVolumeHierarchy, BoxKernelMatchesScalar)
+{
+    constexpr size_t width{ gfx::simd::BOX_KERNEL_WIDTH };
+    std::array<std::array<float, width>, 6> extents{ };
+    for (size_t lane = 0; lane < width; ++lane) {
+        const auto x{ static_cast<float>(2 * lane) };
+        extents[0][lane] = x;
+        extents[1][lane] = lane % 2 == 0 ? 0.0f : 5.0f;
+        extents[2][lane] = 0;
+        extents[3][lane] = x + 1;
+        extents[4][lane] = lane % 2 == 0 ? 1.0f : 6.0f;
+        extents[5][lane] = 1;
+    }
+    extents[0][width - 1] = std::numeric_limits<float>::infinity();
+    extents[3][width - 1] = -std::numeric_limits<float>::infinity();
+
+    const std::array<gfx::Ray, 3> rays{ gfx::Ray{ -5, 0.5, 0.5, 1, 0, 0 },
+                                        gfx::Ray{ 20, 0.5, 0.5, -1, 0.01, 0 },
+                                        gfx::Ray{ 2.5, -5, 0.5, 0, 1, 0 } };
+    for (const gfx::Ray& ray : rays) {
+        const std::array<float, 3> origin{ static_cast<float>(ray.getOrigin().x()),
+                                           static_cast<float>(ray.getOrigin().y()),
+                                           static_cast<float>(ray.getOrigin().z()) };
+        const std::array<float, 3> inverse_direction{ static_cast<float>(1.0 / ray.getDirection().x()),
+                                                      static_cast<float>(1.0 / ray.getDirection().y()),
+                                                      static_cast<float>(1.0 / ray.getDirection().z()) };
+        std::array<size_t, 3> near_rows{ 0, 1, 2 };
+        std::array<size_t, 3> far_rows{ 3, 4, 5 };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            if (std::signbit(inverse_direction[axis]))
+                std::swap(near_rows[axis], far_rows[axis]);
+        }
+
+        std::array<float, width> entry_ts_expected{ };
+        std::array<float, width> entry_ts_actual{ };
+        const unsigned hit_mask_expected{ gfx::simd::scalar::intersectBoxes<width>(
+                extents.front().data(), near_rows.data(), far_rows.data(), origin.data(),
+                inverse_direction.data(), 0, 100, entry_ts_expected.data()) };
+        const unsigned hit_mask_actual{ gfx::simd::intersectBoxes(
+                extents.front().data(), near_rows.data(), far_rows.data(), origin.data(),
+                inverse_direction.data(), 0, 100, entry_ts_actual.data()) };
+
+        EXPECT_NE(hit_mask_expected, 0);
+        EXPECT_EQ(hit_mask_actual, hit_mask_expected);
+        for (size_t lane = 0; lane < width; ++lane) {
+            if ((hit_mask_expected >> lane) & 1u)
+                EXPECT_FLOAT_EQ(entry_ts_actual[lane], entry_ts_expected[lane]);
+        }
+        EXPECT_EQ((hit_mask_actual >> (width - 1)) & 1u, 0);
+    }
+}
+
+// Tests that the packet box kernel selected at build time matches the scalar kernel, for rays entering the box
+// from either side of each axis, rays parallel to an axis, and rays which miss
+TEST(GraphicsBoundingVolumeHierarchy, PacketBoxKernelMatchesScalar)
+{
+    constexpr size_t width{ gfx::simd::BOX_KERNEL_WIDTH };
+    const std::array<float, 6> box_extents{ 0, 0, 0, 1, 1, 1 };
+    const std::array<gfx::Ray, 8> rays{ gfx::Ray{ -5, 0.5, 0.5, 1, 0, 0 },
+                                        gfx::Ray{ 5, 0.5, 0.5, -1, 0.01, 0 },
+                                        gfx::Ray{ 0.5, -5, 0.5, 0, 1, 0 },
+                                        gfx::Ray{ 0.5, 5, 0.5, 0.01, -1, -0.01 },
+                                        gfx::Ray{ 0.5, 0.5, -5, 0, 0, 1 },
+                                        gfx::Ray{ 5, 5, 5, -1, -1, -1 },
+                                        gfx::Ray{ -5, 5, 0.5, 1, 0, 0 },
+                                        gfx::Ray{ 0.5, 0.5, 5, 0, 0, 1 } };
+    const gfx::RayPacket packet{ std::span{ rays }.first(std::min(width, rays.size())) };
+
+    std::array<float, width> t_mins{ };
+    std::array<float, width> t_maxes{ };
+    t_maxes.fill(100);
+    std::array<float, width> entry_ts_expected{ };
+    std::array<float, width> entry_ts_actual{ };
+    const unsigned hit_mask_expected{ gfx::simd::scalar::intersectRaysWithBox<width>(
+            box_extents.data(), packet.getOrigins(), packet.getInverseDirections(),
+            packet.getNegativeDirectionMasks(), gfx::MAX_RAY_PACKET_SIZE, t_mins.data(), t_maxes.data(),
+            entry_ts_expected.data()) };
+    const unsigned hit_mask_actual{ gfx::simd::intersectRaysWithBox(
+            box_extents.data(), packet.getOrigins(), packet.getInverseDirections(),
+            packet.getNegativeDirectionMasks(), gfx::MAX_RAY_PACKET_SIZE, t_mins.data(), t_maxes.data(),
+            entry_ts_actual.data()) };
+
+    EXPECT_EQ(hit_mask_expected & 0xfu, 0xfu);
+    EXPECT_EQ(hit_mask_actual, hit_mask_expected);
+    for (size_t lane = 0; lane < width; ++lane) {
+        if ((hit_mask_expected >> lane) & 1u)
+            EXPECT_FLOAT_EQ(entry_ts_actual[lane], entry_ts_expected[lane]);
+    }
+    EXPECT_FLOAT_EQ(entry_ts_actual[0], 5);
+    EXPECT_FLOAT_EQ(entry_ts_actual[1], 4);
+}
+
+// Tests that traversing the hierarchy with a packet visits each primitive with exactly the rays which reach it when
+// traced on their own
+TEST(GraphicsBoundingVolumeHierarchy, ForEachCandidatePacket)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(32), 1 };
+    std::vector<gfx::Ray> rays{ };
+    for (size_t i = 0; i < gfx::MAX_RAY_PACKET_SIZE; ++i) {
+        const double offset{ static_cast<double>(i) * 0.1 };
+        rays.emplace_back(-5, 0.2 + offset, 0.5, 1, i % 2 == 0 ? 0.0 : -0.01, 0);
+    }
+    const gfx::RayPacket packet{ rays };
+
+    std::array<double, gfx::MAX_RAY_PACKET_SIZE> t_maxes{ };
+    t_maxes.fill(30);
+    std::vector<uint32_t> ray_masks(32, 0);
+    bvh.forEachCandidate(packet, 0, t_maxes, [&](const uint32_t primitive_index, const uint32_t ray_mask) {
+        ray_masks[primitive_index] |= ray_mask;
+    });
+
+    std::vector<uint32_t> ray_masks_expected(32, 0);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        bvh.forEachCandidate(rays[i], 0, t_maxes[i], [&](const uint32_t primitive_index) {
+            ray_masks_expected[primitive_index] |= 1u << i;
+        });
+    }
+
+    EXPECT_NE(ray_masks_expected[0], 0);
+    EXPECT_EQ(ray_masks_expected[31], 0);
+    EXPECT_EQ(ray_masks, ray_masks_expected);
+}
+
+// Tests traversing the hierarchy with a ray which misses every primitive
+TEST(GraphicsBoundingVolumeHierarchy, ForEachCandidateMiss)
+{
+    const gfx::BoundingVolumeHierarchy bvh{ createBoxRow(16) };
+    const gfx::Ray ray{ -5, 5, 0.5, 1, 0, 0 };
+
+    size_t candidate_count{ 0 };
+    bvh.forEachCandidate(ray, [&](const uint32_t) { ++candidate_count; });
+
+    EXPECT_EQ(candidate_count, 0);
+}
+
+// Tests checking whether a bounding box has finite extents
+TEST(GraphicsBoundingVolumeHierarchy, IsFiniteBoundingBox)
+{
+    const gfx::BoundingBox finite_box{ -1, -1, -1, 1, 1, 1 };
+    const gfx::BoundingBox infinite_box{ -std::numeric_limits<double>::infinity(), 0, -1,
+                                         std::numeric_limits<double>::infinity(), 0, 1 };
+
+    EXPECT_TRUE(gfx::isFiniteBoundingBox(finite_box));
+    EXPECT_FALSE(gfx::isFiniteBoundingBox(infinite_box));
+    EXPECT_FALSE(gfx::isFiniteBoundingBox(gfx::BoundingBox{ }));
+}
+
+// Tests calculating the surface area of a bounding box
+TEST(GraphicsBoundingVolumeHierarchy, GetBoundingBoxSurfaceArea)
+{
+    const gfx::BoundingBox box{ 0, 0, 0, 1, 2, 3 };
+
+    EXPECT_DOUBLE_EQ(gfx::getBoundingBoxSurfaceArea(box), 22);
+    EXPECT_DOUBLE_EQ(gfx::getBoundingBoxSurfaceArea(gfx::BoundingBox{ }), 0);
+}
+
+// Tests calculating the centroid of a bounding box
+TEST(GraphicsBoundingVolumeHierarchy, GetBoundingBoxCentroid)
+{
+    const gfx::BoundingBox box{ -1, 0, 2, 3, 4, 4 };
+
+    EXPECT_EQ(gfx::getBoundingBoxCentroid(box), gfx::createPoint(1, 2, 3));
+}
\ No newline at end of file
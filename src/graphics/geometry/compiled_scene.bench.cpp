@@ -0,0 +1,140 @@
+#include "benchmark/benchmark.h"
+#include "compiled_scene.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "world.hpp"
+#include "sphere.hpp"
+#include "cube.hpp"
+#include "cylinder.hpp"
+#include "cone.hpp"
+#include "triangle.hpp"
+#include "transform.hpp"
+
+// Returns a finalized world of randomly placed, rotated, and scaled primitives, cycling through every built-in shape
+// type so that most leaves of a hierarchy over them hold several types
+static gfx::World createMixedPrimitiveWorld(const size_t primitive_count)
+{
+    std::mt19937 generator{ 3 };
+    std::uniform_real_distribution<double> position_distribution{ -20, 20 };
+    std::uniform_real_distribution<double> scale_distribution{ 0.2, 0.6 };
+    std::uniform_real_distribution<double> angle_distribution{ 0, M_PI };
+
+    gfx::World world{ };
+    for (size_t i = 0; i < primitive_count; ++i) {
+        const gfx::Matrix4 transform{ gfx::createTranslationMatrix(position_distribution(generator),
+                                                                   position_distribution(generator),
+                                                                   position_distribution(generator)) *
+                                      gfx::createYRotationMatrix(angle_distribution(generator)) *
+                                      gfx::createScalingMatrix(scale_distribution(generator)) };
+        switch (i % 5) {
+            case 0:
+                world.addObject(std::make_shared<gfx::Sphere>(transform));
+                break;
+            case 1:
+                world.addObject(std::make_shared<gfx::Cube>(transform));
+                break;
+            case 2:
+                world.addObject(std::make_shared<gfx::Cylinder>(transform, -1, 1, true));
+                break;
+            case 3:
+                world.addObject(std::make_shared<gfx::Cone>(transform, -1, 0, true));
+                break;
+            default: {
+                auto triangle_ptr{ std::make_shared<gfx::Triangle>(gfx::createPoint(0, 1, 0),
+                                                                   gfx::createPoint(-1, 0, 0),
+                                                                   gfx::createPoint(1, 0, 0)) };
+                triangle_ptr->setTransform(transform);
+                world.addObject(triangle_ptr);
+                break;
+            }
+        }
+    }
+    world.finalize();
+    return world;
+}
+
+// Returns rays cast from in front of the primitives through random points among them
+static std::vector<gfx::Ray> createRandomRays()
+{
+    std::mt19937 generator{ 5 };
+    std::uniform_real_distribution<double> position_distribution{ -20, 20 };
+
+    std::vector<gfx::Ray> rays{ };
+    for (size_t i = 0; i < 1024; ++i) {
+        const gfx::Vector4 origin{ gfx::createPoint(position_distribution(generator),
+                                                    position_distribution(generator),
+                                                    -40) };
+        const gfx::Vector4 target{ gfx::createPoint(position_distribution(generator),
+                                                    position_distribution(generator),
+                                                    position_distribution(generator)) };
+        rays.emplace_back(origin, gfx::normalize(target - origin));
+    }
+    return rays;
+}
+
+// Benchmarks finding the closest hits in a world, testing each candidate object through its virtual methods
+static void BM_WorldMixedPrimitivesClosestHit(benchmark::State& state)
+{
+    const gfx::World world{ createMixedPrimitiveWorld(static_cast<size_t>(state.range(0))) };
+    const std::vector<gfx::Ray> rays{ createRandomRays() };
+
+    for (auto _ : state) {
+        for (const gfx::Ray& ray : rays) {
+            benchmark::DoNotOptimize(world.getClosestHit(ray));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+BENCHMARK(BM_WorldMixedPrimitivesClosestHit)->Arg(1000)->Arg(10000);
+
+// Benchmarks finding the closest hits in the compiled form of the same world, testing the primitives of each leaf
+// with the batch kernel for their type
+static void BM_CompiledSceneMixedPrimitivesClosestHit(benchmark::State& state)
+{
+    const gfx::World world{ createMixedPrimitiveWorld(static_cast<size_t>(state.range(0))) };
+    const gfx::CompiledScene scene{ world };
+    const std::vector<gfx::Ray> rays{ createRandomRays() };
+
+    for (auto _ : state) {
+        for (const gfx::Ray& ray : rays) {
+            benchmark::DoNotOptimize(scene.getClosestHit(ray));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+BENCHMARK(BM_CompiledSceneMixedPrimitivesClosestHit)->Arg(1000)->Arg(10000);
+
+// Benchmarks testing rays for any hit within a distance in a world, as for shadow rays
+static void BM_WorldMixedPrimitivesAnyHit(benchmark::State& state)
+{
+    const gfx::World world{ createMixedPrimitiveWorld(static_cast<size_t>(state.range(0))) };
+    const std::vector<gfx::Ray> rays{ createRandomRays() };
+
+    for (auto _ : state) {
+        for (const gfx::Ray& ray : rays) {
+            benchmark::DoNotOptimize(world.hasIntersectionWithin(ray, 0, 40));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+BENCHMARK(BM_WorldMixedPrimitivesAnyHit)->Arg(1000)->Arg(10000);
+
+// Benchmarks testing rays for any hit within a distance in the compiled form of the same world
+static void BM_CompiledSceneMixedPrimitivesAnyHit(benchmark::State& state)
+{
+    const gfx::World world{ createMixedPrimitiveWorld(static_cast<size_t>(state.range(0))) };
+    const gfx::CompiledScene scene{ world };
+    const std::vector<gfx::Ray> rays{ createRandomRays() };
+
+    for (auto _ : state) {
+        for (const gfx::Ray& ray : rays) {
+            benchmark::DoNotOptimize(scene.hasIntersectionWithin(ray, 0, 40));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rays.size()));
+}
+BENCHMARK(BM_CompiledSceneMixedPrimitivesAnyHit)->Arg(1000)->Arg(10000);
@@ -0,0 +1,1029 @@
+#include "compiled_scene.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <deque>
+#include <format>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "world.hpp"
+#include "object.hpp"
+#include "composite_surface.hpp"
+#include "surface.hpp"
+#include "sphere.hpp"
+#include "plane.hpp"
+#include "cube.hpp"
+#include "cylinder.hpp"
+#include "cone.hpp"
+#include "triangle.hpp"
+#include "util_functions.hpp"
+#include "shading_functions.hpp"
+#include "render_statistics.hpp"
+
+namespace gfx {
+    namespace {
+        // Returns the table a surface is stored in, which is only specialized for the exact built-in shape types,
+        // since a derived shape may override how it is intersected
+        PrimitiveType getPrimitiveType(const Surface& surface)
+        {
+            const std::type_info& surface_type{ typeid(surface) };
+            if (surface_type == typeid(Sphere))
+                return PrimitiveType::Sphere;
+            if (surface_type == typeid(Plane))
+                return PrimitiveType::Plane;
+            if (surface_type == typeid(Cube))
+                return PrimitiveType::Cube;
+            if (surface_type == typeid(Cylinder))
+                return PrimitiveType::Cylinder;
+            if (surface_type == typeid(Cone))
+                return PrimitiveType::Cone;
+            if (surface_type == typeid(Triangle))
+                return PrimitiveType::Triangle;
+            return PrimitiveType::Generic;
+        }
+
+        // Appends the bounds and end caps of a cylinder or cone to the columns of its table
+        template<typename CappedShape>
+        void addCappedShapeParameters(const CappedShape& shape, CompiledScene::PrimitiveTable& table)
+        {
+            table.y_mins.push_back(shape.getYMin());
+            table.y_maxes.push_back(shape.getYMax());
+            table.closed_flags.push_back(shape.isClosed() ? 1 : 0);
+        }
+
+        // Appends the coordinates of a vector to three columns of a table
+        void addVectorColumns(const Vector4& vector, std::array<std::vector<double>, 3>& columns)
+        {
+            columns[0].push_back(vector.x());
+            columns[1].push_back(vector.y());
+            columns[2].push_back(vector.z());
+        }
+
+        // Largest number of primitives in a leaf of a compiled scene's hierarchy. Larger leaves than the default
+        // give the batch kernels longer runs of each type, which outweighs the extra primitives tested per leaf.
+        constexpr size_t COMPILED_BVH_MAX_LEAF_SIZE{ 8 };
+
+        /* Batch Intersection Kernels */
+
+        // Number of primitives whose intersections are calculated together, in loops free of calls and branches so
+        // that they may be vectorized, before any of them are passed on to the caller
+        constexpr size_t PRIMITIVE_BATCH_SIZE{ 8 };
+
+        // Marks an intersection which a primitive in a batch does not have
+        constexpr double MISSING_T{ std::numeric_limits<double>::quiet_NaN() };
+
+        // The t-values of the intersections with each primitive in a batch, up to a fixed number per primitive
+        template<size_t MaxIntersectionCount>
+        using BatchTs = std::array<std::array<double, PRIMITIVE_BATCH_SIZE>, MaxIntersectionCount>;
+
+        // The coordinates of a ray's origin and direction
+        struct RayCoordinates {
+            double origin_x;
+            double origin_y;
+            double origin_z;
+            double direction_x;
+            double direction_y;
+            double direction_z;
+        };
+
+        // The coordinates of a ray in the object space of each primitive in a batch, one list per coordinate
+        struct BatchRays {
+            std::array<double, PRIMITIVE_BATCH_SIZE> origin_x;
+            std::array<double, PRIMITIVE_BATCH_SIZE> origin_y;
+            std::array<double, PRIMITIVE_BATCH_SIZE> origin_z;
+            std::array<double, PRIMITIVE_BATCH_SIZE> direction_x;
+            std::array<double, PRIMITIVE_BATCH_SIZE> direction_y;
+            std::array<double, PRIMITIVE_BATCH_SIZE> direction_z;
+
+            [[nodiscard]] RayCoordinates operator[](const size_t lane) const
+            {
+                return RayCoordinates{ origin_x[lane], origin_y[lane], origin_z[lane],
+                                       direction_x[lane], direction_y[lane], direction_z[lane] };
+            }
+        };
+
+        // Transforms a world space ray by the affine world-to-object matrices of a batch of primitives. The ray's
+        // origin is a point and its direction a vector, so the fourth column of each matrix only applies to the
+        // origin.
+        inline BatchRays transformRays(const CompiledScene::PrimitiveTable& table,
+                                       const size_t first,
+                                       const size_t count,
+                                       const RayCoordinates ray)
+        {
+            const auto& m{ table.transform_columns };
+            BatchRays rays{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const size_t index{ first + lane };
+                rays.origin_x[lane] = m[0][index] * ray.origin_x + m[1][index] * ray.origin_y +
+                                      m[2][index] * ray.origin_z + m[3][index];
+                rays.origin_y[lane] = m[4][index] * ray.origin_x + m[5][index] * ray.origin_y +
+                                      m[6][index] * ray.origin_z + m[7][index];
+                rays.origin_z[lane] = m[8][index] * ray.origin_x + m[9][index] * ray.origin_y +
+                                      m[10][index] * ray.origin_z + m[11][index];
+                rays.direction_x[lane] = m[0][index] * ray.direction_x + m[1][index] * ray.direction_y +
+                                         m[2][index] * ray.direction_z;
+                rays.direction_y[lane] = m[4][index] * ray.direction_x + m[5][index] * ray.direction_y +
+                                         m[6][index] * ray.direction_z;
+                rays.direction_z[lane] = m[8][index] * ray.direction_x + m[9][index] * ray.direction_y +
+                                         m[10][index] * ray.direction_z;
+            }
+            return rays;
+        }
+
+        // Returns true if both conditions hold, evaluating each rather than short-circuiting
+        inline bool both(const bool lhs, const bool rhs)
+        { return lhs & rhs; }
+
+        // Returns true if either condition holds, evaluating each rather than short-circuiting
+        inline bool either(const bool lhs, const bool rhs)
+        { return lhs | rhs; }
+
+        // Returns the larger of two values, or the other value if one is NaN, as std::fmax() does. The comparison
+        // is written out so that it compiles to a select rather than a call into the math library.
+        inline double maxIgnoringNaN(const double lhs, const double rhs)
+        {
+            const bool is_rhs_nan{ rhs != rhs };
+            return either(is_rhs_nan, lhs > rhs) ? lhs : rhs;
+        }
+
+        // Returns the smaller of two values, or the other value if one is NaN, as std::fmin() does
+        inline double minIgnoringNaN(const double lhs, const double rhs)
+        {
+            const bool is_rhs_nan{ rhs != rhs };
+            return either(is_rhs_nan, lhs < rhs) ? lhs : rhs;
+        }
+
+        // Branch-free forms of the relative comparisons in util_functions.hpp. Each gives the same result for every
+        // input, but evaluates all of its conditions rather than short-circuiting, so loops using them hold no
+        // control flow. The absolute and relative tolerances are merged into one, since a difference within either
+        // is within the larger of the two.
+        inline bool areNearlyEqual(const double lhs, const double rhs)
+        {
+            constexpr double infinity{ std::numeric_limits<double>::infinity() };
+            const double difference{ std::abs(lhs - rhs) };
+            const bool is_infinite{ either(std::abs(lhs) == infinity, std::abs(rhs) == infinity) };
+            const double magnitude{ maxIgnoringNaN(maxIgnoringNaN(std::abs(lhs), std::abs(rhs)), 1.0) };
+            return either(lhs == rhs, both(!is_infinite, difference <= utils::EPSILON * magnitude));
+        }
+
+        inline bool isNearlyLess(const double lhs, const double rhs)
+        { return both(!areNearlyEqual(lhs, rhs), lhs < rhs); }
+
+        inline bool isNearlyGreater(const double lhs, const double rhs)
+        { return both(!areNearlyEqual(lhs, rhs), lhs > rhs); }
+
+        inline bool isNearlyLessOrEqual(const double lhs, const double rhs)
+        { return either(areNearlyEqual(lhs, rhs), lhs < rhs); }
+
+        // Each kernel below repeats the calculations of its shape's calculateIntersections(), including the relative
+        // comparisons, so that both paths find the same intersections. Every value is calculated for every primitive,
+        // even where the branches returning early there would skip it, and the intersections which would not have
+        // been found are then replaced by MISSING_T. The t-values are gathered in a local list and copied out once
+        // the loop ends, so that the compiler can tell they do not overlap the table's columns.
+
+        // Unit spheres at the origin, reporting the single intersection of a tangent ray twice
+        inline void calculateSphereTs(const CompiledScene::PrimitiveTable&,
+                                      const size_t,
+                                      const size_t count,
+                                      const BatchRays& rays,
+                                      BatchTs<2>& batch_ts)
+        {
+            BatchTs<2> ts{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const RayCoordinates r{ rays[lane] };
+                const double a{ r.direction_x * r.direction_x + r.direction_y * r.direction_y +
+                                r.direction_z * r.direction_z };
+                const double b{ 2 * (r.direction_x * r.origin_x + r.direction_y * r.origin_y +
+                                     r.direction_z * r.origin_z) };
+                const double c{ r.origin_x * r.origin_x + r.origin_y * r.origin_y + r.origin_z * r.origin_z - 1 };
+                const double discriminant{ b * b - 4 * a * c };
+
+                const bool is_hit{ !isNearlyLess(discriminant, 0.0) };
+                const double square_root{ std::sqrt(discriminant) };
+                const double root{ areNearlyEqual(discriminant, 0.0) ? 0.0 : square_root };
+                const double t_0{ (-b - root) / (2 * a) };
+                const double t_1{ (-b + root) / (2 * a) };
+                ts[0][lane] = is_hit ? t_0 : MISSING_T;
+                ts[1][lane] = is_hit ? t_1 : MISSING_T;
+            }
+            batch_ts = ts;
+        }
+
+        // The xz-plane, missed by rays parallel to it
+        inline void calculatePlaneTs(const CompiledScene::PrimitiveTable&,
+                                     const size_t,
+                                     const size_t count,
+                                     const BatchRays& rays,
+                                     BatchTs<1>& batch_ts)
+        {
+            BatchTs<1> ts{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const double t{ -rays.origin_y[lane] / rays.direction_y[lane] };
+                ts[0][lane] = std::abs(rays.direction_y[lane]) < utils::EPSILON ? MISSING_T : t;
+            }
+            batch_ts = ts;
+        }
+
+        // Returns the t-values at which a ray crosses the two faces of a unit cube along one axis, nearest first
+        inline std::pair<double, double> calculateCubeAxisTs(const double origin, const double direction)
+        {
+            const double t_near{ (-1 - origin) / direction };
+            const double t_far{ (1 - origin) / direction };
+            const bool is_reversed{ isNearlyGreater(t_near, t_far) };
+            return std::pair{ is_reversed ? t_far : t_near, is_reversed ? t_near : t_far };
+        }
+
+        // Axis-aligned cubes spanning -1 to 1 on each axis
+        inline void calculateCubeTs(const CompiledScene::PrimitiveTable&,
+                                    const size_t,
+                                    const size_t count,
+                                    const BatchRays& rays,
+                                    BatchTs<2>& batch_ts)
+        {
+            BatchTs<2> ts{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const RayCoordinates r{ rays[lane] };
+                const auto [ x_t_min, x_t_max ] { calculateCubeAxisTs(r.origin_x, r.direction_x) };
+                const auto [ y_t_min, y_t_max ] { calculateCubeAxisTs(r.origin_y, r.direction_y) };
+                const auto [ z_t_min, z_t_max ] { calculateCubeAxisTs(r.origin_z, r.direction_z) };
+                const double t_min{ maxIgnoringNaN(maxIgnoringNaN(x_t_min, y_t_min), z_t_min) };
+                const double t_max{ minIgnoringNaN(minIgnoringNaN(x_t_max, y_t_max), z_t_max) };
+
+                const bool is_hit{ !isNearlyGreater(t_min, t_max) };
+                ts[0][lane] = is_hit ? t_min : MISSING_T;
+                ts[1][lane] = is_hit ? t_max : MISSING_T;
+            }
+            batch_ts = ts;
+        }
+
+        // Returns the t-value at which a ray crosses the end cap of a cylinder or cone at the passed-in height, if
+        // the crossing lies within the radius of the cap
+        inline double calculateEndCapT(const RayCoordinates& r, const double cap_y, const double cap_radius_squared)
+        {
+            const double t{ (cap_y - r.origin_y) / r.direction_y };
+            const double x{ r.origin_x + t * r.direction_x };
+            const double z{ r.origin_z + t * r.direction_z };
+            return isNearlyLessOrEqual(x * x + z * z, cap_radius_squared) ? t : MISSING_T;
+        }
+
+        // Returns the t-value of an intersection with the infinite wall of a cylinder or cone if it lies strictly
+        // between the bounds of the shape
+        inline double clipWallT(const RayCoordinates& r, const double t, const double y_min, const double y_max)
+        {
+            const double y{ r.origin_y + t * r.direction_y };
+            return both(isNearlyLess(y_min, y), isNearlyLess(y, y_max)) ? t : MISSING_T;
+        }
+
+        // Returns the two roots of a quadratic, nearest first, which are NaN for a negative discriminant
+        inline std::pair<double, double> calculateWallTs(const double a, const double b, const double discriminant)
+        {
+            const double t_0{ (-b - std::sqrt(discriminant)) / (2 * a) };
+            const double t_1{ (-b + std::sqrt(discriminant)) / (2 * a) };
+            const bool is_reversed{ isNearlyGreater(t_0, t_1) };
+            return std::pair{ is_reversed ? t_1 : t_0, is_reversed ? t_0 : t_1 };
+        }
+
+        // Unit radius cylinders along the y-axis. Rays missing the infinite cylinder are not tested against its end
+        // caps, as in Cylinder::calculateIntersections().
+        inline void calculateCylinderTs(const CompiledScene::PrimitiveTable& table,
+                                        const size_t first,
+                                        const size_t count,
+                                        const BatchRays& rays,
+                                        BatchTs<4>& batch_ts)
+        {
+            const double* const y_mins{ table.y_mins.data() + first };
+            const double* const y_maxes{ table.y_maxes.data() + first };
+            const uint32_t* const closed_flags{ table.closed_flags.data() + first };
+            BatchTs<4> ts{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const RayCoordinates r{ rays[lane] };
+                const double a{ r.direction_x * r.direction_x + r.direction_z * r.direction_z };
+                const double b{ 2 * r.origin_x * r.direction_x + 2 * r.origin_z * r.direction_z };
+                const double c{ r.origin_x * r.origin_x + r.origin_z * r.origin_z - 1 };
+                const double discriminant{ b * b - 4 * a * c };
+
+                const bool has_walls{ !areNearlyEqual(a, 0.0) };
+                const bool is_missed{ both(has_walls, isNearlyLess(discriminant, 0.0)) };
+                const bool has_wall_hits{ both(has_walls, !is_missed) };
+                const auto [ t_0, t_1 ] { calculateWallTs(a, b, discriminant) };
+                const double clipped_t_0{ clipWallT(r, t_0, y_mins[lane], y_maxes[lane]) };
+                const double clipped_t_1{ clipWallT(r, t_1, y_mins[lane], y_maxes[lane]) };
+                ts[0][lane] = has_wall_hits ? clipped_t_0 : MISSING_T;
+                ts[1][lane] = has_wall_hits ? clipped_t_1 : MISSING_T;
+
+                const bool is_parallel_to_caps{ areNearlyEqual(r.direction_y, 0.0) };
+                const bool has_cap_hits{ both(closed_flags[lane] != 0, !either(is_missed, is_parallel_to_caps)) };
+                const double t_lower{ calculateEndCapT(r, y_mins[lane], 1.0) };
+                const double t_upper{ calculateEndCapT(r, y_maxes[lane], 1.0) };
+                ts[2][lane] = has_cap_hits ? t_lower : MISSING_T;
+                ts[3][lane] = has_cap_hits ? t_upper : MISSING_T;
+            }
+            batch_ts = ts;
+        }
+
+        // Double-napped cones along the y-axis, whose radius at each height is the absolute value of the height.
+        // Rays parallel to one half of the cone intersect the other half once, without being clipped to its bounds.
+        inline void calculateConeTs(const CompiledScene::PrimitiveTable& table,
+                                    const size_t first,
+                                    const size_t count,
+                                    const BatchRays& rays,
+                                    BatchTs<4>& batch_ts)
+        {
+            const double* const y_mins{ table.y_mins.data() + first };
+            const double* const y_maxes{ table.y_maxes.data() + first };
+            const uint32_t* const closed_flags{ table.closed_flags.data() + first };
+            BatchTs<4> ts{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const RayCoordinates r{ rays[lane] };
+                const double a{ r.direction_x * r.direction_x - r.direction_y * r.direction_y +
+                                r.direction_z * r.direction_z };
+                const double b{ 2 * r.origin_x * r.direction_x - 2 * r.origin_y * r.direction_y +
+                                2 * r.origin_z * r.direction_z };
+                const double c{ r.origin_x * r.origin_x - r.origin_y * r.origin_y + r.origin_z * r.origin_z };
+                const double discriminant{ b * b - 4 * a * c };
+
+                const bool has_walls{ !areNearlyEqual(a, 0.0) };
+                const bool is_missed{ both(has_walls, isNearlyLess(discriminant, 0.0)) };
+                const bool has_wall_hits{ both(has_walls, !is_missed) };
+                const bool has_single_half_hit{ both(!has_walls, !areNearlyEqual(b, 0.0)) };
+                const auto [ t_0, t_1 ] { calculateWallTs(a, b, discriminant) };
+                const double clipped_t_0{ clipWallT(r, t_0, y_mins[lane], y_maxes[lane]) };
+                const double clipped_t_1{ clipWallT(r, t_1, y_mins[lane], y_maxes[lane]) };
+                const double single_half_t{ -c / (2 * b) };
+                const double first_wall_t{ has_single_half_hit ? single_half_t : MISSING_T };
+                ts[0][lane] = has_wall_hits ? clipped_t_0 : first_wall_t;
+                ts[1][lane] = has_wall_hits ? clipped_t_1 : MISSING_T;
+
+                const bool is_parallel_to_caps{ areNearlyEqual(r.direction_y, 0.0) };
+                const bool has_cap_hits{ both(closed_flags[lane] != 0, !either(is_missed, is_parallel_to_caps)) };
+                const double t_lower{ calculateEndCapT(r, y_mins[lane], std::abs(y_mins[lane])) };
+                const double t_upper{ calculateEndCapT(r, y_maxes[lane], std::abs(y_maxes[lane])) };
+                ts[2][lane] = has_cap_hits ? t_lower : MISSING_T;
+                ts[3][lane] = has_cap_hits ? t_upper : MISSING_T;
+            }
+            batch_ts = ts;
+        }
+
+        // Triangles, intersected with the Möller-Trumbore algorithm
+        inline void calculateTriangleTs(const CompiledScene::PrimitiveTable& table,
+                                        const size_t first,
+                                        const size_t count,
+                                        const BatchRays& rays,
+                                        BatchTs<1>& batch_ts)
+        {
+            const std::array<const double*, 3> vertex_a{ table.vertex_a_columns[0].data() + first,
+                                                         table.vertex_a_columns[1].data() + first,
+                                                         table.vertex_a_columns[2].data() + first };
+            const std::array<const double*, 3> edge_a{ table.edge_a_columns[0].data() + first,
+                                                       table.edge_a_columns[1].data() + first,
+                                                       table.edge_a_columns[2].data() + first };
+            const std::array<const double*, 3> edge_b{ table.edge_b_columns[0].data() + first,
+                                                       table.edge_b_columns[1].data() + first,
+                                                       table.edge_b_columns[2].data() + first };
+            BatchTs<1> ts{ };
+            for (size_t lane = 0; lane < count; ++lane) {
+                const RayCoordinates r{ rays[lane] };
+                const double ray_cross_edge_b_x{ r.direction_y * edge_b[2][lane] - r.direction_z * edge_b[1][lane] };
+                const double ray_cross_edge_b_y{ r.direction_z * edge_b[0][lane] - r.direction_x * edge_b[2][lane] };
+                const double ray_cross_edge_b_z{ r.direction_x * edge_b[1][lane] - r.direction_y * edge_b[0][lane] };
+                const double determinant{ edge_a[0][lane] * ray_cross_edge_b_x +
+                                          edge_a[1][lane] * ray_cross_edge_b_y +
+                                          edge_a[2][lane] * ray_cross_edge_b_z };
+                const double inverse_determinant{ 1.0 / determinant };
+
+                const double to_origin_x{ r.origin_x - vertex_a[0][lane] };
+                const double to_origin_y{ r.origin_y - vertex_a[1][lane] };
+                const double to_origin_z{ r.origin_z - vertex_a[2][lane] };
+                const double u{ inverse_determinant * (to_origin_x * ray_cross_edge_b_x +
+                                                       to_origin_y * ray_cross_edge_b_y +
+                                                       to_origin_z * ray_cross_edge_b_z) };
+
+                const double origin_cross_edge_a_x{ to_origin_y * edge_a[2][lane] - to_origin_z * edge_a[1][lane] };
+                const double origin_cross_edge_a_y{ to_origin_z * edge_a[0][lane] - to_origin_x * edge_a[2][lane] };
+                const double origin_cross_edge_a_z{ to_origin_x * edge_a[1][lane] - to_origin_y * edge_a[0][lane] };
+                const double v{ inverse_determinant * (r.direction_x * origin_cross_edge_a_x +
+                                                       r.direction_y * origin_cross_edge_a_y +
+                                                       r.direction_z * origin_cross_edge_a_z) };
+                const double t{ inverse_determinant * (edge_b[0][lane] * origin_cross_edge_a_x +
+                                                       edge_b[1][lane] * origin_cross_edge_a_y +
+                                                       edge_b[2][lane] * origin_cross_edge_a_z) };
+
+                const bool is_outside_u{ either(isNearlyLess(u, 0.0), isNearlyGreater(u, 1.0)) };
+                const bool is_outside_v{ either(isNearlyLess(v, 0.0), isNearlyGreater(u + v, 1.0)) };
+                const bool is_missed{ either(areNearlyEqual(determinant, 0.0), either(is_outside_u, is_outside_v)) };
+                ts[0][lane] = is_missed ? MISSING_T : t;
+            }
+            batch_ts = ts;
+        }
+
+        // Calculates the intersections of a ray with a run of primitives of one type in batches, calling the visitor
+        // with the table index and t-value of each intersection found. Returns true as soon as the visitor does.
+        template<size_t MaxIntersectionCount, auto calculateTs, typename HitVisitor>
+        bool visitBatchHits(const ShapeType shape_type,
+                            const CompiledScene::PrimitiveTable& table,
+                            const uint32_t first,
+                            const uint32_t count,
+                            const Ray& ray,
+                            HitVisitor&& visit_hit)
+        {
+            const RayCoordinates ray_coordinates{ ray.getOrigin().x(), ray.getOrigin().y(), ray.getOrigin().z(),
+                                                  ray.getDirection().x(), ray.getDirection().y(),
+                                                  ray.getDirection().z() };
+            BatchTs<MaxIntersectionCount> ts;
+            for (size_t batch_first = first; batch_first < first + count; batch_first += PRIMITIVE_BATCH_SIZE) {
+                const size_t batch_size{ std::min(PRIMITIVE_BATCH_SIZE, first + count - batch_first) };
+                for (size_t lane = 0; lane < batch_size; ++lane) {
+                    RenderStatisticsCollector::recordIntersectionTest(shape_type);
+                }
+
+                const BatchRays rays{ transformRays(table, batch_first, batch_size, ray_coordinates) };
+                calculateTs(table, batch_first, batch_size, rays, ts);
+                for (size_t lane = 0; lane < batch_size; ++lane)
+                    for (size_t i = 0; i < MaxIntersectionCount; ++i) {
+                        if (!std::isnan(ts[i][lane]) &&
+                            visit_hit(static_cast<uint32_t>(batch_first + lane), ts[i][lane]))
+                            return true;
+                    }
+            }
+            return false;
+        }
+
+        // Intersects a ray with a run of built-in shapes of one type, stored in consecutive rows of their table
+        template<typename HitVisitor>
+        bool visitBuiltInShapeHits(const CompiledScene::PrimitiveTable& table,
+                                   const PrimitiveType type,
+                                   const uint32_t first,
+                                   const uint32_t count,
+                                   const Ray& ray,
+                                   HitVisitor&& visit_hit)
+        {
+            switch (type) {
+                case PrimitiveType::Sphere:
+                    return visitBatchHits<2, calculateSphereTs>(ShapeType::Sphere, table, first, count, ray,
+                                                                visit_hit);
+                case PrimitiveType::Plane:
+                    return visitBatchHits<1, calculatePlaneTs>(ShapeType::Plane, table, first, count, ray,
+                                                               visit_hit);
+                case PrimitiveType::Cube:
+                    return visitBatchHits<2, calculateCubeTs>(ShapeType::Cube, table, first, count, ray,
+                                                              visit_hit);
+                case PrimitiveType::Cylinder:
+                    return visitBatchHits<4, calculateCylinderTs>(ShapeType::Cylinder, table, first, count, ray,
+                                                                  visit_hit);
+                case PrimitiveType::Cone:
+                    return visitBatchHits<4, calculateConeTs>(ShapeType::Cone, table, first, count, ray,
+                                                              visit_hit);
+                case PrimitiveType::Triangle:
+                    return visitBatchHits<1, calculateTriangleTs>(ShapeType::Triangle, table, first, count, ray,
+                                                                  visit_hit);
+                case PrimitiveType::Generic:
+                    break;
+            }
+            throw std::invalid_argument{ "Generic primitives have no batch intersection kernel." };
+        }
+    }
+
+    Matrix4 CompiledScene::PrimitiveTable::getWorldToObjectTransform(const size_t index) const
+    {
+        if (!world_to_object_transforms.empty())
+            return world_to_object_transforms.at(index);
+
+        std::array<double, 16> elements{ };
+        for (size_t element = 0; element < transform_columns.size(); ++element) {
+            elements[element] = transform_columns[element].at(index);
+        }
+        elements[15] = 1;
+        return Matrix4{ elements };
+    }
+
+    size_t CompiledScene::PrimitiveTable::getAllocatedBytes() const
+    {
+        const auto column_bytes{ [](const auto& column) {
+            return column.capacity() * sizeof(typename std::remove_cvref_t<decltype(column)>::value_type);
+        } };
+
+        size_t allocated_bytes{ column_bytes(world_to_object_transforms) + column_bytes(surfaces) +
+                                column_bytes(material_indices) + column_bytes(y_mins) + column_bytes(y_maxes) +
+                                column_bytes(closed_flags) };
+        for (const auto& column : transform_columns) {
+            allocated_bytes += column_bytes(column);
+        }
+        for (size_t axis = 0; axis < 3; ++axis) {
+            allocated_bytes += column_bytes(vertex_a_columns[axis]) + column_bytes(edge_a_columns[axis]) +
+                               column_bytes(edge_b_columns[axis]);
+        }
+        return allocated_bytes;
+    }
+
+    size_t CompiledSceneStatistics::getTotalPrimitiveCount() const
+    {
+        return std::accumulate(primitive_counts.begin(), primitive_counts.end(), size_t{ 0 });
+    }
+
+    size_t CompiledSceneStatistics::getTotalBytes() const
+    {
+        return primitive_table_bytes + material_table_bytes + bvh_bytes;
+    }
+
+    CompiledScene::CompiledScene(const World& world)
+            : m_light_source{ world.getLightSource() }
+    {
+        const auto start_time{ std::chrono::steady_clock::now() };
+
+        std::vector<PrimitiveRecord> bounded_records{ };
+        std::vector<PrimitiveRecord> unbounded_records{ };
+        std::vector<BoundingBox> primitive_bounds{ };
+        for (size_t object_index = 0; object_index < world.getObjectCount(); ++object_index) {
+            this->addObject(world.getObjectAt(object_index), createIdentityMatrix(),
+                            bounded_records, unbounded_records, primitive_bounds);
+        }
+
+        // Without the groups to divide the scene, the surface area heuristic is left to find its structure
+        m_bvh = BoundingVolumeHierarchy{ primitive_bounds, COMPILED_BVH_MAX_LEAF_SIZE,
+                                         BvhSplitMethod::SurfaceAreaHeuristic };
+
+        // Number the bounded primitives in the order of the leaves, so that the primitives of one type within a leaf
+        // occupy consecutive rows of their table and are intersected as a single batch
+        m_bounded_primitives.resize(bounded_records.size());
+        const std::span<const uint32_t> primitive_indices{ m_bvh.getPrimitiveIndices() };
+        std::vector<const PrimitiveRecord*> leaf_records{ };
+        for (const BoundingVolumeHierarchy::WideNode& node : m_bvh.getWideNodes()) {
+            for (size_t lane = 0; lane < node.child_count; ++lane) {
+                const uint32_t first_position{ node.child_offsets[lane] };
+                const uint32_t leaf_size{ node.child_primitive_counts[lane] };
+                if (leaf_size == 0)
+                    continue;
+
+                leaf_records.clear();
+                for (uint32_t position = first_position; position < first_position + leaf_size; ++position) {
+                    leaf_records.push_back(&bounded_records[primitive_indices[position]]);
+                }
+                this->addPrimitives(leaf_records,
+                                    std::span{ m_bounded_primitives }.subspan(first_position, leaf_size));
+            }
+        }
+
+        // The unbounded primitives are tested against every ray, so they form a single group
+        leaf_records.clear();
+        for (const PrimitiveRecord& record : unbounded_records) {
+            leaf_records.push_back(&record);
+        }
+        m_unbounded_primitives.resize(unbounded_records.size());
+        this->addPrimitives(leaf_records, m_unbounded_primitives);
+
+        m_statistics.compile_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start_time);
+        this->measureStatistics();
+    }
+
+    void CompiledScene::addObject(const Object& object,
+                                  const Matrix4& parent_to_world_transform,
+                                  std::vector<PrimitiveRecord>& bounded_records,
+                                  std::vector<PrimitiveRecord>& unbounded_records,
+                                  std::vector<BoundingBox>& primitive_bounds)
+    {
+        const Matrix4 object_to_world_transform{ parent_to_world_transform * object.getTransform() };
+
+        // Groups only pass their transform and material down to their children, so they are replaced by their leaves
+        if (const auto* const group{ dynamic_cast<const CompositeSurface*>(&object) }) {
+            for (size_t child_index = 0; child_index < group->getChildCount(); ++child_index) {
+                this->addObject(group->getChildAt(child_index), object_to_world_transform,
+                                bounded_records, unbounded_records, primitive_bounds);
+            }
+            return;
+        }
+
+        const auto* const surface{ dynamic_cast<const Surface*>(&object) };
+        if (surface == nullptr)
+            throw std::invalid_argument{ "Compiled scenes may only contain surfaces and composite surfaces." };
+
+        // The material is looked up through the surface's parents once here, rather than at every shading point.
+        // The batch kernels drop the bottom row of the world-to-object matrix, so shapes with a projective transform
+        // are intersected through their virtual methods instead.
+        PrimitiveRecord record{ surface,
+                                surface->getWorldToObjectTransform(),
+                                getPrimitiveType(*surface),
+                                this->addMaterial(surface->getMaterial()) };
+        if (!record.world_to_object_transform.isAffine()) {
+            record.type = PrimitiveType::Generic;
+        }
+        ++m_statistics.surface_material_count;
+
+        const BoundingBox world_bounds{ surface->getBounds().transform(object_to_world_transform) };
+        if (isFiniteBoundingBox(world_bounds)) {
+            primitive_bounds.push_back(world_bounds);
+            bounded_records.push_back(record);
+        } else {
+            unbounded_records.push_back(record);
+        }
+    }
+
+    void CompiledScene::addPrimitives(const std::span<const PrimitiveRecord*> records,
+                                      const std::span<PrimitiveReference> references)
+    {
+        std::stable_sort(records.begin(), records.end(), [](const PrimitiveRecord* lhs, const PrimitiveRecord* rhs) {
+            return lhs->type < rhs->type;
+        });
+        for (size_t i = 0; i < records.size(); ++i) {
+            const PrimitiveType type{ records[i]->type };
+            references[i] = PrimitiveReference{ type, static_cast<uint32_t>(this->getPrimitiveTable(type).size()) };
+            this->addPrimitive(*records[i]);
+        }
+    }
+
+    void CompiledScene::addPrimitive(const PrimitiveRecord& record)
+    {
+        PrimitiveTable& table{ m_primitive_tables[static_cast<size_t>(record.type)] };
+        if (record.type == PrimitiveType::Generic) {
+            table.world_to_object_transforms.push_back(record.world_to_object_transform);
+        } else {
+            for (size_t element = 0; element < table.transform_columns.size(); ++element) {
+                table.transform_columns[element].push_back(record.world_to_object_transform.data()[element]);
+            }
+        }
+        table.surfaces.push_back(record.surface);
+        table.material_indices.push_back(record.material_index);
+
+        switch (record.type) {
+            case PrimitiveType::Cylinder:
+                addCappedShapeParameters(static_cast<const Cylinder&>(*record.surface), table);
+                break;
+            case PrimitiveType::Cone:
+                addCappedShapeParameters(static_cast<const Cone&>(*record.surface), table);
+                break;
+            case PrimitiveType::Triangle: {
+                const auto& triangle{ static_cast<const Triangle&>(*record.surface) };
+                addVectorColumns(triangle.getVertexA(), table.vertex_a_columns);
+                addVectorColumns(triangle.getEdgeA(), table.edge_a_columns);
+                addVectorColumns(triangle.getEdgeB(), table.edge_b_columns);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    uint32_t CompiledScene::addMaterial(const Material& material)
+    {
+        // Scenes hold few distinct materials, so a linear search is cheaper than hashing the texture of each one
+        const auto material_iter{ std::find(m_materials.begin(), m_materials.end(), material) };
+        if (material_iter != m_materials.end())
+            return static_cast<uint32_t>(material_iter - m_materials.begin());
+
+        m_materials.push_back(material);
+        m_compiled_textures.emplace_back(material.getTexture());
+        return static_cast<uint32_t>(m_materials.size() - 1);
+    }
+
+    void CompiledScene::measureStatistics()
+    {
+        for (size_t type_index = 0; type_index < PRIMITIVE_TYPE_COUNT; ++type_index) {
+            const PrimitiveTable& table{ m_primitive_tables[type_index] };
+            m_statistics.primitive_counts[type_index] = table.size();
+            m_statistics.primitive_table_bytes += table.getAllocatedBytes();
+        }
+        m_statistics.primitive_table_bytes += (m_bounded_primitives.capacity() + m_unbounded_primitives.capacity()) *
+                                              sizeof(PrimitiveReference);
+        m_statistics.unbounded_primitive_count = m_unbounded_primitives.size();
+
+        m_statistics.material_count = m_materials.size();
+        m_statistics.material_table_bytes = m_materials.capacity() * sizeof(Material) +
+                                            m_compiled_textures.capacity() * sizeof(CompiledTexture);
+        for (const CompiledTexture& compiled_texture : m_compiled_textures)
+            m_statistics.material_table_bytes += compiled_texture.getNodes().capacity() *
+                                                 sizeof(CompiledTexture::Node);
+
+        m_statistics.bvh_node_count = m_bvh.getNodeCount();
+        m_statistics.bvh_bytes = m_bvh.getWideNodes().size_bytes() +
+                                 m_bvh.getPrimitiveIndices().size_bytes();
+    }
+
+    template<typename HitVisitor, typename GenericVisitor>
+    bool CompiledScene::visitPrimitiveHits(const std::span<const PrimitiveReference> primitives,
+                                           const Ray& ray,
+                                           HitVisitor&& visit_hit,
+                                           GenericVisitor&& visit_generic) const
+    {
+        // Each run of primitives sharing a type occupies consecutive rows of their table
+        size_t run_first{ 0 };
+        while (run_first < primitives.size()) {
+            const PrimitiveType type{ primitives[run_first].type };
+            size_t run_end{ run_first + 1 };
+            while (run_end < primitives.size() && primitives[run_end].type == type) {
+                ++run_end;
+            }
+
+            const uint32_t first_index{ primitives[run_first].index };
+            const auto count{ static_cast<uint32_t>(run_end - run_first) };
+            if (type == PrimitiveType::Generic) {
+                for (uint32_t index = first_index; index < first_index + count; ++index) {
+                    if (visit_generic(index))
+                        return true;
+                }
+            } else if (visitBuiltInShapeHits(this->getPrimitiveTable(type), type, first_index, count, ray,
+                                             [&](const uint32_t index, const double t) {
+                                                 return visit_hit(type, index, t);
+                                             })) {
+                return true;
+            }
+            run_first = run_end;
+        }
+        return false;
+    }
+
+    Ray CompiledScene::transformToGenericPrimitive(const uint32_t index, const Ray& ray) const
+    {
+        // The composed matrix takes the ray from world space to object space in a single transform, however deeply
+        // the surface was nested
+        return ray.transform(this->getPrimitiveTable(PrimitiveType::Generic).world_to_object_transforms[index]);
+    }
+
+    Intersection CompiledScene::createIntersection(const PrimitiveType type,
+                                                   const uint32_t index,
+                                                   const double t) const
+    {
+        const PrimitiveTable& table{ this->getPrimitiveTable(type) };
+        Intersection intersection{ t, table.surfaces[index] };
+        intersection.setMaterialIndex(table.material_indices[index]);
+        return intersection;
+    }
+
+    void CompiledScene::findClosestHit(const std::span<const PrimitiveReference> primitives,
+                                       const Ray& ray,
+                                       const double t_min,
+                                       double& t_max,
+                                       std::optional<Intersection>& closest_hit) const
+    {
+        const PrimitiveTable& generic_table{ this->getPrimitiveTable(PrimitiveType::Generic) };
+        this->visitPrimitiveHits(
+                primitives, ray,
+                [&](const PrimitiveType type, const uint32_t index, const double t) {
+                    if (t >= t_min && t <= t_max) {
+                        closest_hit = this->createIntersection(type, index, t);
+                        t_max = t;
+                    }
+                    return false;
+                },
+                [&](const uint32_t index) {
+                    auto primitive_hit{ generic_table.surfaces[index]->calculateClosestIntersection(
+                            this->transformToGenericPrimitive(index, ray), t_min, t_max) };
+                    if (primitive_hit) {
+                        primitive_hit->setMaterialIndex(generic_table.material_indices[index]);
+                        closest_hit = primitive_hit;
+                        t_max = primitive_hit->getT();
+                    }
+                    return false;
+                });
+    }
+
+    void CompiledScene::getAllIntersections(const Ray& ray, std::vector<Intersection>& scene_intersections) const
+    {
+        scene_intersections.clear();
+        const PrimitiveTable& generic_table{ this->getPrimitiveTable(PrimitiveType::Generic) };
+        const auto append_intersections{ [&](const std::span<const PrimitiveReference> primitives) {
+            this->visitPrimitiveHits(
+                    primitives, ray,
+                    [&](const PrimitiveType type, const uint32_t index, const double t) {
+                        scene_intersections.push_back(this->createIntersection(type, index, t));
+                        return false;
+                    },
+                    [&](const uint32_t index) {
+                        const auto first_intersection{ static_cast<std::ptrdiff_t>(scene_intersections.size()) };
+                        generic_table.surfaces[index]->calculateIntersections(
+                                this->transformToGenericPrimitive(index, ray), scene_intersections);
+                        for (auto it = scene_intersections.begin() + first_intersection;
+                             it != scene_intersections.end(); ++it) {
+                            it->setMaterialIndex(generic_table.material_indices[index]);
+                        }
+                        return false;
+                    });
+        } };
+
+        constexpr double unbounded_t_max{ std::numeric_limits<double>::infinity() };
+        m_bvh.forEachCandidateLeaf(ray, -unbounded_t_max, unbounded_t_max,
+                                   [&](const uint32_t first, const uint32_t count) {
+            append_intersections(std::span{ m_bounded_primitives }.subspan(first, count));
+        });
+        append_intersections(m_unbounded_primitives);
+
+        std::sort(scene_intersections.begin(), scene_intersections.end());
+    }
+
+    std::optional<Intersection> CompiledScene::getClosestHit(const Ray& ray, const double t_min, double t_max) const
+    {
+        // Narrow the interval as each closer intersection is found, so more distant leaves can be skipped
+        std::optional<Intersection> closest_hit{ std::nullopt };
+        m_bvh.forEachCandidateLeaf(ray, t_min, t_max, [&](const uint32_t first, const uint32_t count) {
+            this->findClosestHit(std::span{ m_bounded_primitives }.subspan(first, count), ray, t_min, t_max,
+                                 closest_hit);
+        });
+        this->findClosestHit(m_unbounded_primitives, ray, t_min, t_max, closest_hit);
+
+        return closest_hit;
+    }
+
+    void CompiledScene::getClosestHits(const RayPacket& packet,
+                                       const std::span<std::optional<Intersection>> closest_hits) const
+    {
+        if (closest_hits.size() < packet.size())
+            throw std::invalid_argument{ "Closest hit list must have an element for every ray in the packet." };
+
+        // Narrow the interval of each ray as closer intersections are found, as for a single ray
+        constexpr double t_min{ 0 };
+        std::array<double, MAX_RAY_PACKET_SIZE> t_maxes{ };
+        t_maxes.fill(std::numeric_limits<double>::infinity());
+        std::fill_n(closest_hits.begin(), packet.size(), std::nullopt);
+
+        m_bvh.forEachCandidateLeaf(packet, t_min, t_maxes,
+                                   [&](const uint32_t first, const uint32_t count, uint32_t ray_mask) {
+            const auto leaf_primitives{ std::span{ m_bounded_primitives }.subspan(first, count) };
+            for (; ray_mask != 0; ray_mask &= ray_mask - 1) {
+                const auto ray_index{ static_cast<size_t>(std::countr_zero(ray_mask)) };
+                this->findClosestHit(leaf_primitives, packet.getRayAt(ray_index), t_min, t_maxes[ray_index],
+                                     closest_hits[ray_index]);
+            }
+        });
+        for (size_t ray_index = 0; ray_index < packet.size(); ++ray_index) {
+            this->findClosestHit(m_unbounded_primitives, packet.getRayAt(ray_index), t_min, t_maxes[ray_index],
+                                 closest_hits[ray_index]);
+        }
+    }
+
+    bool CompiledScene::hasIntersectionWithin(const Ray& ray, const double t_min, const double t_max) const
+    {
+        const PrimitiveTable& generic_table{ this->getPrimitiveTable(PrimitiveType::Generic) };
+        const auto is_any_intersected_within{ [&](const std::span<const PrimitiveReference> primitives) {
+            return this->visitPrimitiveHits(
+                    primitives, ray,
+                    [&](PrimitiveType, uint32_t, const double t) {
+                        return t >= t_min && utils::isLess(t, t_max);
+                    },
+                    [&](const uint32_t index) {
+                        return generic_table.surfaces[index]->checkForIntersectionWithin(
+                                this->transformToGenericPrimitive(index, ray), t_min, t_max);
+                    });
+        } };
+
+        return
+                m_bvh.anyOfCandidateLeaves(ray, t_min, t_max, [&](const uint32_t first, const uint32_t count) {
+                    return is_any_intersected_within(std::span{ m_bounded_primitives }.subspan(first, count));
+                }) ||
+                is_any_intersected_within(m_unbounded_primitives);
+    }
+
+    bool CompiledScene::isShadowed(const Vector4& point) const
+    {
+        // Cast a ray towards the light source, the point is shadowed if any primitive lies between it and the light
+        const Vector4 light_source_displacement{ m_light_source.position - point };
+        const Ray shadow_ray{ point, normalize(light_source_displacement) };
+        RenderStatisticsCollector::recordRay(RayType::Shadow);
+        return this->hasIntersectionWithin(shadow_ray, 0, light_source_displacement.magnitude());
+    }
+
+    Color CompiledScene::calculatePixelColor(const Ray& ray, const int remaining_bounces) const
+    {
+        const RenderStatisticsCollector::RecursionScope recursion_scope{ };
+
+        const auto possible_hit{ this->getClosestHit(ray) };
+        return possible_hit ? this->calculateHitColor(ray, possible_hit.value(), remaining_bounces) : black();
+    }
+
+    void CompiledScene::calculatePixelColors(const RayPacket& packet,
+                                             const std::span<Color> pixel_colors,
+                                             const int remaining_bounces) const
+    {
+        if (pixel_colors.size() < packet.size())
+            throw std::invalid_argument{ "Pixel color list must have an element for every ray in the packet." };
+
+        std::array<std::optional<Intersection>, MAX_RAY_PACKET_SIZE> closest_hits{ };
+        this->getClosestHits(packet, closest_hits);
+        for (size_t ray_index = 0; ray_index < packet.size(); ++ray_index) {
+            const RenderStatisticsCollector::RecursionScope recursion_scope{ };
+            const auto& possible_hit{ closest_hits[ray_index] };
+            pixel_colors[ray_index] = possible_hit ?
+                    this->calculateHitColor(packet.getRayAt(ray_index), possible_hit.value(), remaining_bounces) :
+                    black();
+        }
+    }
+
+    Color CompiledScene::calculateHitColor(const Ray& ray, const Intersection& hit, const int remaining_bounces) const
+    {
+        // Pre-compute values to utilize in shadow, reflection, and refraction calculations
+        const DetailedIntersection detailed_hit{ hit, ray };
+
+        // Only transparent surfaces need the full list of intersections, which is used to determine the refractive
+        // indices of any overlapping surfaces the hit lies within. Each level of recursion has its own list on each
+        // thread, since a list must remain intact while reflected and refracted rays are traced. The lists are
+        // stored in a deque so that adding a level does not move the lists of outer levels.
+        thread_local std::deque<std::vector<Intersection>> intersection_lists{ };
+        const auto recursion_level{ static_cast<size_t>(std::max(remaining_bounces, 0)) };
+        if (intersection_lists.size() <= recursion_level) {
+            intersection_lists.resize(recursion_level + 1);
+        }
+        std::vector<Intersection>& scene_intersections{ intersection_lists[recursion_level] };
+        scene_intersections.clear();
+
+        const Material& hit_material{ this->getMaterial(hit) };
+        if (utils::areNotEqual(hit_material.getProperties().transparency, 0.0)) {
+            this->getAllIntersections(ray, scene_intersections);
+        }
+
+        const bool is_shadowed{ this->isShadowed(detailed_hit.getOverPoint()) };
+        const Color reflected_color{ this->calculateReflectedColorAt(detailed_hit, remaining_bounces) };
+        const Color refracted_color{ this->calculateRefractedColorAt(detailed_hit,
+                                                                     scene_intersections,
+                                                                     remaining_bounces) };
+
+        const Color object_color{ detailed_hit.getObject().getObjectColorAt(detailed_hit.getOverPoint(),
+                                                                            this->getCompiledTexture(hit)) };
+        const Color surface_color{ calculateSurfaceColor(object_color,
+                                                         hit_material.getProperties(),
+                                                         m_light_source,
+                                                         detailed_hit.getOverPoint(),
+                                                         detailed_hit.getSurfaceNormal(),
+                                                         detailed_hit.getViewVector(),
+                                                         is_shadowed) };
+
+        // Apply the Fresnel effect for reflective transparent materials
+        if (utils::isGreater(hit_material.getProperties().reflectivity, 0.0) &&
+            utils::isGreater(hit_material.getProperties().transparency, 0.0))
+        {
+            const auto [ n1, n2 ] { getRefractiveIndices(detailed_hit, scene_intersections) };
+            const double reflectance{ calculateReflectance(detailed_hit.getViewVector(),
+                                                           detailed_hit.getSurfaceNormal(),
+                                                           n1, n2) };
+            return surface_color + (reflected_color * reflectance) + (refracted_color * (1 - reflectance));
+        }
+
+        return surface_color + reflected_color + refracted_color;
+    }
+
+    Color CompiledScene::calculateReflectedColorAt(const DetailedIntersection& intersection,
+                                                   const int remaining_bounces) const
+    {
+        const double reflectivity{ this->getMaterial(intersection).getProperties().reflectivity };
+        if (utils::areEqual(reflectivity, 0.0) || remaining_bounces <= 0) {
+            return black();
+        }
+
+        const Ray reflection_ray{ intersection.getOverPoint(), intersection.getReflectionVector() };
+        RenderStatisticsCollector::recordRay(RayType::Reflection);
+        return reflectivity * this->calculatePixelColor(reflection_ray, remaining_bounces - 1);
+    }
+
+    Color CompiledScene::calculateRefractedColorAt(const DetailedIntersection& intersection,
+                                                   const std::vector<Intersection>& possible_overlaps,
+                                                   const int remaining_bounces) const
+    {
+        const double transparency{ this->getMaterial(intersection).getProperties().transparency };
+        if (utils::areEqual(transparency, 0.0) || remaining_bounces <= 0) {
+            return black();
+        }
+
+        const auto [ n1, n2 ] { getRefractiveIndices(intersection, possible_overlaps) };
+        const auto refraction_ray{ calculateRefractionRay(intersection, n1, n2) };
+        if (!refraction_ray) {
+            return black();
+        }
+
+        RenderStatisticsCollector::recordRay(RayType::Refraction);
+        return transparency * this->calculatePixelColor(refraction_ray.value(), remaining_bounces - 1);
+    }
+
+    std::string formatCompiledSceneStatistics(const CompiledSceneStatistics& statistics)
+    {
+        constexpr std::array<std::string_view, PRIMITIVE_TYPE_COUNT> primitive_type_names{
+            "Sphere", "Plane", "Cube", "Cylinder", "Cone", "Triangle", "Generic" };
+        constexpr double bytes_per_kibibyte{ 1024.0 };
+        const auto to_kibibytes{ [&](const size_t byte_count) {
+            return static_cast<double>(byte_count) / bytes_per_kibibyte;
+        } };
+
+        std::string output{ std::format("{:<24} {:>16}\n", "Primitives", "Count") };
+        for (size_t i = 0; i < PRIMITIVE_TYPE_COUNT; ++i) {
+            output += std::format("{:<24} {:>16}\n", primitive_type_names[i], statistics.primitive_counts[i]);
+        }
+        output += std::format("{:<24} {:>16}\n", "Total", statistics.getTotalPrimitiveCount());
+        output += std::format("{:<24} {:>16}\n", "Unbounded", statistics.unbounded_primitive_count);
+        output += std::format("{:<24} {:>16}\n", "Surface Materials", statistics.surface_material_count);
+        output += std::format("{:<24} {:>16}\n", "Unique Materials", statistics.material_count);
+        output += std::format("{:<24} {:>16}\n\n", "BVH Nodes", statistics.bvh_node_count);
+
+        output += std::format("{:<24} {:>16}\n", "Memory", "KiB");
+        output += std::format("{:<24} {:>16.1f}\n", "Primitive Tables", to_kibibytes(statistics.primitive_table_bytes));
+        output += std::format("{:<24} {:>16.1f}\n", "Material Table", to_kibibytes(statistics.material_table_bytes));
+        output += std::format("{:<24} {:>16.1f}\n", "BVH", to_kibibytes(statistics.bvh_bytes));
+        output += std::format("{:<24} {:>16.1f}\n\n", "Total", to_kibibytes(statistics.getTotalBytes()));
+
+        const std::chrono::duration<double, std::milli> compile_time{ statistics.compile_time };
+        output += std::format("{:<24} {:>16.2f}\n", "Compile Time (ms)", compile_time.count());
+
+        return output;
+    }
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "light.hpp"
+#include "material.hpp"
+#include "compiled_texture.hpp"
+#include "matrix4.hpp"
+#include "vector4.hpp"
+#include "ray.hpp"
+#include "ray_packet.hpp"
+#include "intersection.hpp"
+#include "bounding_volume_hierarchy.hpp"
+
+namespace gfx {
+    /* Forward Declarations */
+    class Object;
+    class Surface;
+    class World;
+
+    // Categories of surfaces stored in the primitive tables of a compiled scene
+    enum class PrimitiveType : uint8_t {
+        Sphere,
+        Plane,
+        Cube,
+        Cylinder,
+        Cone,
+        Triangle,
+        Generic     // Any other surface, such as a triangle mesh, which is intersected through its virtual methods
+    };
+    constexpr size_t PRIMITIVE_TYPE_COUNT{ 7 };
+
+    // Measures of the size of a compiled scene and the time taken to compile it
+    struct CompiledSceneStatistics {
+        std::array<size_t, PRIMITIVE_TYPE_COUNT> primitive_counts{ };
+        size_t unbounded_primitive_count{ 0 };
+        size_t surface_material_count{ 0 };     // Materials referenced by the surfaces, before deduplication
+        size_t material_count{ 0 };
+        size_t bvh_node_count{ 0 };             // Wide nodes, as the binary nodes are not kept
+        size_t primitive_table_bytes{ 0 };
+        size_t material_table_bytes{ 0 };       // Includes the compiled texture nodes, but not the original textures
+        size_t bvh_bytes{ 0 };
+        std::chrono::nanoseconds compile_time{ 0 };
+
+        [[nodiscard]] size_t getTotalPrimitiveCount() const;
+        [[nodiscard]] size_t getTotalBytes() const;
+    };
+
+    // An immutable, render-optimized copy of a world. Composite surfaces are flattened into their leaf surfaces,
+    // whose composed world-to-object matrices, shape parameters, and material indices are stored in a table for each
+    // type of primitive, with each column held in its own list. Materials are deduplicated into a single table, with
+    // the texture of each compiled once into a list of nodes for shading, and every bounded primitive is placed in
+    // one bounding volume hierarchy, rather than a hierarchy for the world and one for each group. The primitives
+    // of each leaf are grouped by type and numbered in leaf order, so that a ray is tested against each group with a
+    // loop specialized for its type rather than a virtual call per primitive.
+    // The intersections returned point back at the world's surfaces, so the world must outlive the compiled scene,
+    // and its objects must not be modified while the compiled scene is in use.
+    class CompiledScene
+    {
+    public:
+        // The columns of the primitive table for one type of primitive, each indexed by the primitive's position
+        // within the table. Columns which do not apply to the type of primitive are left empty.
+        struct PrimitiveTable {
+            // The top three rows of each world-to-object matrix in row-major order, one column per element. Built-in
+            // shapes are only stored with affine matrices, whose bottom row is always (0, 0, 0, 1).
+            std::array<std::vector<double>, 12> transform_columns{ };
+
+            // Full world-to-object matrices, only stored for generic primitives
+            std::vector<Matrix4> world_to_object_transforms{ };
+
+            std::vector<const Surface*> surfaces{ };
+            std::vector<uint32_t> material_indices{ };
+
+            // Bounds and end caps of cylinders and cones. The flags are stored as 32-bit integers rather than bytes,
+            // since a loop reading bytes alongside doubles is vectorized over more primitives than a batch holds.
+            std::vector<double> y_mins{ };
+            std::vector<double> y_maxes{ };
+            std::vector<uint32_t> closed_flags{ };
+
+            // Object space vertices and edges of triangles, one column per coordinate
+            std::array<std::vector<double>, 3> vertex_a_columns{ };
+            std::array<std::vector<double>, 3> edge_a_columns{ };
+            std::array<std::vector<double>, 3> edge_b_columns{ };
+
+            [[nodiscard]] size_t size() const
+            { return surfaces.size(); }
+
+            // Returns the world-to-object matrix of a primitive
+            [[nodiscard]] Matrix4 getWorldToObjectTransform(size_t index) const;
+
+            // Returns the number of bytes allocated by the columns of the table
+            [[nodiscard]] size_t getAllocatedBytes() const;
+        };
+
+        // Locates a primitive within the table of its type
+        struct PrimitiveReference {
+            PrimitiveType type{ PrimitiveType::Generic };
+            uint32_t index{ 0 };
+        };
+
+        /* Constructors */
+
+        // Default Constructor
+        CompiledScene() = delete;
+
+        // Standard Constructor, compiling the objects and light source of a world
+        explicit CompiledScene(const World& world);
+
+        // Copy Constructor
+        CompiledScene(const CompiledScene&) = default;
+
+        // Move Constructor
+        CompiledScene(CompiledScene&&) = default;
+
+        /* Destructor */
+
+        ~CompiledScene() = default;
+
+        /* Assignment Operators */
+
+        CompiledScene& operator=(const CompiledScene&) = delete;
+        CompiledScene& operator=(CompiledScene&&) = delete;
+
+        /* Accessors */
+
+        [[nodiscard]] const PointLight& getLightSource() const
+        { return m_light_source; }
+
+        [[nodiscard]] const PrimitiveTable& getPrimitiveTable(const PrimitiveType type) const
+        { return m_primitive_tables[static_cast<size_t>(type)]; }
+
+        [[nodiscard]] size_t getPrimitiveCount() const
+        { return m_bounded_primitives.size() + m_unbounded_primitives.size(); }
+
+        [[nodiscard]] size_t getMaterialCount() const
+        { return m_materials.size(); }
+
+        [[nodiscard]] const Material& getMaterialAt(const size_t material_index) const
+        { return m_materials.at(material_index); }
+
+        // Returns the material of the surface intersected by a hit found in this scene
+        [[nodiscard]] const Material& getMaterial(const Intersection& hit) const
+        { return m_materials[hit.getMaterialIndex()]; }
+
+        // Returns the compiled texture of the material of the surface intersected by a hit found in this scene
+        [[nodiscard]] const CompiledTexture& getCompiledTexture(const Intersection& hit) const
+        { return m_compiled_textures[hit.getMaterialIndex()]; }
+
+        [[nodiscard]] const BoundingVolumeHierarchy& getBoundingVolumeHierarchy() const
+        { return m_bvh; }
+
+        [[nodiscard]] const CompiledSceneStatistics& getStatistics() const
+        { return m_statistics; }
+
+        /* Ray-Tracing Operations */
+
+        // Replaces the contents of the passed-in list with the sorted list of all intersections with a ray, reusing
+        // the list's existing storage
+        void getAllIntersections(const Ray& ray, std::vector<Intersection>& scene_intersections) const;
+
+        // Returns the intersection closest to the ray origin with a t-value within the interval [t_min, t_max]
+        [[nodiscard]] std::optional<Intersection> getClosestHit(
+                const Ray& ray,
+                double t_min = 0,
+                double t_max = std::numeric_limits<double>::infinity()) const;
+
+        // Writes the intersection closest to the origin of each ray in a packet to the matching element of the
+        // passed-in list, or nullopt for rays which miss every primitive
+        void getClosestHits(const RayPacket& packet, std::span<std::optional<Intersection>> closest_hits) const;
+
+        // Returns true if any primitive intersects the ray at a t-value satisfying t_min <= t < t_max, stopping at
+        // the first such intersection found
+        [[nodiscard]] bool hasIntersectionWithin(const Ray& ray, double t_min, double t_max) const;
+
+        // Returns true if the passed-in position is in shadow
+        [[nodiscard]] bool isShadowed(const Vector4& point) const;
+
+        // Returns the pixel color for a ray, shading each hit with the material table
+        [[nodiscard]] Color calculatePixelColor(const Ray& ray, int remaining_bounces = 5) const;
+
+        // Writes the pixel color for each ray in a packet to the matching element of the passed-in list, finding
+        // the closest hits for the whole packet at once
+        void calculatePixelColors(const RayPacket& packet,
+                                  std::span<Color> pixel_colors,
+                                  int remaining_bounces = 5) const;
+
+        // Returns the reflected color at an intersection found in this scene
+        [[nodiscard]] Color calculateReflectedColorAt(const DetailedIntersection& intersection,
+                                                      int remaining_bounces = 5) const;
+
+        // Returns the refracted color at an intersection found in this scene, using the passed-in intersections
+        // along the same ray to find the refractive indices on either side of the surface
+        [[nodiscard]] Color calculateRefractedColorAt(const DetailedIntersection& intersection,
+                                                      const std::vector<Intersection>& possible_overlaps,
+                                                      int remaining_bounces = 5) const;
+
+    private:
+        /* Data Members */
+
+        PointLight m_light_source;
+        std::array<PrimitiveTable, PRIMITIVE_TYPE_COUNT> m_primitive_tables{ };
+        std::vector<Material> m_materials{ };
+        std::vector<CompiledTexture> m_compiled_textures{ };   // The texture of each material, in the same order
+        BoundingVolumeHierarchy m_bvh{ };
+        std::vector<PrimitiveReference> m_bounded_primitives{ };     // Primitives in the order of the hierarchy leaves
+        std::vector<PrimitiveReference> m_unbounded_primitives{ };   // Primitives with infinite bounds, i.e. planes
+        CompiledSceneStatistics m_statistics{ };
+
+        /* Helper Types */
+
+        // A leaf surface found while flattening the world, before it is placed in the table of its type
+        struct PrimitiveRecord {
+            const Surface* surface{ nullptr };
+            Matrix4 world_to_object_transform{ };
+            PrimitiveType type{ PrimitiveType::Generic };
+            uint32_t material_index{ 0 };
+        };
+
+        /* Compilation Helper Methods */
+
+        // Records the leaf surfaces of an object, sorting them into bounded and unbounded primitives and appending
+        // the world space bounds of each bounded primitive to the passed-in list
+        void addObject(const Object& object,
+                       const Matrix4& parent_to_world_transform,
+                       std::vector<PrimitiveRecord>& bounded_records,
+                       std::vector<PrimitiveRecord>& unbounded_records,
+                       std::vector<BoundingBox>& primitive_bounds);
+
+        // Sorts a range of primitives by type and appends them to the tables in that order, writing a reference to
+        // each into the matching element of the passed-in list
+        void addPrimitives(std::span<const PrimitiveRecord*> records, std::span<PrimitiveReference> references);
+
+        // Appends a primitive to the table of its type
+        void addPrimitive(const PrimitiveRecord& record);
+
+        // Returns the index of a material in the material table, adding it if no equal material is found
+        [[nodiscard]] uint32_t addMaterial(const Material& material);
+
+        // Fills in the primitive counts and memory usage of the compiled scene
+        void measureStatistics();
+
+        /* Intersection Helper Methods */
+
+        // Intersects a ray with a list of primitives grouped by type, calling the passed-in visitor with the table
+        // index and t-value of every intersection with a built-in shape, and the generic visitor with the table index
+        // of each generic primitive. Stops as soon as either visitor returns true, returning true if so.
+        template<typename HitVisitor, typename GenericVisitor>
+        bool visitPrimitiveHits(std::span<const PrimitiveReference> primitives,
+                                const Ray& ray,
+                                HitVisitor&& visit_hit,
+                                GenericVisitor&& visit_generic) const;
+
+        // Returns the ray transformed into the object space of a generic primitive
+        [[nodiscard]] Ray transformToGenericPrimitive(uint32_t index, const Ray& ray) const;
+
+        // Returns an intersection with a built-in shape, tagged with the index of its material
+        [[nodiscard]] Intersection createIntersection(PrimitiveType type, uint32_t index, double t) const;
+
+        // Finds the closest intersection of a ray within [t_min, t_max] among a list of primitives grouped by type,
+        // narrowing the interval as closer hits are found
+        void findClosestHit(std::span<const PrimitiveReference> primitives,
+                            const Ray& ray,
+                            double t_min,
+                            double& t_max,
+                            std::optional<Intersection>& closest_hit) const;
+
+        /* Shading Helper Methods */
+
+        // Returns the color at the intersection of a ray with a primitive, tracing any shadow, reflected, and
+        // refracted rays it spawns
+        [[nodiscard]] Color calculateHitColor(const Ray& ray, const Intersection& hit, int remaining_bounces) const;
+    };
+
+    /* Statistics Output */
+
+    // Returns a table summarizing the primitives, materials, and memory of a compiled scene and its compile time
+    [[nodiscard]] std::string formatCompiledSceneStatistics(const CompiledSceneStatistics& statistics);
+}
@@ -0,0 +1,737 @@
+#include "gtest/gtest.h"
+#include "compiled_scene.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "world.hpp"
+#include "composite_surface.hpp"
+#include "sphere.hpp"
+#include "plane.hpp"
+#include "cube.hpp"
+#include "cylinder.hpp"
+#include "cone.hpp"
+#include "triangle.hpp"
+#include "material.hpp"
+#include "intersection.hpp"
+#include "shading_functions.hpp"
+#include "pattern_texture_3d.hpp"
+#include "stripe_pattern_3d.hpp"
+#include "checkered_pattern_3d.hpp"
+#include "transform.hpp"
+#include "ray.hpp"
+#include "ray_packet.hpp"
+#include "util_functions.hpp"
+
+namespace {
+    // Returns a world of every shape type, with a reflective floor, a glass sphere, and nested groups whose material
+    // and transforms are passed down to their children
+    gfx::World createMixedWorld()
+    {
+        const gfx::Material red_material{ gfx::Color{ 1, 0, 0 } };
+        const gfx::Material glass_material{ gfx::Color{ 0, 0, 0 },
+                                            gfx::MaterialProperties{ .reflectivity = 0.5,
+                                                                     .transparency = 0.9,
+                                                                     .refractive_index = 1.5 } };
+
+        const auto inner_group_ptr{ std::make_shared<gfx::CompositeSurface>(
+                gfx::createScalingMatrix(0.5),
+                std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(-1, 0, 0)),
+                std::make_shared<gfx::Cube>(gfx::createTranslationMatrix(1, 0, 0))) };
+        const auto outer_group_ptr{ std::make_shared<gfx::CompositeSurface>(
+                gfx::createTranslationMatrix(0, 0.5, 2) * gfx::createYRotationMatrix(M_PI_4),
+                inner_group_ptr,
+                std::make_shared<gfx::Cylinder>(gfx::createTranslationMatrix(0, 0, 2), -1, 1, true)) };
+        outer_group_ptr->addMaterial(gfx::Material{ gfx::Color{ 0, 0, 1 } });
+
+        return gfx::World{
+                gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) },
+                outer_group_ptr,
+                std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(-2, 0, 0), red_material),
+                std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(2, 0, 0), red_material),
+                std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(0.5, 0, -2) *
+                                              gfx::createScalingMatrix(0.75), glass_material),
+                std::make_shared<gfx::Cone>(gfx::createTranslationMatrix(-3, 0, 3), -1, 0, true),
+                std::make_shared<gfx::Cone>(gfx::createTranslationMatrix(5, 0, 10)),
+                std::make_shared<gfx::Triangle>(gfx::createPoint(-1, 2, 1),
+                                                gfx::createPoint(1, 2, 1),
+                                                gfx::createPoint(0, 3, 1)),
+                std::make_shared<gfx::Plane>(gfx::createTranslationMatrix(0, -1, 0),
+                                             gfx::Material{ gfx::MaterialProperties{ .reflectivity = 0.3 } }) };
+    }
+
+    // Returns the default world from the book, a light source and two concentric spheres
+    gfx::World createDefaultWorld()
+    {
+        return gfx::World{ gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) },
+                           gfx::Sphere{ gfx::Material{ gfx::Color{ 0.8, 1.0, 0.6 },
+                                                       gfx::MaterialProperties{ .ambient = 0.1,
+                                                                                .diffuse = 0.7,
+                                                                                .specular = 0.2 } } },
+                           gfx::Sphere{ gfx::createScalingMatrix(0.5) } };
+    }
+
+    // Returns a world of many randomly placed, rotated, and scaled primitives of every built-in type, some of them
+    // nested within groups, so that the leaves of the compiled scene's hierarchy hold runs of several types
+    gfx::World createRandomPrimitiveWorld(const size_t primitive_count)
+    {
+        std::mt19937 generator{ 7 };
+        std::uniform_real_distribution<double> position_distribution{ -10, 10 };
+        std::uniform_real_distribution<double> scale_distribution{ 0.2, 0.8 };
+        std::uniform_real_distribution<double> angle_distribution{ 0, M_PI };
+
+        gfx::World world{ };
+        auto group_ptr{ std::make_shared<gfx::CompositeSurface>(gfx::createTranslationMatrix(0, 0, 5)) };
+        for (size_t i = 0; i < primitive_count; ++i) {
+            const gfx::Matrix4 transform{ gfx::createTranslationMatrix(position_distribution(generator),
+                                                                       position_distribution(generator),
+                                                                       position_distribution(generator)) *
+                                          gfx::createXRotationMatrix(angle_distribution(generator)) *
+                                          gfx::createYRotationMatrix(angle_distribution(generator)) *
+                                          gfx::createScalingMatrix(scale_distribution(generator)) };
+            std::shared_ptr<gfx::Object> primitive_ptr{ };
+            switch (i % 6) {
+                case 0:
+                    primitive_ptr = std::make_shared<gfx::Sphere>(transform);
+                    break;
+                case 1:
+                    primitive_ptr = std::make_shared<gfx::Cube>(transform);
+                    break;
+                case 2:
+                    primitive_ptr = std::make_shared<gfx::Cylinder>(transform, -1, 1, i % 4 == 0);
+                    break;
+                case 3:
+                    primitive_ptr = std::make_shared<gfx::Cone>(transform, -1, 0.5, i % 4 == 1);
+                    break;
+                default: {
+                    auto triangle_ptr{ std::make_shared<gfx::Triangle>(gfx::createPoint(0, 1, 0),
+                                                                       gfx::createPoint(-1, 0, 0),
+                                                                       gfx::createPoint(1, 0, 0)) };
+                    triangle_ptr->setTransform(transform);
+                    primitive_ptr = triangle_ptr;
+                    break;
+                }
+            }
+
+            if (i % 5 == 0) {
+                group_ptr->addChild(primitive_ptr);
+            } else {
+                world.addObject(primitive_ptr);
+            }
+        }
+        world.addObject(group_ptr);
+        world.addObject(std::make_shared<gfx::Plane>(gfx::createTranslationMatrix(0, -12, 0)));
+        world.finalize();
+        return world;
+    }
+
+    // Returns rays cast from a point in front of the scene through a grid spanning it
+    std::vector<gfx::Ray> createRayGrid()
+    {
+        std::vector<gfx::Ray> rays{ };
+        const gfx::Vector4 origin{ gfx::createPoint(0, 1, -8) };
+        for (int y = -6; y <= 6; ++y)
+            for (int x = -8; x <= 8; ++x) {
+                rays.emplace_back(origin, gfx::normalize(gfx::createPoint(x * 0.5, y * 0.5, 3) - origin));
+            }
+        return rays;
+    }
+}
+
+// Tests compiling a world into primitive tables and a material table
+TEST(GraphicsCompiledScene, CompileWorld)
+{
+    const gfx::World world{ createMixedWorld() };
+    const gfx::CompiledScene scene{ world };
+
+    // Test that the groups are flattened into their leaf surfaces
+    EXPECT_EQ(scene.getPrimitiveCount(), 10);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Sphere).size(), 4);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Plane).size(), 1);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Cube).size(), 1);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Cylinder).size(), 1);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Cone).size(), 2);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Triangle).size(), 1);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Generic).size(), 0);
+    EXPECT_EQ(scene.getBoundingVolumeHierarchy().getPrimitiveCount(), 8);
+
+    // Test that the world transforms are composed through every group
+    const gfx::CompiledScene::PrimitiveTable& sphere_table{ scene.getPrimitiveTable(gfx::PrimitiveType::Sphere) };
+    const gfx::Matrix4 nested_world_to_object_expected{
+            gfx::createTranslationMatrix(-1, 0, 0).inverse() *
+            gfx::createScalingMatrix(0.5).inverse() *
+            (gfx::createTranslationMatrix(0, 0.5, 2) * gfx::createYRotationMatrix(M_PI_4)).inverse() };
+    const auto nested_sphere_iter{ std::find_if(sphere_table.surfaces.begin(), sphere_table.surfaces.end(),
+                                                [](const gfx::Surface* const surface) {
+                                                    return surface->hasParent();
+                                                }) };
+    ASSERT_NE(nested_sphere_iter, sphere_table.surfaces.end());
+    const auto nested_sphere_index{ static_cast<size_t>(nested_sphere_iter - sphere_table.surfaces.begin()) };
+    EXPECT_EQ(sphere_table.getWorldToObjectTransform(nested_sphere_index), nested_world_to_object_expected);
+    EXPECT_EQ((*nested_sphere_iter)->getWorldToObjectTransform(), nested_world_to_object_expected);
+
+    // Test that the shape parameters are stored alongside the transforms
+    const gfx::CompiledScene::PrimitiveTable& cylinder_table{
+            scene.getPrimitiveTable(gfx::PrimitiveType::Cylinder) };
+    EXPECT_EQ(cylinder_table.y_mins, std::vector<double>{ -1 });
+    EXPECT_EQ(cylinder_table.y_maxes, std::vector<double>{ 1 });
+    EXPECT_EQ(cylinder_table.closed_flags, std::vector<uint32_t>{ 1 });
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Triangle).edge_b_columns[1], std::vector<double>{ 1 });
+    EXPECT_TRUE(sphere_table.y_mins.empty());
+
+    // Test that equal materials share an entry, and that each surface references the material it is drawn with
+    EXPECT_EQ(scene.getMaterialCount(), 5);
+    EXPECT_EQ(sphere_table.material_indices[nested_sphere_index], cylinder_table.material_indices[0]);
+    for (size_t type_index = 0; type_index < gfx::PRIMITIVE_TYPE_COUNT; ++type_index) {
+        const auto& table{ scene.getPrimitiveTable(static_cast<gfx::PrimitiveType>(type_index)) };
+        for (size_t i = 0; i < table.size(); ++i) {
+            EXPECT_EQ(scene.getMaterialAt(table.material_indices[i]), table.surfaces[i]->getMaterial());
+        }
+    }
+
+    // Test the reported size of the compiled scene
+    const gfx::CompiledSceneStatistics& statistics{ scene.getStatistics() };
+    EXPECT_EQ(statistics.getTotalPrimitiveCount(), 10);
+    EXPECT_EQ(statistics.unbounded_primitive_count, 2);
+    EXPECT_EQ(statistics.surface_material_count, 10);
+    EXPECT_EQ(statistics.material_count, 5);
+    EXPECT_EQ(statistics.bvh_node_count, scene.getBoundingVolumeHierarchy().getNodeCount());
+    EXPECT_GE(statistics.primitive_table_bytes, 10 * 12 * sizeof(double));
+    EXPECT_GE(statistics.material_table_bytes, 5 * sizeof(gfx::Material));
+    EXPECT_GT(statistics.bvh_bytes, 0);
+    EXPECT_EQ(statistics.getTotalBytes(),
+              statistics.primitive_table_bytes + statistics.material_table_bytes + statistics.bvh_bytes);
+    EXPECT_NE(gfx::formatCompiledSceneStatistics(statistics).find("Compile Time"), std::string::npos);
+}
+
+// Tests that a compiled scene finds the same intersections as the world it was compiled from
+TEST(GraphicsCompiledScene, IntersectionsMatchWorld)
+{
+    gfx::World world{ createMixedWorld() };
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+
+    std::vector<gfx::Intersection> world_intersections{ };
+    std::vector<gfx::Intersection> scene_intersections{ };
+    size_t hit_count{ 0 };
+    for (const gfx::Ray& ray : createRayGrid()) {
+        const auto world_hit{ world.getClosestHit(ray) };
+        const auto scene_hit{ scene.getClosestHit(ray) };
+        ASSERT_EQ(scene_hit.has_value(), world_hit.has_value());
+        if (world_hit) {
+            EXPECT_EQ(scene_hit.value(), world_hit.value());
+            EXPECT_EQ(scene.getMaterial(scene_hit.value()), scene_hit->getObject().getMaterial());
+            ++hit_count;
+        }
+
+        world.getAllIntersections(ray, world_intersections);
+        scene.getAllIntersections(ray, scene_intersections);
+        EXPECT_EQ(scene_intersections, world_intersections);
+
+        EXPECT_EQ(scene.hasIntersectionWithin(ray, 0, 9), world.hasIntersectionWithin(ray, 0, 9));
+    }
+
+    // Test that most of the grid hits the scene, so the comparison is meaningful
+    EXPECT_GT(hit_count, createRayGrid().size() / 2);
+
+    // Test intersecting a packet of rays
+    gfx::RayPacket packet{ };
+    const std::vector<gfx::Ray> rays{ createRayGrid() };
+    for (size_t i = 0; i < gfx::MAX_RAY_PACKET_SIZE; ++i) {
+        packet.addRay(rays[i * 7 + 60]);
+    }
+    std::vector<std::optional<gfx::Intersection>> closest_hits(gfx::MAX_RAY_PACKET_SIZE);
+    scene.getClosestHits(packet, closest_hits);
+    for (size_t i = 0; i < packet.size(); ++i) {
+        EXPECT_EQ(closest_hits[i], scene.getClosestHit(packet.getRayAt(i)));
+    }
+}
+
+// Tests that the closest hits found for a packet match those found for each of its rays on their own
+TEST(GraphicsCompiledScene, GetClosestHitsPacket)
+{
+    gfx::World world{ };
+    for (int x = -3; x <= 3; ++x) {
+        for (int z = -3; z <= 3; ++z) {
+            world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(x * 2.5, 0, z * 2.5) });
+        }
+    }
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0) });
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+
+    gfx::RayPacket packet{ };
+    for (int i = 0; i < 16; ++i) {
+        packet.addRay(gfx::Ray{ gfx::createPoint((i % 4) * 0.8 - 2, 0.5 - (i / 4) * 0.5, -12),
+                                gfx::normalize(gfx::createVector(0.05 * (i % 4), -0.1 * (i % 3), 1)) });
+    }
+    std::array<std::optional<gfx::Intersection>, gfx::MAX_RAY_PACKET_SIZE> hits_actual{ };
+    scene.getClosestHits(packet, hits_actual);
+
+    for (size_t i = 0; i < packet.size(); ++i) {
+        const auto hit_expected{ scene.getClosestHit(packet.getRayAt(i)) };
+        ASSERT_EQ(hits_actual[i].has_value(), hit_expected.has_value());
+        if (hit_expected) {
+            EXPECT_EQ(hits_actual[i].value(), hit_expected.value());
+        }
+    }
+
+    std::array<std::optional<gfx::Intersection>, 8> too_few_hits{ };
+    EXPECT_THROW(scene.getClosestHits(packet, too_few_hits), std::invalid_argument);
+}
+
+// Tests that shading a packet matches shading each of its rays on their own, including misses
+TEST(GraphicsCompiledScene, CalculatePixelColorsPacket)
+{
+    const gfx::World world{ createDefaultWorld() };
+    const gfx::CompiledScene scene{ world };
+    const std::array<gfx::Ray, 3> rays{ gfx::Ray{ 0, 0, -5, 0, 0, 1 },
+                                        gfx::Ray{ 0, 0, -5, 0, 1, 0 },
+                                        gfx::Ray{ 0, 0, 0.75, 0, 0, -1 } };
+    const gfx::RayPacket packet{ rays };
+
+    std::array<gfx::Color, 3> pixel_colors_actual{ };
+    scene.calculatePixelColors(packet, pixel_colors_actual);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        EXPECT_EQ(pixel_colors_actual[i], scene.calculatePixelColor(rays[i]));
+    }
+    EXPECT_EQ(pixel_colors_actual[1], gfx::black());
+
+    std::array<gfx::Color, 2> too_few_pixel_colors{ };
+    EXPECT_THROW(scene.calculatePixelColors(packet, too_few_pixel_colors), std::invalid_argument);
+}
+
+// Tests that shading the rays of a packet together gives the same colors as shading them one at a time, including
+// rays which pass through reflective and transparent surfaces
+TEST(GraphicsCompiledScene, CalculatePixelColorsMixedWorld)
+{
+    const gfx::World world{ createMixedWorld() };
+    const gfx::CompiledScene scene{ world };
+
+    const std::vector<gfx::Ray> rays{ createRayGrid() };
+    std::array<gfx::Color, gfx::MAX_RAY_PACKET_SIZE> pixel_colors{ };
+    for (size_t first = 0; first < rays.size(); first += gfx::MAX_RAY_PACKET_SIZE) {
+        gfx::RayPacket packet{ };
+        for (size_t i = first; i < std::min(first + gfx::MAX_RAY_PACKET_SIZE, rays.size()); ++i) {
+            packet.addRay(rays[i]);
+        }
+
+        scene.calculatePixelColors(packet, pixel_colors);
+        for (size_t i = 0; i < packet.size(); ++i) {
+            EXPECT_EQ(pixel_colors[i], scene.calculatePixelColor(packet.getRayAt(i)));
+        }
+    }
+}
+
+// Test shading a color when a ray misses all primitives in a scene
+TEST(GraphicsCompiledScene, CalculatePixelColorMiss)
+{
+    const gfx::World world{ createDefaultWorld() };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, -5,
+                        0, 1, 0 };
+
+    const gfx::Color pixel_color_expected{ 0, 0, 0 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Test shading a color when a ray hits a primitive from the outside
+TEST(GraphicsCompiledScene, CalculatePixelColorHitOutside)
+{
+    const gfx::World world{ createDefaultWorld() };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, -5,
+                        0, 0, 1 };
+
+    const gfx::Color pixel_color_expected{ 0.380661, 0.475827, 0.285496 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Test shading a color when a ray hits a primitive from the inside
+TEST(GraphicsCompiledScene, CalculatePixelColorHitInside)
+{
+    const gfx::MaterialProperties properties{ .diffuse = 0.7, .specular = 0.2 };
+    const gfx::Material material{ 0.8, 1.0, 0.6, properties };
+
+    const gfx::Sphere sphere_a{ material };
+    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5) };
+    const gfx::PointLight light_source{ gfx::Color{ 1, 1, 1 },
+                                        gfx::createPoint(0, 0.25, 0) };
+    const gfx::World world{ light_source, sphere_a, sphere_b };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, 0,
+                        0, 0, 1 };
+
+    const gfx::Color pixel_color_expected{ 0.904984, 0.904984, 0.904984 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Test shading a color when a ray intersection is behind the ray origin
+TEST(GraphicsCompiledScene, CalculatePixelColorHitBehind)
+{
+    const gfx::MaterialProperties properties_a{ .ambient = 1, .diffuse = 0.7, .specular = 0.2 };
+    const gfx::Material sphere_a_material{ 0.8, 1.0, 0.6, properties_a };
+    const gfx::Sphere sphere_a{ sphere_a_material };
+
+    const gfx::Material sphere_b_material{ gfx::MaterialProperties{ .ambient = 1 } };
+    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5), sphere_b_material };
+
+    const gfx::PointLight light_source{ gfx::Color{ 1, 1, 1 },
+                                        gfx::createPoint(0, 0.25, 0) };
+    const gfx::World world{ light_source, sphere_a, sphere_b };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, 0.75,
+                        0, 0, -1 };
+
+    const gfx::Color pixel_color_expected{ gfx::white() };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Tests shading a color when a ray intersection point is in shadow
+TEST(GraphicsCompiledScene, CalculatePixelColorInShadow)
+{
+    const gfx::Sphere sphere_a{ };
+    const gfx::Sphere sphere_b{ gfx::createTranslationMatrix(0, 0, 10) };
+    const gfx::PointLight light_source{ gfx::Color{ 1, 1, 1 },
+                                        gfx::createPoint(0, 0, -10) };
+    const gfx::World world{ light_source, sphere_a, sphere_b };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, 5,
+                        0, 0, 1 };
+
+    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
+    const auto possible_hit{ scene.getClosestHit(ray) };
+
+    ASSERT_TRUE(possible_hit);
+    const gfx::Intersection intersection_expected{ 4, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(1)) };
+    EXPECT_EQ(possible_hit.value(), intersection_expected);
+
+    const gfx::Color pixel_color_expected{ 0.1, 0.1, 0.1 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Tests calculating the reflected color for a non-reflective material
+TEST(GraphicsCompiledScene, CalculateReflectedColorNonReflective)
+{
+    const gfx::World world{ createDefaultWorld() };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, 0,
+                        0, 0, 1 };
+
+    const auto possible_hit{ scene.getClosestHit(ray) };
+    ASSERT_TRUE(possible_hit);
+    const gfx::DetailedIntersection detailed_intersection{ possible_hit.value(), ray };
+
+    const gfx::Color color_expected{ gfx::black() };
+    const gfx::Color color_actual{ scene.calculateReflectedColorAt(detailed_intersection) };
+    EXPECT_EQ(color_actual, color_expected);
+}
+
+// Tests calculating the reflected color for a reflective material
+TEST(GraphicsCompiledScene, CalculateReflectedColorReflective)
+{
+    gfx::World world{ createDefaultWorld() };
+    const gfx::Material plane_material{ gfx::MaterialProperties{ .reflectivity = 0.5 } };
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0), plane_material });
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+
+    const gfx::Ray ray{ 0, 0, -3,
+                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
+
+    const auto possible_hit{ scene.getClosestHit(ray) };
+    ASSERT_TRUE(possible_hit);
+    const gfx::DetailedIntersection intersection{ possible_hit.value(), ray };
+
+    const gfx::Color color_expected{ 0.190331, 0.237913, 0.142748 };
+    const gfx::Color color_actual{ scene.calculateReflectedColorAt(intersection) };
+    EXPECT_EQ(color_actual, color_expected);
+}
+
+// Tests shading a color on a surface with a reflective material
+TEST(GraphicsCompiledScene, CalculatePixelColorReflectiveMaterial)
+{
+    gfx::World world{ createDefaultWorld() };
+    const gfx::Material plane_material{ gfx::MaterialProperties{ .reflectivity = 0.5 } };
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0), plane_material });
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+
+    const gfx::Ray ray{ 0, 0, -3,
+                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
+
+    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
+    const auto possible_hit{ scene.getClosestHit(ray) };
+
+    ASSERT_TRUE(possible_hit);
+    const gfx::Intersection intersection_expected{ M_SQRT2, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(2)) };
+    EXPECT_EQ(possible_hit.value(), intersection_expected);
+
+    const gfx::Color pixel_color_expected{ 0.876756, 0.924339, 0.829173 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Tests calculating the refracted color for an opaque material
+TEST(GraphicsCompiledScene, CalculateRefractedColorOpaque)
+{
+    const gfx::World world{ createDefaultWorld() };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, -5,
+                        0, 0, 1 };
+
+    std::vector<gfx::Intersection> scene_intersections{ };
+    scene.getAllIntersections(ray, scene_intersections);
+    const gfx::DetailedIntersection hit{ scene_intersections[0], ray };
+
+    const gfx::Color color_expected{ gfx::black() };
+    const gfx::Color color_actual{ scene.calculateRefractedColorAt(hit, scene_intersections) };
+    EXPECT_EQ(color_actual, color_expected);
+}
+
+// Tests calculating the refracted color at the maximum recursive depth
+TEST(GraphicsCompiledScene, CalculateRefractedColorMaximumDepth)
+{
+    const gfx::World world{ createDefaultWorld() };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, -5,
+                        0, 0, 1 };
+
+    std::vector<gfx::Intersection> scene_intersections{ };
+    scene.getAllIntersections(ray, scene_intersections);
+    const gfx::DetailedIntersection hit{ scene_intersections[0], ray };
+
+    const gfx::Color color_expected{ gfx::black() };
+    const gfx::Color color_actual{ scene.calculateRefractedColorAt(hit, scene_intersections, 0) };
+    EXPECT_EQ(color_actual, color_expected);
+}
+
+// Tests calculating the refracted color under total internal reflection
+TEST(GraphicsCompiledScene, CalculateRefractedColorTotalInternalReflection)
+{
+    const gfx::MaterialProperties properties_a{ .diffuse = 0.7,
+                                                .specular = 0.2,
+                                                .transparency = 1,
+                                                .refractive_index = 1.5 };
+    const gfx::Material sphere_a_material{ 0.8, 1.0, 0.6, properties_a };
+    const gfx::Sphere sphere_a{ sphere_a_material };
+    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5) };
+
+    const gfx::World world{ sphere_a, sphere_b };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, M_SQRT2 / 2,
+                        0, 1, 0 };
+
+    std::vector<gfx::Intersection> scene_intersections{ };
+    scene.getAllIntersections(ray, scene_intersections);
+    const gfx::DetailedIntersection hit{ scene_intersections[1], ray };
+
+    const gfx::Color color_expected{ gfx::black() };
+    const gfx::Color color_actual{ scene.calculateRefractedColorAt(hit, scene_intersections) };
+    EXPECT_EQ(color_actual, color_expected);
+}
+
+// Tests calculating the refracted color using refraction rays
+TEST(GraphicsCompiledScene, CalculateRefractedColor)
+{
+    const gfx::MaterialProperties properties_a{ .ambient = 1, .diffuse = 0.7, .specular = 0.2 };
+    const TestPattern3D sphere_a_texture{ };
+    const gfx::Material sphere_a_material{ sphere_a_texture, properties_a };
+    const gfx::Sphere sphere_a{ sphere_a_material };
+
+    const gfx::MaterialProperties properties_b{ .transparency = 1, .refractive_index = 1.5 };
+    const gfx::Material sphere_b_material{ properties_b };
+    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5), sphere_b_material };
+
+    const gfx::World world{ sphere_a, sphere_b };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, 0.1,
+                        0, 1, 0 };
+
+    std::vector<gfx::Intersection> scene_intersections{ };
+    scene.getAllIntersections(ray, scene_intersections);
+    const gfx::DetailedIntersection hit{ scene_intersections[2], ray };
+
+    const gfx::Color color_expected{ 0, 0.998883, 0.047216 };
+    const gfx::Color color_actual{ scene.calculateRefractedColorAt(hit, scene_intersections) };
+    EXPECT_EQ(color_actual, color_expected);
+}
+
+// Tests shading pixels in a refractive (transparent) material
+TEST(GraphicsCompiledScene, CalculatePixelColorTransparentMaterial)
+{
+    gfx::World world{ createDefaultWorld() };
+    const gfx::Material floor_material{ gfx::MaterialProperties{ .transparency = 0.5, .refractive_index = 1.5 } };
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0), floor_material });
+    const gfx::Material ball_material{ 1, 0, 0, gfx::MaterialProperties{ .ambient = 0.5 } };
+    world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(0, -3.5, -0.5), ball_material });
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+
+    const gfx::Ray ray{ 0, 0, -3,
+                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
+
+    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
+    const auto possible_hit{ scene.getClosestHit(ray) };
+
+    ASSERT_TRUE(possible_hit);
+    const gfx::Intersection intersection_expected{ M_SQRT2, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(2)) };
+    EXPECT_EQ(possible_hit.value(), intersection_expected);
+
+    const gfx::Color pixel_color_expected{ 0.936425, 0.686425, 0.686425 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Tests shading pixels in a material that is both refractive and reflective
+TEST(GraphicsCompiledScene, CalculatePixelColorReflectiveTransparentMaterial)
+{
+    gfx::World world{ createDefaultWorld() };
+    const gfx::MaterialProperties floor_material_properties{ .reflectivity = 0.5,
+                                                             .transparency = 0.5,
+                                                             .refractive_index = 1.5 };
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0), gfx::Material{ floor_material_properties } });
+    const gfx::Material ball_material{ 1, 0, 0, gfx::MaterialProperties{ .ambient = 0.5 } };
+    world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(0, -3.5, -0.5), ball_material });
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+
+    const gfx::Ray ray{ 0, 0, -3,
+                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
+
+    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
+    const auto possible_hit{ scene.getClosestHit(ray) };
+
+    ASSERT_TRUE(possible_hit);
+    const gfx::Intersection intersection_expected{ M_SQRT2, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(2)) };
+    EXPECT_EQ(possible_hit.value(), intersection_expected);
+
+    const gfx::Color pixel_color_expected{ 0.933915, 0.696434, 0.692431 };
+    const gfx::Color pixel_color_actual{ scene.calculatePixelColor(ray) };
+
+    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+}
+
+// Tests that the texture of each material is compiled once and shades to the same colors as the original textures
+TEST(GraphicsCompiledScene, CompiledTextures)
+{
+    const gfx::Material striped_material{ gfx::StripePattern3D{ gfx::createScalingMatrix(0.25), gfx::white(),
+                                                                gfx::red() } };
+    const gfx::Material checkered_material{ gfx::CheckeredPattern3D{ gfx::createYRotationMatrix(M_PI_4),
+                                                                     gfx::blue(), gfx::green() } };
+    gfx::World world{ gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) },
+                      std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(-1.5, 1, 0), striped_material),
+                      std::make_shared<gfx::Cube>(gfx::createTranslationMatrix(1.5, 1, 0), striped_material),
+                      std::make_shared<gfx::Plane>(gfx::createTranslationMatrix(0, -1, 0), checkered_material) };
+    world.finalize();
+    const gfx::CompiledScene scene{ world };
+    EXPECT_EQ(scene.getMaterialCount(), 2);
+
+    for (const gfx::Ray& ray : createRayGrid()) {
+        const auto scene_hit{ scene.getClosestHit(ray) };
+        if (!scene_hit) {
+            EXPECT_EQ(scene.calculatePixelColor(ray), gfx::black());
+            continue;
+        }
+
+        const gfx::Vector4 hit_point{ ray.position(scene_hit->getT()) };
+        EXPECT_EQ(scene_hit->getObject().getObjectColorAt(hit_point, scene.getCompiledTexture(scene_hit.value())),
+                  scene_hit->getObject().getObjectColorAt(hit_point));
+
+        // None of the materials reflect or refract, so each pixel is the surface color shaded with the original texture
+        const gfx::DetailedIntersection detailed_hit{ scene_hit.value(), ray };
+        const bool is_shadowed{ scene.isShadowed(detailed_hit.getOverPoint()) };
+        const gfx::Color pixel_color_expected{ gfx::calculateSurfaceColor(detailed_hit.getObject(),
+                                                                          scene.getLightSource(),
+                                                                          detailed_hit.getOverPoint(),
+                                                                          detailed_hit.getSurfaceNormal(),
+                                                                          detailed_hit.getViewVector(),
+                                                                          is_shadowed) };
+        EXPECT_EQ(scene.calculatePixelColor(ray), pixel_color_expected);
+    }
+}
+
+// Tests that the batched intersection kernels find the same intersections as the virtual methods of each shape
+TEST(GraphicsCompiledScene, BatchedIntersectionsMatchWorld)
+{
+    const gfx::World world{ createRandomPrimitiveWorld(1200) };
+    const gfx::CompiledScene scene{ world };
+    EXPECT_EQ(scene.getPrimitiveCount(), 1201);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Triangle).size(), 400);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Generic).size(), 0);
+
+    std::mt19937 generator{ 11 };
+    std::uniform_real_distribution<double> target_distribution{ -10, 10 };
+    std::vector<gfx::Intersection> world_intersections{ };
+    std::vector<gfx::Intersection> scene_intersections{ };
+    size_t hit_count{ 0 };
+    size_t shadow_count{ 0 };
+    for (size_t i = 0; i < 500; ++i) {
+        const gfx::Vector4 origin{ gfx::createPoint(target_distribution(generator), target_distribution(generator),
+                                                    -30) };
+        const gfx::Vector4 target{ gfx::createPoint(target_distribution(generator), target_distribution(generator),
+                                                    target_distribution(generator)) };
+        const gfx::Ray ray{ origin, gfx::normalize(target - origin) };
+
+        const auto world_hit{ world.getClosestHit(ray) };
+        const auto scene_hit{ scene.getClosestHit(ray) };
+        ASSERT_EQ(scene_hit.has_value(), world_hit.has_value());
+        if (world_hit) {
+            EXPECT_EQ(scene_hit.value(), world_hit.value());
+            EXPECT_EQ(scene.getMaterial(scene_hit.value()), scene_hit->getObject().getMaterial());
+            ++hit_count;
+        }
+
+        world.getAllIntersections(ray, world_intersections);
+        scene.getAllIntersections(ray, scene_intersections);
+        ASSERT_EQ(scene_intersections.size(), world_intersections.size());
+        for (size_t j = 0; j < world_intersections.size(); ++j) {
+            EXPECT_TRUE(utils::areEqual(scene_intersections[j].getT(), world_intersections[j].getT()));
+        }
+
+        const bool is_world_blocked{ world.hasIntersectionWithin(ray, 0, 25) };
+        EXPECT_EQ(scene.hasIntersectionWithin(ray, 0, 25), is_world_blocked);
+        shadow_count += is_world_blocked ? 1 : 0;
+    }
+
+    // Test that the rays hit and miss often enough for the comparison to cover both outcomes
+    EXPECT_GT(hit_count, 100);
+    EXPECT_GT(shadow_count, 50);
+    EXPECT_LT(shadow_count, 500);
+}
+
+// Tests that a surface with a projective transform is intersected through its virtual methods
+TEST(GraphicsCompiledScene, ProjectiveTransformUsesGenericTable)
+{
+    gfx::Matrix4 projective_transform{ gfx::createIdentityMatrix() };
+    projective_transform[3, 2] = 0.01;
+    const gfx::World world{ std::make_shared<gfx::Sphere>(projective_transform),
+                            std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(0, 3, 0)) };
+    const gfx::CompiledScene scene{ world };
+
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Generic).size(), 1);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Sphere).size(), 1);
+    EXPECT_EQ(scene.getPrimitiveTable(gfx::PrimitiveType::Generic).getWorldToObjectTransform(0),
+              projective_transform.inverse());
+
+    const gfx::Ray ray{ gfx::createPoint(0, 0, -5), gfx::createVector(0, 0, 1) };
+    EXPECT_EQ(scene.getClosestHit(ray), world.getClosestHit(ray));
+}
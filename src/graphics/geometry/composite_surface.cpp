@@ -13,6 +13,10 @@ namespace gfx {
         this->setParentForAllChildren(this);
         m_bounds = rhs.m_bounds;
         m_material = rhs.m_material;
+        m_bvh = rhs.m_bvh;
+        m_bounded_child_indices = rhs.m_bounded_child_indices;
+        m_unbounded_child_indices = rhs.m_unbounded_child_indices;
+        m_is_divided = rhs.m_is_divided;
 
         return *this;
     }
@@ -25,6 +29,10 @@ namespace gfx {
         this->setParentForAllChildren(this);
         m_bounds = rhs.m_bounds;
         m_material = std::move(rhs.m_material);
+        m_bvh = std::move(rhs.m_bvh);
+        m_bounded_child_indices = std::move(rhs.m_bounded_child_indices);
+        m_unbounded_child_indices = std::move(rhs.m_unbounded_child_indices);
+        m_is_divided = rhs.m_is_divided;
 
         return *this;
     }
@@ -36,6 +44,7 @@ namespace gfx {
         cloned_object_ptr->setParent(this);
         m_children.push_back(cloned_object_ptr);
         m_bounds.mergeWithBox(cloned_object_ptr->getLocalSpaceBounds());
+        this->clearHierarchy();
     }
 
     // Object Inserter (from pointer)
@@ -44,23 +53,139 @@ namespace gfx {
         object_ptr->setParent(this);
         m_children.push_back(object_ptr);
         m_bounds.mergeWithBox(object_ptr->getLocalSpaceBounds());
+        this->clearHierarchy();
+    }
+
+    // Bounding Volume Hierarchy Builder
+    void CompositeSurface::divide(const size_t max_leaf_size)
+    {
+        // Children with infinite extents cannot be partitioned spatially, so they are kept in a separate list that
+        // is tested against every ray, with the remaining children placed in the hierarchy
+        std::vector<BoundingBox> bounded_child_bounds{ };
+        m_bounded_child_indices.clear();
+        m_unbounded_child_indices.clear();
+        for (size_t child_index = 0; child_index < m_children.size(); ++child_index) {
+            const BoundingBox child_bounds{ m_children[child_index]->getLocalSpaceBounds() };
+            if (isFiniteBoundingBox(child_bounds)) {
+                bounded_child_bounds.push_back(child_bounds);
+                m_bounded_child_indices.push_back(child_index);
+            } else {
+                m_unbounded_child_indices.push_back(child_index);
+            }
+        }
+
+        m_bvh = BoundingVolumeHierarchy{ bounded_child_bounds, max_leaf_size, BvhSplitMethod::SurfaceAreaHeuristic };
+        m_is_divided = true;
+    }
+
+    // World Transform Cache Builder
+    void CompositeSurface::cacheWorldTransform()
+    {
+        // Children compose their transforms with this group's, so the group must be cached first
+        Object::cacheWorldTransform();
+        for (const auto& child_ptr : m_children) {
+            child_ptr->cacheWorldTransform();
+        }
+    }
+
+    // World Transform Cache Invalidator
+    void CompositeSurface::invalidateWorldTransform()
+    {
+        Object::invalidateWorldTransform();
+        for (const auto& child_ptr : m_children) {
+            child_ptr->invalidateWorldTransform();
+        }
     }
 
     // Intersections with Child Object(s) in a Composite Surface
-    std::vector<Intersection> CompositeSurface::calculateIntersections(const Ray& transformed_ray) const
+    void CompositeSurface::calculateIntersections(const Ray& transformed_ray,
+                                                  std::vector<Intersection>& intersections) const
     {
         // Check if ray intersects bounding box
-        std::vector<Intersection> intersections{ };
         if (!m_bounds.isIntersectedBy(transformed_ray))
-            return intersections;
+            return;
+
+        const auto first_intersection{ static_cast<std::ptrdiff_t>(intersections.size()) };
+
+        // Aggregate intersections across all children, only testing children whose bounding volumes are intersected
+        // by the ray once the group has been divided
+        if (m_is_divided) {
+            m_bvh.forEachCandidate(transformed_ray, [&](const uint32_t bvh_index) {
+                m_children[m_bounded_child_indices[bvh_index]]->appendObjectIntersections(transformed_ray,
+                                                                                          intersections);
+            });
+            for (const size_t child_index : m_unbounded_child_indices) {
+                m_children[child_index]->appendObjectIntersections(transformed_ray, intersections);
+            }
+        } else {
+            for (const auto& object_ptr : m_children) {
+                object_ptr->appendObjectIntersections(transformed_ray, intersections);
+            }
+        }
+
+        // Sort only the intersections with this group, leaving any earlier entries in the list untouched
+        std::sort(intersections.begin() + first_intersection, intersections.end());
+    }
+
+    // Closest Intersection with Child Object(s) in a Composite Surface
+    std::optional<Intersection> CompositeSurface::calculateClosestIntersection(const Ray& transformed_ray,
+                                                                               const double t_min,
+                                                                               double t_max) const
+    {
+        // Check if ray intersects bounding box within the interval
+        std::optional<Intersection> closest_intersection{ std::nullopt };
+        if (!m_bounds.isIntersectedBy(transformed_ray, t_min, t_max))
+            return closest_intersection;
+
+        // Narrow the interval as each closer intersection is found, so more distant children can be skipped
+        const auto test_child{ [&](const Object& child) {
+            const auto child_intersection{ child.getClosestIntersection(transformed_ray, t_min, t_max) };
+            if (child_intersection) {
+                closest_intersection = child_intersection;
+                t_max = child_intersection->getT();
+            }
+        } };
+
+        if (m_is_divided) {
+            m_bvh.forEachCandidate(transformed_ray, t_min, t_max, [&](const uint32_t bvh_index) {
+                test_child(*m_children[m_bounded_child_indices[bvh_index]]);
+            });
+            for (const size_t child_index : m_unbounded_child_indices) {
+                test_child(*m_children[child_index]);
+            }
+        } else {
+            for (const auto& object_ptr : m_children) {
+                test_child(*object_ptr);
+            }
+        }
+
+        return closest_intersection;
+    }
+
+    // Any Intersection with Child Object(s) in a Composite Surface
+    bool CompositeSurface::checkForIntersectionWithin(const Ray& transformed_ray,
+                                                      const double t_min,
+                                                      const double t_max) const
+    {
+        if (!m_bounds.isIntersectedBy(transformed_ray, t_min, t_max))
+            return false;
 
-        // Aggregate intersections across all children
-        for (const auto& object_ptr : m_children) {
-            intersections.append_range(object_ptr->getObjectIntersections(transformed_ray));
+        const auto is_child_intersected{ [&](const std::shared_ptr<Object>& child_ptr) {
+            return child_ptr->hasIntersectionWithin(transformed_ray, t_min, t_max);
+        } };
+
+        if (m_is_divided) {
+            return
+                    m_bvh.anyOfCandidates(transformed_ray, t_min, t_max, [&](const uint32_t bvh_index) {
+                        return is_child_intersected(m_children[m_bounded_child_indices[bvh_index]]);
+                    }) ||
+                    std::any_of(m_unbounded_child_indices.begin(), m_unbounded_child_indices.end(),
+                                [&](const size_t child_index) {
+                                    return is_child_intersected(m_children[child_index]);
+                                });
         }
 
-        std::sort(intersections.begin(), intersections.end());
-        return intersections;
+        return std::any_of(m_children.begin(), m_children.end(), is_child_intersected);
     }
 
     // Composite Surface Object Equivalency Check
@@ -94,6 +219,15 @@ namespace gfx {
         }
     }
 
+    // Bounding Volume Hierarchy Reset Helper Method
+    void CompositeSurface::clearHierarchy()
+    {
+        m_bvh = BoundingVolumeHierarchy{ };
+        m_bounded_child_indices.clear();
+        m_unbounded_child_indices.clear();
+        m_is_divided = false;
+    }
+
     // Composite Surface Bounding Volume Calculator
     BoundingBox CompositeSurface::calculateBounds() const
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "object.hpp"
+#include "bounding_volume_hierarchy.hpp"
 
 #include "material.hpp"
 
@@ -64,7 +65,11 @@ namespace gfx {
                 : Object(src.getTransform()),
                   m_children { src.m_children },
                   m_material{ src.m_material },
-                  m_bounds{ src.m_bounds }
+                  m_bounds{ src.m_bounds },
+                  m_bvh{ src.m_bvh },
+                  m_bounded_child_indices{ src.m_bounded_child_indices },
+                  m_unbounded_child_indices{ src.m_unbounded_child_indices },
+                  m_is_divided{ src.m_is_divided }
         { this->setParentForAllChildren(this); }
 
         // Move Constructor
@@ -72,7 +77,11 @@ namespace gfx {
                 : Object(src.getTransform()),
                   m_children { std::move(src.m_children) },
                   m_material{ std::move(src.m_material) },
-                  m_bounds{ src.m_bounds }
+                  m_bounds{ src.m_bounds },
+                  m_bvh{ std::move(src.m_bvh) },
+                  m_bounded_child_indices{ std::move(src.m_bounded_child_indices) },
+                  m_unbounded_child_indices{ std::move(src.m_unbounded_child_indices) },
+                  m_is_divided{ src.m_is_divided }
         { this->setParentForAllChildren(this); }
 
         /* Destructor */
@@ -93,6 +102,9 @@ namespace gfx {
         [[nodiscard]] bool isEmpty() const
         { return m_children.empty(); }
 
+        [[nodiscard]] size_t getChildCount() const
+        { return m_children.size(); }
+
         // Primarily for testing purposes, will perform object slicing if is not cast to the proper derived class
         [[nodiscard]] const Object& getChildAt(const size_t index) const
         { return *m_children.at(index); }
@@ -106,12 +118,23 @@ namespace gfx {
         [[nodiscard]] BoundingBox getBounds() const override
         { return m_bounds; }
 
+        // Returns true if the children have been organized into a bounding volume hierarchy
+        [[nodiscard]] bool isDivided() const
+        { return m_is_divided; }
+
+        [[nodiscard]] const BoundingVolumeHierarchy& getBoundingVolumeHierarchy() const
+        { return m_bvh; }
+
         /* Mutators */
 
-        // Adds a single object as a child to the group
+        // Adds a single object as a child to the group, discarding the bounding volume hierarchy if one was built
         void addChild(const Object& object);
         void addChild(const std::shared_ptr<Object>& object_ptr);
 
+        // Organizes the children into a bounding volume hierarchy built with the surface area heuristic, storing at
+        // most max_leaf_size children per leaf. Nested composite surfaces are not divided by this call.
+        void divide(size_t max_leaf_size = DEFAULT_BVH_MAX_LEAF_SIZE);
+
         // Add a material to apply to all child objects in this composite surface
         void addMaterial(const Material& material)
         { m_material = material; }
@@ -120,6 +143,12 @@ namespace gfx {
         void removeMaterial()
         { m_material = std::nullopt; }
 
+        // Caches the composed world transforms of this group and every descendant
+        void cacheWorldTransform() override;
+
+        // Discards the cached world transforms of this group and every descendant
+        void invalidateWorldTransform() override;
+
         /* Object Operations */
 
         // Creates a clone of this group to be stored in an object list
@@ -132,10 +161,21 @@ namespace gfx {
         std::vector<std::shared_ptr<Object>> m_children{ };
         BoundingBox m_bounds{ };
         std::optional<Material> m_material{ std::nullopt };
+        BoundingVolumeHierarchy m_bvh{ };
+        std::vector<size_t> m_bounded_child_indices{ };      // Maps hierarchy primitive indices to children
+        std::vector<size_t> m_unbounded_child_indices{ };    // Children with infinite bounds, i.e. planes
+        bool m_is_divided{ false };
 
         /* Object Helper Method Overrides */
 
-        [[nodiscard]] std::vector<Intersection> calculateIntersections(const Ray& transformed_ray) const override;
+        void calculateIntersections(const Ray& transformed_ray,
+                                    std::vector<Intersection>& intersections) const override;
+        [[nodiscard]] std::optional<Intersection> calculateClosestIntersection(const Ray& transformed_ray,
+                                                                               double t_min,
+                                                                               double t_max) const override;
+        [[nodiscard]] bool checkForIntersectionWithin(const Ray& transformed_ray,
+                                                      double t_min,
+                                                      double t_max) const override;
         [[nodiscard]] bool areEquivalent(const Object& other_object) const override;
 
         /* Helper Methods */
@@ -151,6 +191,9 @@ namespace gfx {
         // Sets the parent pointer for all children in the group
         void setParentForAllChildren(CompositeSurface* parent_ptr) const;
 
+        // Discards the bounding volume hierarchy, reverting to testing every child against each ray
+        void clearHierarchy();
+
         // Calculates the extents of a bounding box enclosing the bounding boxes of each child
         [[nodiscard]] BoundingBox calculateBounds() const;
     };
@@ -10,6 +10,7 @@
 #include "transform.hpp"
 #include "sphere.hpp"
 #include "cylinder.hpp"
+#include "plane.hpp"
 #include "ray.hpp"
 #include "intersection.hpp"
 
@@ -357,6 +358,110 @@ TEST(GraphicsCompositeSurface, RayTransformedCompositeSurfaceIntersection)
     EXPECT_EQ(intersections.size(), 2);
 }
 
+// Tests dividing the children of a composite surface into a bounding volume hierarchy
+TEST(GraphicsCompositeSurface, Divide)
+{
+    gfx::CompositeSurface composite_surface{ gfx::Sphere{ },
+                                             gfx::Sphere{ gfx::createTranslationMatrix(5, 0, 0) },
+                                             gfx::Plane{ } };
+    EXPECT_FALSE(composite_surface.isDivided());
+
+    composite_surface.divide(1);
+    EXPECT_TRUE(composite_surface.isDivided());
+
+    // Planes have infinite bounds and are excluded from the hierarchy
+    EXPECT_EQ(composite_surface.getBoundingVolumeHierarchy().getPrimitiveCount(), 2);
+
+    // Copies share the divided state of the source
+    const gfx::CompositeSurface composite_surface_copy{ composite_surface };
+    EXPECT_TRUE(composite_surface_copy.isDivided());
+
+    // Adding a child discards the hierarchy
+    composite_surface.addChild(gfx::Sphere{ gfx::createTranslationMatrix(-5, 0, 0) });
+    EXPECT_FALSE(composite_surface.isDivided());
+    EXPECT_TRUE(composite_surface.getBoundingVolumeHierarchy().isEmpty());
+}
+
+// Tests that intersections with a divided composite surface match those of the undivided surface
+TEST(GraphicsCompositeSurface, RayDividedCompositeSurfaceIntersection)
+{
+    gfx::CompositeSurface composite_surface{ gfx::createScalingMatrix(2) };
+    for (int x = -5; x <= 5; ++x) {
+        for (int y = -5; y <= 5; ++y) {
+            composite_surface.addChild(gfx::Sphere{ gfx::createTranslationMatrix(x * 2.5, y * 2.5, (x * y) % 4) });
+        }
+    }
+    composite_surface.addChild(gfx::Cylinder{ gfx::createTranslationMatrix(0, 0, 3) });
+
+    std::vector<gfx::Ray> rays{ };
+    for (int i = 0; i < 48; ++i) {
+        rays.emplace_back(gfx::createPoint(i - 24, 24 - i, -30),
+                          gfx::normalize(gfx::createVector(0.01 * (i % 7), -0.02 * (i % 5), 1)));
+    }
+
+    std::vector<std::vector<gfx::Intersection>> intersections_expected{ };
+    for (const auto& ray : rays) {
+        intersections_expected.push_back(composite_surface.getObjectIntersections(ray));
+    }
+
+    composite_surface.divide(2);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const std::vector<gfx::Intersection> intersections{ composite_surface.getObjectIntersections(rays[i]) };
+        ASSERT_EQ(intersections.size(), intersections_expected[i].size());
+        for (size_t j = 0; j < intersections.size(); ++j) {
+            EXPECT_EQ(intersections[j], intersections_expected[i][j]);
+        }
+    }
+}
+
+// Tests finding the closest intersection with a composite surface within an interval
+TEST(GraphicsCompositeSurface, GetClosestIntersection)
+{
+    const gfx::Sphere sphere_a{ };
+    const gfx::Sphere sphere_b{ gfx::createTranslationMatrix(0, 0, -3) };
+    const gfx::Sphere sphere_c{ gfx::createTranslationMatrix(5, 0, 0) };
+    gfx::CompositeSurface composite_surface{ sphere_a, sphere_b, sphere_c };
+    const gfx::Ray ray{ 0, 0, -5,
+                        0, 0, 1 };
+
+    for (const bool is_divided : { false, true }) {
+        if (is_divided)
+            composite_surface.divide(1);
+
+        const auto closest_intersection{ composite_surface.getClosestIntersection(ray, 0, 100) };
+        ASSERT_TRUE(closest_intersection);
+        EXPECT_FLOAT_EQ(closest_intersection->getT(), 1);
+        EXPECT_EQ(closest_intersection->getObject(), sphere_b);
+
+        const auto interval_intersection{ composite_surface.getClosestIntersection(ray, 3.5, 100) };
+        ASSERT_TRUE(interval_intersection);
+        EXPECT_FLOAT_EQ(interval_intersection->getT(), 4);
+        EXPECT_EQ(interval_intersection->getObject(), sphere_a);
+
+        EXPECT_FALSE(composite_surface.getClosestIntersection(ray, 6.5, 100));
+    }
+}
+
+// Tests checking for any intersection with a composite surface within an interval
+TEST(GraphicsCompositeSurface, HasIntersectionWithin)
+{
+    gfx::CompositeSurface composite_surface{ gfx::Sphere{ },
+                                             gfx::Sphere{ gfx::createTranslationMatrix(0, 0, -3) },
+                                             gfx::Sphere{ gfx::createTranslationMatrix(5, 0, 0) } };
+    const gfx::Ray ray{ 0, 0, -5,
+                        0, 0, 1 };
+
+    for (const bool is_divided : { false, true }) {
+        if (is_divided)
+            composite_surface.divide(1);
+
+        EXPECT_TRUE(composite_surface.hasIntersectionWithin(ray, 0, 100));
+        EXPECT_TRUE(composite_surface.hasIntersectionWithin(ray, 3.5, 4.5));
+        EXPECT_FALSE(composite_surface.hasIntersectionWithin(ray, 0, 1));
+        EXPECT_FALSE(composite_surface.hasIntersectionWithin(ray, 6.5, 100));
+    }
+}
+
 // Tests finding the normal on a child object
 TEST(GraphicsCompositeSurface, GetSurfaceNormalChildObject)
 {
@@ -374,4 +479,40 @@ TEST(GraphicsCompositeSurface, GetSurfaceNormalChildObject)
     EXPECT_EQ(normal_actual, normal_expected);
 }
 
+// Tests caching the transforms composed through a child's ancestors and discarding them when an ancestor is transformed
+TEST(GraphicsCompositeSurface, CacheWorldTransform)
+{
+    const std::shared_ptr<gfx::Sphere> sphere_ptr{
+        std::make_shared<gfx::Sphere>(gfx::createTranslationMatrix(5, 0, 0))
+    };
+    const std::shared_ptr<gfx::CompositeSurface> composite_surface_child_ptr{
+        std::make_shared<gfx::CompositeSurface>(gfx::createScalingMatrix(1, 2, 3), sphere_ptr)
+    };
+    gfx::CompositeSurface composite_surface_parent{ gfx::createYRotationMatrix(M_PI_2), composite_surface_child_ptr };
+
+    const gfx::Vector4 point{ gfx::createPoint(1.7321, 1.1547, -5.5774) };
+    const gfx::Vector4 normal_expected{ sphere_ptr->getSurfaceNormalAt(point) };
+    EXPECT_FALSE(sphere_ptr->hasCachedWorldTransform());
+
+    // Test that the cached transforms match walking up through each parent
+    composite_surface_parent.cacheWorldTransform();
+    ASSERT_TRUE(sphere_ptr->hasCachedWorldTransform());
+    EXPECT_TRUE(composite_surface_child_ptr->hasCachedWorldTransform());
+    EXPECT_EQ(sphere_ptr->getSurfaceNormalAt(point), normal_expected);
+    const gfx::Matrix4 world_to_object_expected{ gfx::createTranslationMatrix(5, 0, 0).inverse() *
+                                                 gfx::createScalingMatrix(1, 2, 3).inverse() *
+                                                 gfx::createYRotationMatrix(M_PI_2).inverse() };
+    EXPECT_EQ(sphere_ptr->getWorldToObjectTransform(), world_to_object_expected);
+
+    // Test that transforming an ancestor discards the cache of each descendant
+    composite_surface_parent.setTransform(gfx::createIdentityMatrix());
+    EXPECT_FALSE(composite_surface_parent.hasCachedWorldTransform());
+    EXPECT_FALSE(composite_surface_child_ptr->hasCachedWorldTransform());
+    EXPECT_FALSE(sphere_ptr->hasCachedWorldTransform());
+    const gfx::Vector4 normal_untransformed_expected{ sphere_ptr->getSurfaceNormalAt(point) };
+    composite_surface_parent.cacheWorldTransform();
+    EXPECT_EQ(sphere_ptr->getSurfaceNormalAt(point), normal_untransformed_expected);
+    EXPECT_NE(normal_untransformed_expected, normal_expected);
+}
+
 #pragma clang diagnostic pop
\ No newline at end of file
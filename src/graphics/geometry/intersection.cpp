@@ -11,7 +11,8 @@ namespace gfx {
     DetailedIntersection::DetailedIntersection(const Intersection& intersection, const Ray& ray)
             : Intersection(intersection),
               m_intersection_position{ ray.position(intersection.getT()) },
-              m_surface_normal{ intersection.getObject().getSurfaceNormalAt(m_intersection_position) },
+              m_surface_normal{ intersection.getObject().getSurfaceNormalAt(m_intersection_position,
+                                                                                     intersection) },
               m_view_vector{ -ray.getDirection() },
               m_reflection_vector{ },
               m_over_point{ },
@@ -34,7 +35,7 @@ namespace gfx {
         m_under_point = m_intersection_position - m_surface_normal * utils::EPSILON;
     }
 
-    std::optional<Intersection> getHit(std::vector<Intersection> intersections)
+    std::optional<Intersection> getHit(const std::vector<Intersection>& intersections)
     {
         auto hit_iter = std::lower_bound(
                 intersections.begin(),
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <optional>
 
@@ -22,6 +23,15 @@ namespace gfx {
                 : m_t{ t }, m_object_ptr{ object_ptr }
         {}
 
+        // Primitive Constructor, for surfaces made up of many triangles
+        Intersection(const double t,
+                     const Surface* object_ptr,
+                     const uint32_t primitive_index,
+                     const double u,
+                     const double v)
+                : m_t{ t }, m_object_ptr{ object_ptr }, m_u{ u }, m_v{ v }, m_primitive_index{ primitive_index }
+        {}
+
         Intersection(const Intersection&) = default;
         Intersection(Intersection&&) = default;
 
@@ -42,6 +52,27 @@ namespace gfx {
         [[nodiscard]] const Surface& getObject() const
         { return *m_object_ptr; }
 
+        // Returns the index of the intersected triangle within a mesh, which is zero for all other surfaces
+        [[nodiscard]] uint32_t getPrimitiveIndex() const
+        { return m_primitive_index; }
+
+        // Returns the barycentric coordinates of the intersection, weighting the second and third triangle vertices
+        [[nodiscard]] double getU() const
+        { return m_u; }
+
+        [[nodiscard]] double getV() const
+        { return m_v; }
+
+        // Returns the index of the intersected surface's material within the material table of the compiled scene
+        // the intersection was found in, which is zero for intersections found outside of a compiled scene
+        [[nodiscard]] uint32_t getMaterialIndex() const
+        { return m_material_index; }
+
+        /* Mutators */
+
+        void setMaterialIndex(const uint32_t material_index)
+        { m_material_index = material_index; }
+
         /* Comparison Operator Overloads */
 
         [[nodiscard]] bool operator==(const Intersection& rhs) const;
@@ -57,6 +88,10 @@ namespace gfx {
 
         double m_t;
         const Surface* m_object_ptr;   // Shapes should always exist during the lifetime of the intersection
+        double m_u{ 0.0 };
+        double m_v{ 0.0 };
+        uint32_t m_primitive_index{ 0 };
+        uint32_t m_material_index{ 0 };     // Fills the padding after the primitive index
     };
 
     // An extension of the intersection class containing pre-computed state information
@@ -118,7 +153,7 @@ namespace gfx {
     /* Global Ray-Tracing Operations */
 
     // Returns the first ray-object intersection with a non-negative t-value, representing a hit
-    [[nodiscard]] std::optional<Intersection> getHit(std::vector<Intersection> intersections);
+    [[nodiscard]] std::optional<Intersection> getHit(const std::vector<Intersection>& intersections);
 
     // Returns a pair representing T-values for ray intersections with an axis-aligned bounding box
     [[nodiscard]] std::pair<double, double> calculateBoxIntersectionTs(const Ray& ray,
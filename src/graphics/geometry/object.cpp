@@ -1,6 +1,9 @@
 #include "object.hpp"
 
+#include <algorithm>
+
 #include "intersection.hpp"
+#include "util_functions.hpp"
 #include "composite_surface.hpp"
 
 namespace gfx {
@@ -20,17 +23,106 @@ namespace gfx {
 
 
     std::vector<Intersection> Object::getObjectIntersections(const Ray& ray) const
+    {
+        std::vector<Intersection> intersections{ };
+        this->appendObjectIntersections(ray, intersections);
+        return intersections;
+    }
+
+
+    void Object::appendObjectIntersections(const Ray& ray, std::vector<Intersection>& intersections) const
     {
         // Transform the ray to object space
         const Ray transformed_ray{ ray.transform(m_transform_inverse) };
 
-        // Calculate the intersections for this object and return
-        return this->calculateIntersections(transformed_ray);
+        // Calculate the intersections for this object
+        this->calculateIntersections(transformed_ray, intersections);
+    }
+
+
+    std::optional<Intersection> Object::getClosestIntersection(const Ray& ray,
+                                                               const double t_min,
+                                                               const double t_max) const
+    {
+        // Object space t-values match world space t-values, since the transformed ray direction is not normalized
+        const Ray transformed_ray{ ray.transform(m_transform_inverse) };
+        return this->calculateClosestIntersection(transformed_ray, t_min, t_max);
+    }
+
+
+    std::optional<Intersection> Object::calculateClosestIntersection(const Ray& transformed_ray,
+                                                                     const double t_min,
+                                                                     double t_max) const
+    {
+        // Calculate the intersections into storage reused across calls on this thread, removing them once checked so
+        // that nested queries from derived objects may share the storage
+        thread_local std::vector<Intersection> object_intersections{ };
+        const auto first_intersection{ static_cast<std::ptrdiff_t>(object_intersections.size()) };
+        this->calculateIntersections(transformed_ray, object_intersections);
+
+        std::optional<Intersection> closest_intersection{ std::nullopt };
+        for (auto it = object_intersections.begin() + first_intersection; it != object_intersections.end(); ++it) {
+            if (it->getT() >= t_min && it->getT() <= t_max) {
+                closest_intersection = *it;
+                t_max = it->getT();
+            }
+        }
+
+        object_intersections.erase(object_intersections.begin() + first_intersection, object_intersections.end());
+        return closest_intersection;
+    }
+
+
+    bool Object::hasIntersectionWithin(const Ray& ray, const double t_min, const double t_max) const
+    {
+        const Ray transformed_ray{ ray.transform(m_transform_inverse) };
+        return this->checkForIntersectionWithin(transformed_ray, t_min, t_max);
+    }
+
+
+    bool Object::checkForIntersectionWithin(const Ray& transformed_ray, const double t_min, const double t_max) const
+    {
+        // Calculate the intersections into storage reused across calls on this thread, as for closest intersections
+        thread_local std::vector<Intersection> object_intersections{ };
+        const auto first_intersection{ static_cast<std::ptrdiff_t>(object_intersections.size()) };
+        this->calculateIntersections(transformed_ray, object_intersections);
+
+        const bool is_intersected{ std::any_of(object_intersections.begin() + first_intersection,
+                                               object_intersections.end(),
+                                               [&](const Intersection& intersection) {
+            return intersection.getT() >= t_min && utils::isLess(intersection.getT(), t_max);
+        }) };
+
+        object_intersections.erase(object_intersections.begin() + first_intersection, object_intersections.end());
+        return is_intersected;
+    }
+
+
+    void Object::cacheWorldTransform()
+    {
+        m_world_to_object_transform = this->getWorldToObjectTransform();
+        m_normal_to_world_transform = m_world_to_object_transform.transpose();
+        m_is_world_transform_cached = true;
+    }
+
+
+    Matrix4 Object::getWorldToObjectTransform() const
+    {
+        if (m_is_world_transform_cached) {
+            return m_world_to_object_transform;
+        }
+
+        // Points pass through each ancestor's inverse transform from the root down before this object's own
+        return m_parent ? m_transform_inverse * m_parent->getWorldToObjectTransform() : m_transform_inverse;
     }
 
 
     Vector4 Object::transformToObjectSpace(const Vector4& point) const
     {
+        if (m_is_world_transform_cached) {
+            return m_world_to_object_transform * point;
+        }
+
         // Move up through the tree until the root object is found
         Vector4 transformed_point{ point };
         if (m_parent) {
@@ -44,6 +136,14 @@ namespace gfx {
 
     Vector4 Object::transformNormalToWorldSpace(const Vector4& local_normal) const
     {
+        // The inverse transpose of each level leaves the w-value of a vector out of the x, y, and z components of
+        // the next, so a single composed matrix gives the same direction as transforming through each level
+        if (m_is_world_transform_cached) {
+            Vector4 world_normal{ m_normal_to_world_transform * local_normal };
+            world_normal.resetW();
+            return normalize(world_normal);
+        }
+
         // Transform the normal vector from local space to world space
         Vector4 world_normal{ m_transform_inverse.transpose() * local_normal };
 
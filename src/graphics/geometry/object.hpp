@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "matrix4.hpp"
 #include "vector4.hpp"
 #include "bounding_box.hpp"
@@ -9,9 +12,14 @@ namespace gfx {
     class Ray;
     class Intersection;
     class CompositeSurface;
+    class CompiledScene;
 
     class Object
     {
+        // Compiled scenes transform rays into object space with precomputed matrices, then call the object space
+        // helpers directly
+        friend class CompiledScene;
+
     public:
         /* Constructors */
 
@@ -47,6 +55,14 @@ namespace gfx {
         [[nodiscard]] const CompositeSurface* getParent() const
         { return m_parent; }
 
+        // Returns true if the transforms composed through this object's ancestors have been cached
+        [[nodiscard]] bool hasCachedWorldTransform() const
+        { return m_is_world_transform_cached; }
+
+        // Returns the matrix transforming world space to this object's space, composing the inverse transforms of
+        // each ancestor unless they have been cached
+        [[nodiscard]] Matrix4 getWorldToObjectTransform() const;
+
         // Returns a bounding volume in object space (i.e. without a transformation applied)
         [[nodiscard]] virtual BoundingBox getBounds() const = 0;
 
@@ -55,14 +71,29 @@ namespace gfx {
 
         /* Mutators */
 
+        // Sets the transform, discarding the cached world transforms of this object and all of its descendants
         void setTransform(const Matrix4& transform_matrix)
         {
             m_transform = transform_matrix;
             m_transform_inverse = transform_matrix.inverse();
+            this->invalidateWorldTransform();
         }
 
         void setParent(CompositeSurface* const parent_group_ptr)
-        { m_parent = parent_group_ptr; }
+        {
+            m_parent = parent_group_ptr;
+            this->invalidateWorldTransform();
+        }
+
+        // Composes the transforms of this object and all of its ancestors into a single world-to-object matrix and
+        // its transpose for normals, so that shading points are transformed without walking up the tree. Composite
+        // surfaces also cache the transforms of their descendants. The cache is written without synchronization,
+        // so this should only be called while the scene is being assembled, such as by World::finalize().
+        virtual void cacheWorldTransform();
+
+        // Discards the cached world transforms of this object and any descendants, reverting to walking up the tree
+        virtual void invalidateWorldTransform()
+        { m_is_world_transform_cached = false; }
 
         /* Comparison Operator Overloads */
 
@@ -78,28 +109,62 @@ namespace gfx {
         // the passed-in ray intersects with this object
         [[nodiscard]] std::vector<Intersection> getObjectIntersections(const Ray& ray) const;
 
+        // Appends the intersections of the passed-in ray with this object to a list of intersections, so that a
+        // list reused across rays allocates no memory once it has grown to the required capacity
+        void appendObjectIntersections(const Ray& ray, std::vector<Intersection>& intersections) const;
+
+        // Returns the intersection closest to the ray origin with a t-value within the interval [t_min, t_max],
+        // if one exists
+        [[nodiscard]] std::optional<Intersection> getClosestIntersection(const Ray& ray,
+                                                                         double t_min,
+                                                                         double t_max) const;
+
+        // Returns true if the ray intersects this object at any t-value satisfying t_min <= t < t_max, stopping at
+        // the first such intersection found rather than searching for the closest
+        [[nodiscard]] bool hasIntersectionWithin(const Ray& ray, double t_min, double t_max) const;
+
     private:
         /* Data Members */
 
         Matrix4 m_transform{ gfx::createIdentityMatrix() };
         Matrix4 m_transform_inverse{ gfx::createIdentityMatrix() };
         CompositeSurface* m_parent{ nullptr };
+        Matrix4 m_world_to_object_transform{ gfx::createIdentityMatrix() };   // Composed through every ancestor
+        Matrix4 m_normal_to_world_transform{ gfx::createIdentityMatrix() };   // Transpose of the above
+        bool m_is_world_transform_cached{ false };
 
         /* Helper Methods */
 
     protected:
-        // Recursively transforms a point from its current space to the local space for this object,
-        // ensuring transformations for each parent object are applied
+        // Transforms a point from world space to the local space for this object using the cached world transform,
+        // or otherwise recursively, ensuring transformations for each parent object are applied
         [[nodiscard]] Vector4 transformToObjectSpace(const Vector4& point) const;
 
-        // Recursively transforms a normalized vector from an object's local space through its
-        // parent's local spaces until the normal is in world space
+        // Transforms a normalized vector from an object's local space to world space using the cached normal
+        // transform, or otherwise recursively through its parent's local spaces
         [[nodiscard]] Vector4 transformNormalToWorldSpace(const Vector4& local_normal) const;
 
     private:
+        /* Virtual Helper Methods */
+
+        // Finds the closest intersection with a ray in object space. The default implementation selects from the
+        // full list of intersections, and may be overridden by objects which can skip intersections outside of
+        // the interval without calculating them.
+        [[nodiscard]] virtual std::optional<Intersection> calculateClosestIntersection(const Ray& transformed_ray,
+                                                                                       double t_min,
+                                                                                       double t_max) const;
+
+        // Checks for any intersection with a ray in object space within the interval, which may be overridden by
+        // objects able to stop testing once the first intersection is found
+        [[nodiscard]] virtual bool checkForIntersectionWithin(const Ray& transformed_ray,
+                                                              double t_min,
+                                                              double t_max) const;
+
         /* Pure Virtual Helper Methods */
 
-        [[nodiscard]] virtual std::vector<Intersection> calculateIntersections(const Ray& transformed_ray) const = 0;
+        // Appends the intersections with a ray in object space to the end of the passed-in list
+        virtual void calculateIntersections(const Ray& transformed_ray,
+                                            std::vector<Intersection>& intersections) const = 0;
         [[nodiscard]] virtual bool areEquivalent(const Object& other_object) const = 0;
     };
 
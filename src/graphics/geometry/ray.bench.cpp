@@ -0,0 +1,19 @@
+#include "benchmark/benchmark.h"
+#include "ray.hpp"
+
+#include "transform.hpp"
+
+// Benchmarks transforming a ray by a combined rotation, scaling, and translation matrix
+static void BM_RayTransform(benchmark::State& state)
+{
+    const gfx::Matrix4 transform_matrix{ gfx::createTranslationMatrix(2, -1.5, 4) *
+                                         gfx::createYRotationMatrix(0.6) *
+                                         gfx::createScalingMatrix(1.5, 0.5, 2) };
+    gfx::Ray ray{ 0, 1, -5, 0.267, -0.534, 0.802 };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ray);
+        benchmark::DoNotOptimize(ray.transform(transform_matrix));
+    }
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_RayTransform);
\ No newline at end of file
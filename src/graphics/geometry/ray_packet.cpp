@@ -0,0 +1,44 @@
+#include "ray_packet.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace gfx {
+    // Ray List Constructor
+    RayPacket::RayPacket(const std::span<const Ray> rays)
+    {
+        if (rays.size() > MAX_RAY_PACKET_SIZE)
+            throw std::invalid_argument{ "Ray packet cannot hold more than 16 rays." };
+
+        for (const Ray& ray : rays) {
+            this->addRay(ray);
+        }
+    }
+
+    const Ray& RayPacket::getRayAt(const size_t index) const
+    {
+        if (index >= m_size)
+            throw std::out_of_range{ "Ray packet index is out of range." };
+
+        return m_rays[index];
+    }
+
+    void RayPacket::addRay(const Ray& ray)
+    {
+        if (m_size == MAX_RAY_PACKET_SIZE)
+            throw std::length_error{ "Ray packet is full." };
+
+        const std::array<double, 3> origin{ ray.getOrigin().x(), ray.getOrigin().y(), ray.getOrigin().z() };
+        const std::array<double, 3> direction{ ray.getDirection().x(),
+                                               ray.getDirection().y(),
+                                               ray.getDirection().z() };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const size_t row_lane{ axis * MAX_RAY_PACKET_SIZE + m_size };
+            m_origins[row_lane] = static_cast<float>(origin[axis]);
+            m_inverse_directions[row_lane] = static_cast<float>(1.0 / direction[axis]);
+            m_negative_direction_masks[row_lane] = std::signbit(direction[axis]) ? ~uint32_t{ 0 } : 0;
+        }
+
+        m_rays[m_size++] = ray;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "ray.hpp"
+#include "simd_kernels.hpp"
+
+namespace gfx {
+    // Largest number of rays traced together as a packet, covering a 4x4 block of pixels
+    constexpr size_t MAX_RAY_PACKET_SIZE{ 16 };
+
+    // A group of coherent rays, such as the primary rays of a block of neighbouring pixels, which are traced through
+    // the scene together. Alongside the rays, the packet stores single-precision copies of their origins, inverse
+    // directions, and direction signs as one row per axis, so that the packet box kernel can test several rays
+    // against a box at once. Lanes beyond the size of the packet are padding and are never reported as hits.
+    class RayPacket
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor (Empty Packet)
+        RayPacket() = default;
+
+        // Ray List Constructor, throwing if more than MAX_RAY_PACKET_SIZE rays are passed in
+        explicit RayPacket(std::span<const Ray> rays);
+
+        // Copy Constructor
+        RayPacket(const RayPacket&) = default;
+
+        /* Destructor */
+
+        ~RayPacket() = default;
+
+        /* Assignment Operators */
+
+        RayPacket& operator=(const RayPacket&) = default;
+
+        /* Accessors */
+
+        [[nodiscard]] size_t size() const
+        { return m_size; }
+
+        [[nodiscard]] bool isEmpty() const
+        { return m_size == 0; }
+
+        [[nodiscard]] const Ray& getRayAt(size_t index) const;
+
+        // Returns a mask with bit i set for each ray i in the packet
+        [[nodiscard]] uint32_t getRayMask() const
+        { return static_cast<uint32_t>((uint64_t{ 1 } << m_size) - 1); }
+
+        // Returns the rows of ray origins, with the row for each axis spaced MAX_RAY_PACKET_SIZE elements apart
+        [[nodiscard]] const float* getOrigins() const
+        { return m_origins.data(); }
+
+        // Returns the rows of inverse ray directions, laid out the same as the origins
+        [[nodiscard]] const float* getInverseDirections() const
+        { return m_inverse_directions.data(); }
+
+        // Returns the rows of direction signs, holding all bits set for each ray with a negative direction along an
+        // axis, laid out the same as the origins
+        [[nodiscard]] const uint32_t* getNegativeDirectionMasks() const
+        { return m_negative_direction_masks.data(); }
+
+        /* Mutators */
+
+        // Adds a ray to the end of the packet, throwing if the packet is full
+        void addRay(const Ray& ray);
+
+        // Removes every ray from the packet
+        void clear()
+        { m_size = 0; }
+
+    private:
+        /* Data Members */
+
+        std::array<Ray, MAX_RAY_PACKET_SIZE> m_rays{ };
+        size_t m_size{ 0 };
+        alignas(32) std::array<float, 3 * MAX_RAY_PACKET_SIZE> m_origins{ };
+        alignas(32) std::array<float, 3 * MAX_RAY_PACKET_SIZE> m_inverse_directions{ };
+        alignas(32) std::array<uint32_t, 3 * MAX_RAY_PACKET_SIZE> m_negative_direction_masks{ };
+    };
+
+    // Packets are tested against boxes in groups of rays as wide as the box kernel, and ray masks are 32 bits wide
+    static_assert(MAX_RAY_PACKET_SIZE % simd::BOX_KERNEL_WIDTH == 0);
+    static_assert(MAX_RAY_PACKET_SIZE <= 32);
+}
@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+#include "ray_packet.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include "ray.hpp"
+
+// Tests the default constructor
+TEST(GraphicsRayPacket, DefaultConstructor)
+{
+    const gfx::RayPacket packet{ };
+
+    EXPECT_TRUE(packet.isEmpty());
+    EXPECT_EQ(packet.size(), 0);
+    EXPECT_EQ(packet.getRayMask(), 0);
+}
+
+// Tests the ray list constructor
+TEST(GraphicsRayPacket, RayListConstructor)
+{
+    const std::array<gfx::Ray, 3> rays{ gfx::Ray{ 1, 2, 3, 1, -2, 0 },
+                                        gfx::Ray{ -1, 0, 4, -0.5, 0, 4 },
+                                        gfx::Ray{ 0, 0, 0, 0, 0, -1 } };
+    const gfx::RayPacket packet{ rays };
+
+    ASSERT_EQ(packet.size(), 3);
+    EXPECT_EQ(packet.getRayMask(), 0b111);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        EXPECT_EQ(packet.getRayAt(i), rays[i]);
+    }
+
+    // Each attribute is stored as one row per axis
+    constexpr size_t stride{ gfx::MAX_RAY_PACKET_SIZE };
+    EXPECT_FLOAT_EQ(packet.getOrigins()[0], 1);
+    EXPECT_FLOAT_EQ(packet.getOrigins()[stride + 0], 2);
+    EXPECT_FLOAT_EQ(packet.getOrigins()[2 * stride + 1], 4);
+    EXPECT_FLOAT_EQ(packet.getInverseDirections()[1], -2);
+    EXPECT_FLOAT_EQ(packet.getInverseDirections()[2 * stride + 1], 0.25);
+    EXPECT_EQ(packet.getNegativeDirectionMasks()[0], 0);
+    EXPECT_EQ(packet.getNegativeDirectionMasks()[stride + 0], ~uint32_t{ 0 });
+    EXPECT_EQ(packet.getNegativeDirectionMasks()[1], ~uint32_t{ 0 });
+    EXPECT_EQ(packet.getNegativeDirectionMasks()[2 * stride + 2], ~uint32_t{ 0 });
+}
+
+// Tests that a packet cannot be built from or grown beyond the maximum packet size
+TEST(GraphicsRayPacket, MaximumSize)
+{
+    const std::vector<gfx::Ray> rays(gfx::MAX_RAY_PACKET_SIZE, gfx::Ray{ 0, 0, 0, 0, 0, 1 });
+    gfx::RayPacket packet{ rays };
+    EXPECT_EQ(packet.getRayMask(), 0xffff);
+    EXPECT_THROW(packet.addRay(rays.front()), std::length_error);
+
+    const std::vector<gfx::Ray> too_many_rays(gfx::MAX_RAY_PACKET_SIZE + 1, gfx::Ray{ 0, 0, 0, 0, 0, 1 });
+    EXPECT_THROW(gfx::RayPacket{ too_many_rays }, std::invalid_argument);
+}
+
+// Tests adding rays to a packet and clearing it for reuse
+TEST(GraphicsRayPacket, AddRayAndClear)
+{
+    gfx::RayPacket packet{ };
+    packet.addRay(gfx::Ray{ 0, 0, 0, 1, 0, 0 });
+    packet.addRay(gfx::Ray{ 0, 0, 0, 0, 1, 0 });
+    EXPECT_EQ(packet.size(), 2);
+    EXPECT_EQ(packet.getRayAt(1), (gfx::Ray{ 0, 0, 0, 0, 1, 0 }));
+    EXPECT_THROW(static_cast<void>(packet.getRayAt(2)), std::out_of_range);
+
+    packet.clear();
+    EXPECT_TRUE(packet.isEmpty());
+    EXPECT_THROW(static_cast<void>(packet.getRayAt(0)), std::out_of_range);
+}
@@ -5,6 +5,7 @@
 
 #include "intersection.hpp"
 #include "util_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Calculate Bounding Box for a Cone
@@ -43,8 +44,10 @@ namespace gfx {
     }
 
     // Ray-Cone Intersection Calculator
-    std::vector<Intersection> Cone::calculateIntersections(const Ray& transformed_ray) const
+    void Cone::calculateIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const
     {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Cone);
+
         const Vector4 direction{ transformed_ray.getDirection() };
         const Vector4 origin{ transformed_ray.getOrigin() };
 
@@ -52,14 +55,14 @@ namespace gfx {
         const double b{ (2 * origin.x() * direction.x()) - (2 * origin.y() * direction.y()) + (2 * origin.z() * direction.z()) };
         const double c{ std::pow(origin.x(), 2) - std::pow(origin.y(), 2) + std::pow(origin.z(), 2) };
 
-        std::vector<Intersection> intersections{ };
+        const auto first_intersection{ static_cast<std::ptrdiff_t>(intersections.size()) };
 
         // Check if ray  potentially intersects both cone halves
         if (utils::areNotEqual(a, 0.0)) {
             const double discriminant{ std::pow(b, 2) - (4 * a * c) };
             if (utils::isLess(discriminant, 0.0)) {
                 // Ray misses the cone
-                return intersections;
+                return;
             }
 
             // Calculate the intersection points for an unbounded cone
@@ -85,11 +88,10 @@ namespace gfx {
         }
 
         // Calculate intersections for cone end caps (if applicable)
-        intersections.append_range(calculateEndCapIntersections(transformed_ray));
+        this->calculateEndCapIntersections(transformed_ray, intersections);
 
-        // Sort intersections and return
-        std::sort(intersections.begin(), intersections.end());
-        return intersections;
+        // Sort the intersections with this cone
+        std::sort(intersections.begin() + first_intersection, intersections.end());
     }
 
     // Cone Object Equivalency Check
@@ -106,16 +108,15 @@ namespace gfx {
     }
 
     // End Cap Intersection Calculator
-    std::vector<Intersection> Cone::calculateEndCapIntersections(const Ray& transformed_ray) const
+    void Cone::calculateEndCapIntersections(const Ray& transformed_ray,
+                                            std::vector<Intersection>& intersections) const
     {
         const double ray_direction_y_val{ transformed_ray.getDirection().y() };
         if (!this->isClosed() || utils::areEqual(ray_direction_y_val, 0.0)) {
             // Intersections only possible if the cone is capped and could potentially be intersected by the ray
-            return std::vector<Intersection>{ };
+            return;
         }
 
-        std::vector<Intersection> intersections{ };
-
         // Check for an intersection with the plane at the lower bound
         const double ray_origin_y_val{ transformed_ray.getOrigin().y() };
         const double t_lower{ (this->m_y_min - ray_origin_y_val) / ray_direction_y_val };
@@ -128,8 +129,6 @@ namespace gfx {
         if (isWithinConeWalls(transformed_ray, t_upper, m_y_max)) {
             intersections.emplace_back(t_upper, this);
         }
-
-        return intersections;
     }
 
     // Check Point is Within Cone Boundaries
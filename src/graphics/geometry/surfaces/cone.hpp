@@ -157,13 +157,14 @@ namespace gfx {
 
         /* Object Helper Method Overrides */
 
-        [[nodiscard]] std::vector<Intersection> calculateIntersections(const Ray& transformed_ray) const override;
+        void calculateIntersections(const Ray& transformed_ray,
+                                    std::vector<Intersection>& intersections) const override;
         [[nodiscard]] bool areEquivalent(const Object& other_object) const override;
 
         /* Cone Helper Methods */
 
         // Calculates the intersections with the end
-        [[nodiscard]] std::vector<Intersection> calculateEndCapIntersections(const Ray& transformed_ray) const;
+        void calculateEndCapIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const;
 
         // Returns true if a ray's position at t is within the radius of the cone at a given y-position
         [[nodiscard]] static bool isWithinConeWalls(const Ray& ray, double t, double end_cap_y_val) ;
@@ -4,6 +4,7 @@
 
 #include "intersection.hpp"
 #include "util_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Surface Normal for a Cube
@@ -29,16 +30,17 @@ namespace gfx {
     }
 
     // Ray-Cube Intersection Calculator
-    std::vector<Intersection> Cube::calculateIntersections(const Ray& transformed_ray) const
+    void Cube::calculateIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const
     {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Cube);
+
         const auto [ t_min, t_max ] { calculateBoxIntersectionTs(transformed_ray,
                                                                  createPoint(-1, -1, -1),
                                                                  createPoint(1, 1, 1)) };
 
-        if (utils::isGreater(t_min, t_max)) {
-            return std::vector<Intersection>{ };
-        } else {
-            return std::vector<Intersection>{ Intersection{ t_min, this }, Intersection{ t_max, this } };
+        if (!utils::isGreater(t_min, t_max)) {
+            intersections.emplace_back(t_min, this);
+            intersections.emplace_back(t_max, this);
         }
     }
 
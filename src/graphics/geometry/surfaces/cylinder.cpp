@@ -5,6 +5,7 @@
 
 #include "intersection.hpp"
 #include "util_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Surface Normal for a Cylinder
@@ -27,11 +28,13 @@ namespace gfx {
     }
 
     // Ray-Cylinder Intersection Calculator
-    std::vector<Intersection> Cylinder::calculateIntersections(const Ray& transformed_ray) const
+    void Cylinder::calculateIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const
     {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Cylinder);
+
         const Vector4 direction{ transformed_ray.getDirection() };
         const Vector4 origin{ transformed_ray.getOrigin() };
-        std::vector<Intersection> intersections{ };
+        const auto first_intersection{ static_cast<std::ptrdiff_t>(intersections.size()) };
 
         const double a{ std::pow(direction.x(), 2) + std::pow(direction.z(), 2) };
 
@@ -42,7 +45,7 @@ namespace gfx {
             const double discriminant{ std::pow(b, 2) - (4 * a * c) };
             if (utils::isLess(discriminant, 0.0)) {
                 // Ray misses the cylinder
-                return intersections;
+                return;
             }
 
             // Calculate the intersection points for an unbounded cylinder
@@ -64,11 +67,10 @@ namespace gfx {
         }
 
         // Calculate intersections for cylinder end caps (if any)
-        intersections.append_range(calculateEndCapIntersections(transformed_ray));
+        this->calculateEndCapIntersections(transformed_ray, intersections);
 
-        // Sort intersections and return
-        std::sort(intersections.begin(), intersections.end());
-        return intersections;
+        // Sort the intersections with this cylinder
+        std::sort(intersections.begin() + first_intersection, intersections.end());
     }
 
     // Cylinder Object Equivalency Check
@@ -85,16 +87,15 @@ namespace gfx {
     }
 
     // End Cap Intersection Calculator
-    std::vector<Intersection> Cylinder::calculateEndCapIntersections(const Ray& transformed_ray) const
+    void Cylinder::calculateEndCapIntersections(const Ray& transformed_ray,
+                                                std::vector<Intersection>& intersections) const
     {
         const double ray_direction_y_val{ transformed_ray.getDirection().y() };
         if (!this->isClosed() || utils::areEqual(ray_direction_y_val, 0.0)) {
             // Intersections only possible if the cylinder is capped and could potentially be intersected by the ray
-            return std::vector<Intersection>{ };
+            return;
         }
 
-        std::vector<Intersection> intersections{ };
-
         // Check for an intersection with the plane at the lower bound
         const double ray_origin_y_val{ transformed_ray.getOrigin().y() };
         const double t_lower{ (this->m_y_min - ray_origin_y_val) / ray_direction_y_val };
@@ -107,8 +108,6 @@ namespace gfx {
         if (isWithinCylinderWalls(transformed_ray, t_upper)) {
             intersections.emplace_back(t_upper, this);
         }
-
-        return intersections;
     }
 
 
@@ -159,13 +159,14 @@ namespace gfx {
 
         /* Object Helper Method Overrides */
 
-        [[nodiscard]] std::vector<Intersection> calculateIntersections(const Ray& transformed_ray) const override;
+        void calculateIntersections(const Ray& transformed_ray,
+                                    std::vector<Intersection>& intersections) const override;
         [[nodiscard]] bool areEquivalent(const Object& other_object) const override;
 
         /* Cylinder Helper Methods */
 
         // Calculates the intersections with the end
-        [[nodiscard]] std::vector<Intersection> calculateEndCapIntersections(const Ray& transformed_ray) const;
+        void calculateEndCapIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const;
 
         // Returns true if a ray's position at t is within a radius of 1 from the y-axis
         [[nodiscard]] static bool isWithinCylinderWalls(const Ray& ray, double t) ;
@@ -4,6 +4,7 @@
 
 #include "intersection.hpp"
 #include "util_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Surface Normal for a Plane
@@ -13,18 +14,19 @@ namespace gfx {
     }
 
     // Ray-Plane Intersection Calculator
-    std::vector<Intersection> Plane::calculateIntersections(const Ray& transformed_ray) const
+    void Plane::calculateIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const
     {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Plane);
+
         const double ray_y_direction = transformed_ray.getDirection().y();
 
         // Ray is parallel or coplanar to the plane
         if (std::abs(ray_y_direction) < utils::EPSILON) {
-            return std::vector<Intersection>{ };
+            return;
         }
 
         // Ray intersects plane (assume plane is defined as xz-plane)
-        return std::vector<Intersection>{ Intersection{ -transformed_ray.getOrigin().y() / ray_y_direction,
-                                                        this } };
+        intersections.emplace_back(-transformed_ray.getOrigin().y() / ray_y_direction, this);
     }
 
     // Plane Object Equivalency Check
@@ -4,6 +4,7 @@
 
 #include "intersection.hpp"
 #include "util_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Surface Normal for a Sphere
@@ -13,8 +14,10 @@ namespace gfx {
     }
 
     // Ray-Sphere Intersection Calculator
-    std::vector<Intersection> Sphere::calculateIntersections(const Ray& transformed_ray) const
+    void Sphere::calculateIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const
     {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Sphere);
+
         // Get the distance from the origin to the center of the sphere
         const Vector4 sphere_center{ createPoint(0, 0, 0) };
         const Vector4 sphere_center_distance{ transformed_ray.getOrigin() - sphere_center };
@@ -25,20 +28,20 @@ namespace gfx {
         const double c{ dotProduct(sphere_center_distance, sphere_center_distance) - 1 };
         const double discriminant{ std::pow(b, 2) - 4 * a * c };
 
-        // No Solutions, return empty vector
+        // No Solutions, add no intersections
         if (utils::isLess(discriminant, 0.0)) {
-            return std::vector<Intersection>{};
+            return;
         }
-        // One Solution, return vector with intersection distance listed twice
+        // One Solution, add the intersection distance twice
         else if (utils::areEqual(discriminant, 0.0)) {
             const Intersection intersection{ -b / (2 * a), this };
-            return std::vector<Intersection>{ intersection, intersection };
+            intersections.push_back(intersection);
+            intersections.push_back(intersection);
         }
-        // Two Solutions, return vector with intersection distances
+        // Two Solutions, add both intersection distances
         else {
-            const Intersection intersection_a{ (-b - std::sqrt(discriminant)) / (2 * a), this };
-            const Intersection intersection_b{ (-b + std::sqrt(discriminant)) / (2 * a), this };
-            return std::vector<Intersection>{ intersection_a, intersection_b };
+            intersections.emplace_back((-b - std::sqrt(discriminant)) / (2 * a), this);
+            intersections.emplace_back((-b + std::sqrt(discriminant)) / (2 * a), this);
         }
     }
 
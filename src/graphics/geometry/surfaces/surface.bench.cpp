@@ -0,0 +1,93 @@
+#include "benchmark/benchmark.h"
+#include "surface.hpp"
+
+#include <vector>
+
+#include "sphere.hpp"
+#include "cube.hpp"
+#include "cylinder.hpp"
+#include "cone.hpp"
+#include "triangle.hpp"
+#include "triangle_mesh.hpp"
+#include "intersection.hpp"
+#include "ray.hpp"
+#include "transform.hpp"
+
+// Runs the intersection benchmark loop for a surface, appending to a list reused across iterations as the renderer does
+static void benchmarkSurfaceIntersection(benchmark::State& state, const gfx::Surface& surface, const gfx::Ray& ray)
+{
+    std::vector<gfx::Intersection> intersections{ };
+    for (auto _ : state) {
+        intersections.clear();
+        surface.appendObjectIntersections(ray, intersections);
+        benchmark::DoNotOptimize(intersections.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+// Benchmarks intersecting a ray with a transformed sphere
+static void BM_SphereIntersection(benchmark::State& state)
+{
+    const gfx::Sphere sphere{ gfx::createTranslationMatrix(0, 0.5, 0) * gfx::createScalingMatrix(2) };
+    benchmarkSurfaceIntersection(state, sphere, gfx::Ray{ 0.25, 0.5, -5, 0, 0, 1 });
+}
+BENCHMARK(BM_SphereIntersection);
+
+// Benchmarks intersecting a ray with a transformed cube
+static void BM_CubeIntersection(benchmark::State& state)
+{
+    const gfx::Cube cube{ gfx::createYRotationMatrix(0.5) };
+    benchmarkSurfaceIntersection(state, cube, gfx::Ray{ 0.25, 0.5, -5, 0, 0, 1 });
+}
+BENCHMARK(BM_CubeIntersection);
+
+// Benchmarks intersecting a ray with a closed cylinder through its side and end cap
+static void BM_CylinderIntersection(benchmark::State& state)
+{
+    const gfx::Cylinder cylinder{ -1, 1, true };
+    benchmarkSurfaceIntersection(state, cylinder, gfx::Ray{ 0.25, 0, -5, 0, 0.15, 1 });
+}
+BENCHMARK(BM_CylinderIntersection);
+
+// Benchmarks intersecting a ray with a closed double-napped cone through its side and end cap
+static void BM_ConeIntersection(benchmark::State& state)
+{
+    const gfx::Cone cone{ -1, 1, true };
+    benchmarkSurfaceIntersection(state, cone, gfx::Ray{ 0.25, 0, -5, 0, 0.15, 1 });
+}
+BENCHMARK(BM_ConeIntersection);
+
+// Benchmarks intersecting a ray with a triangle
+static void BM_TriangleIntersection(benchmark::State& state)
+{
+    const gfx::Triangle triangle{ gfx::createPoint(0, 1, 0), gfx::createPoint(-1, 0, 0), gfx::createPoint(1, 0, 0) };
+    benchmarkSurfaceIntersection(state, triangle, gfx::Ray{ 0, 0.5, -2, 0, 0, 1 });
+}
+BENCHMARK(BM_TriangleIntersection);
+
+// Benchmarks intersecting a ray with a flat grid mesh of the passed-in number of squares along each edge, with two
+// triangles per square
+static void BM_TriangleMeshIntersection(benchmark::State& state)
+{
+    const auto grid_size{ static_cast<uint32_t>(state.range(0)) };
+    std::vector<gfx::Vector4> vertices{ };
+    for (uint32_t y = 0; y <= grid_size; ++y)
+        for (uint32_t x = 0; x <= grid_size; ++x) {
+            vertices.push_back(gfx::createPoint(x, y, 0));
+        }
+
+    std::vector<uint32_t> indices{ };
+    for (uint32_t y = 0; y < grid_size; ++y)
+        for (uint32_t x = 0; x < grid_size; ++x) {
+            const uint32_t corner{ y * (grid_size + 1) + x };
+            indices.insert(indices.end(), { corner, corner + 1, corner + grid_size + 1 });
+            indices.insert(indices.end(), { corner + 1, corner + grid_size + 2, corner + grid_size + 1 });
+        }
+
+    const gfx::TriangleMesh mesh{ std::make_shared<const gfx::TriangleMeshData>(std::move(vertices),
+                                                                               std::move(indices)) };
+    const double center{ static_cast<double>(grid_size) / 2 + 0.25 };
+    benchmarkSurfaceIntersection(state, mesh, gfx::Ray{ center, center, -2, 0.01, 0.02, 1 });
+    state.counters["triangles"] = static_cast<double>(mesh.getTriangleCount());
+}
+BENCHMARK(BM_TriangleMeshIntersection)->RangeMultiplier(8)->Range(8, 512);
\ No newline at end of file
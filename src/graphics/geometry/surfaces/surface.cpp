@@ -14,12 +14,21 @@ namespace gfx {
     Color Surface::getObjectColorAt(const Vector4& world_point) const
     {
         // Use getter to check for potential parent materials
-        const Material& material{ this->getMaterial() };
+        return this->getObjectColorAt(world_point, this->getMaterial());
+    }
 
+    Color Surface::getObjectColorAt(const Vector4& world_point, const Material& material) const
+    {
         const Vector4 object_point{ this->transformToObjectSpace(world_point) };
         return material.getTexture().getTextureColorAt(object_point, m_texture_mapping);
     }
 
+    Color Surface::getObjectColorAt(const Vector4& world_point, const CompiledTexture& texture) const
+    {
+        const Vector4 object_point{ this->transformToObjectSpace(world_point) };
+        return texture.getColorAt(object_point, m_texture_mapping);
+    }
+
     Vector4 Surface::getSurfaceNormalAt(const Vector4& world_point) const
     {
         // Transform the point from world space to object space
@@ -29,4 +38,11 @@ namespace gfx {
         const Vector4 object_normal{ this->calculateSurfaceNormal(object_point) };
         return this->transformNormalToWorldSpace(object_normal);
     }
+
+    Vector4 Surface::getSurfaceNormalAt(const Vector4& world_point, const Intersection& intersection) const
+    {
+        const Vector4 object_point{ this->transformToObjectSpace(world_point) };
+        const Vector4 object_normal{ this->calculateIntersectionNormal(object_point, intersection) };
+        return this->transformNormalToWorldSpace(object_normal);
+    }
 }
\ No newline at end of file
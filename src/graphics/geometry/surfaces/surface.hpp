@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "material.hpp"
+#include "compiled_texture.hpp"
 #include "texture_map.hpp"
 
 namespace gfx {
@@ -19,20 +20,20 @@ namespace gfx {
         Surface() = default;
 
         // Transform-Only Constructor
-        explicit Surface(const Matrix4& transform, TextureMap texture_mapping = ProjectionMap)
-                : Object(transform), m_material{ }, m_texture_mapping{ std::move(texture_mapping) }
+        explicit Surface(const Matrix4& transform, const TextureMap texture_mapping = ProjectionMap)
+                : Object(transform), m_material{ }, m_texture_mapping{ texture_mapping }
         {}
 
         // Material-Only Constructor
-        explicit Surface(Material material, TextureMap texture_mapping = ProjectionMap)
-                : Object(), m_material{ std::move(material) }, m_texture_mapping{std::move( texture_mapping )}
+        explicit Surface(Material material, const TextureMap texture_mapping = ProjectionMap)
+                : Object(), m_material{ std::move(material) }, m_texture_mapping{ texture_mapping }
         {}
 
         // Standard Constructor
-        Surface(const Matrix4& transform, Material material, TextureMap texture_mapping = ProjectionMap)
+        Surface(const Matrix4& transform, Material material, const TextureMap texture_mapping = ProjectionMap)
                 : Object(transform),
                   m_material{ std::move(material) },
-                  m_texture_mapping{std::move( texture_mapping )}
+                  m_texture_mapping{ texture_mapping }
         {}
 
         // Copy Constructor
@@ -50,7 +51,7 @@ namespace gfx {
 
         [[nodiscard]] const Material& getMaterial() const;
 
-        [[nodiscard]] const TextureMap& getTextureMapping() const
+        [[nodiscard]] TextureMap getTextureMapping() const
         { return m_texture_mapping; }
 
         [[nodiscard]] Vector3 getTextureCoordinateFor(const Vector4& point) const
@@ -58,12 +59,18 @@ namespace gfx {
 
         [[nodiscard]] Color getObjectColorAt(const Vector4& world_point) const;
 
+        // Returns the color of the passed-in material at a world point, as mapped onto this surface
+        [[nodiscard]] Color getObjectColorAt(const Vector4& world_point, const Material& material) const;
+
+        // Returns the color of a compiled texture at a world point, as mapped onto this surface
+        [[nodiscard]] Color getObjectColorAt(const Vector4& world_point, const CompiledTexture& texture) const;
+
         /* Mutators */
 
         void setMaterial(const Material& material)
         { m_material = material; }
 
-        void setTextureMap(const TextureMap& texture_mapping)
+        void setTextureMap(const TextureMap texture_mapping)
         { m_texture_mapping = texture_mapping; }
 
         /* Geometric Operations */
@@ -71,12 +78,24 @@ namespace gfx {
         // Returns the surface normal vector at a passed-in world_point
         [[nodiscard]] Vector4 getSurfaceNormalAt(const Vector4& world_point) const;
 
+        // Returns the surface normal vector at the world point of an intersection with this surface
+        [[nodiscard]] Vector4 getSurfaceNormalAt(const Vector4& world_point, const Intersection& intersection) const;
+
     private:
         /* Data Members */
 
         Material m_material{ };
         TextureMap m_texture_mapping{ ProjectionMap };
 
+        /* Virtual Helper Methods */
+
+        // Calculates the surface normal in object space at an intersection. The default implementation only uses the
+        // intersection point, and may be overridden by surfaces whose normal depends on the intersected primitive.
+        [[nodiscard]] virtual Vector4 calculateIntersectionNormal(
+                const Vector4& transformed_point,
+                [[maybe_unused]] const Intersection& intersection) const
+        { return this->calculateSurfaceNormal(transformed_point); }
+
         /* Pure Virtual Helper Methods */
 
         [[nodiscard]] virtual Vector4 calculateSurfaceNormal(const Vector4& transformed_point) const = 0;
@@ -48,10 +48,10 @@ private:
         return gfx::createVector(transformed_point.x(), transformed_point.y(), transformed_point.z());
     }
 
-    [[nodiscard]] std::vector<gfx::Intersection> calculateIntersections(const gfx::Ray& transformed_ray) const override
+    void calculateIntersections(const gfx::Ray& transformed_ray,
+                                std::vector<gfx::Intersection>& intersections) const override
     {
         m_transformed_ray = transformed_ray;
-        return std::vector<gfx::Intersection>{ };
     }
 
     [[nodiscard]] bool areEquivalent(const Object& other_surface) const override
@@ -4,6 +4,7 @@
 
 #include "intersection.hpp"
 #include "util_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Surface Normal for a Triangle
@@ -13,15 +14,17 @@ namespace gfx {
     }
 
     // Ray-Triangle Intersection Calculator
-    std::vector<Intersection> Triangle::calculateIntersections(const Ray& transformed_ray) const
+    void Triangle::calculateIntersections(const Ray& transformed_ray, std::vector<Intersection>& intersections) const
     {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Triangle);
+
         const Vector4 ray_direction{ transformed_ray.getDirection() };
         const Vector4 ray_cross_edge_b{ ray_direction.crossProduct(m_edge_b) };
         const double determinant{ dotProduct(m_edge_a, ray_cross_edge_b) } ;
 
         if (utils::areEqual(determinant, 0.0))
             // Ray is parallel to the triangle plane
-            return std::vector<Intersection>{ };
+            return;
 
         const Vector4 ray_origin{ transformed_ray.getOrigin() };
         const double inverse_determinant{ 1.0 / determinant };
@@ -30,18 +33,18 @@ namespace gfx {
 
         if (utils::isLess(u, 0.0) || utils::isGreater(u, 1.0))
             // Ray misses Edge B (Vertex A to Vertex C)
-            return std::vector<Intersection>{ };
+            return;
 
         const Vector4 origin_cross_edge_a{ vertex_a_to_origin.crossProduct(m_edge_a) };
         const double v { inverse_determinant * dotProduct(ray_direction, origin_cross_edge_a) };
 
         if (utils::isLess(v, 0.0) || utils::isGreater(u + v, 1.0))
             // Ray misses Edges B & C
-            return std::vector<Intersection>{ };
+            return;
 
         // Ray intersects the triangle
         const double t { inverse_determinant * dotProduct(m_edge_b, origin_cross_edge_a) };
-        return std::vector<Intersection>{ { t, this } };
+        intersections.emplace_back(t, this);
     }
 
     // Triangle Object Equivalency Check
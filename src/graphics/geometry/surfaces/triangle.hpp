@@ -78,7 +78,8 @@ namespace gfx {
 
         /* Object Helper Method Overrides */
 
-        [[nodiscard]] std::vector<Intersection> calculateIntersections(const Ray& transformed_ray) const override;
+        void calculateIntersections(const Ray& transformed_ray,
+                                    std::vector<Intersection>& intersections) const override;
         [[nodiscard]] bool areEquivalent(const Object& other_object) const override;
 
         /* Triangle Helper Methods */
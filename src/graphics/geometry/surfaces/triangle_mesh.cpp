@@ -0,0 +1,315 @@
+#include "triangle_mesh.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "intersection.hpp"
+#include "util_functions.hpp"
+#include "render_statistics.hpp"
+
+namespace gfx {
+    namespace {
+        // Returns the point on a triangle closest to a passed-in point, by finding which vertex, edge, or the face of
+        // the triangle the closest point lies on from the point's position relative to each edge
+        Vector4 findClosestPointOnTriangle(const Vector4& point,
+                                           const Vector4& vertex_a,
+                                           const Vector4& vertex_b,
+                                           const Vector4& vertex_c)
+        {
+            const Vector4 edge_ab{ vertex_b - vertex_a };
+            const Vector4 edge_ac{ vertex_c - vertex_a };
+
+            const Vector4 offset_a{ point - vertex_a };
+            const double d1{ dotProduct(edge_ab, offset_a) };
+            const double d2{ dotProduct(edge_ac, offset_a) };
+            if (d1 <= 0 && d2 <= 0)
+                return vertex_a;
+
+            const Vector4 offset_b{ point - vertex_b };
+            const double d3{ dotProduct(edge_ab, offset_b) };
+            const double d4{ dotProduct(edge_ac, offset_b) };
+            if (d3 >= 0 && d4 <= d3)
+                return vertex_b;
+
+            const double area_c{ d1 * d4 - d3 * d2 };
+            if (area_c <= 0 && d1 >= 0 && d3 <= 0)
+                return vertex_a + edge_ab * (d1 / (d1 - d3));
+
+            const Vector4 offset_c{ point - vertex_c };
+            const double d5{ dotProduct(edge_ab, offset_c) };
+            const double d6{ dotProduct(edge_ac, offset_c) };
+            if (d6 >= 0 && d5 <= d6)
+                return vertex_c;
+
+            const double area_b{ d5 * d2 - d1 * d6 };
+            if (area_b <= 0 && d2 >= 0 && d6 <= 0)
+                return vertex_a + edge_ac * (d2 / (d2 - d6));
+
+            const double area_a{ d3 * d6 - d5 * d4 };
+            if (area_a <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+                return vertex_b + (vertex_c - vertex_b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+            // The closest point is inside the face, so interpolate it from the barycentric coordinates
+            const double area_sum{ area_a + area_b + area_c };
+            return vertex_a + edge_ab * (area_b / area_sum) + edge_ac * (area_c / area_sum);
+        }
+    }
+
+    // Flat Shaded Mesh Data Constructor
+    TriangleMeshData::TriangleMeshData(std::vector<Vector4> vertices, std::vector<uint32_t> indices)
+            : m_vertex_buffer{ std::move(vertices) },
+              m_normal_buffer{ },
+              m_index_buffer{ std::move(indices) },
+              m_vertices{ m_vertex_buffer },
+              m_normals{ },
+              m_indices{ m_index_buffer },
+              m_storage{ },
+              m_bvh{ }
+    {
+        this->buildHierarchy();
+    }
+
+    // Smooth Shaded Mesh Data Constructor
+    TriangleMeshData::TriangleMeshData(std::vector<Vector4> vertices,
+                                       std::vector<Vector4> normals,
+                                       std::vector<uint32_t> indices)
+            : m_vertex_buffer{ std::move(vertices) },
+              m_normal_buffer{ std::move(normals) },
+              m_index_buffer{ std::move(indices) },
+              m_vertices{ m_vertex_buffer },
+              m_normals{ m_normal_buffer },
+              m_indices{ m_index_buffer },
+              m_storage{ },
+              m_bvh{ }
+    {
+        if (m_normals.size() != m_vertices.size())
+            throw std::invalid_argument{ "Triangle mesh must have exactly one normal per vertex." };
+
+        this->buildHierarchy();
+    }
+
+    // External Storage Mesh Data Constructor
+    TriangleMeshData::TriangleMeshData(const std::span<const Vector4> vertices,
+                                       const std::span<const Vector4> normals,
+                                       const std::span<const uint32_t> indices,
+                                       BoundingVolumeHierarchy bvh,
+                                       std::shared_ptr<const void> storage)
+            : m_vertex_buffer{ },
+              m_normal_buffer{ },
+              m_index_buffer{ },
+              m_vertices{ vertices },
+              m_normals{ normals },
+              m_indices{ indices },
+              m_storage{ std::move(storage) },
+              m_bvh{ std::move(bvh) }
+    {
+        if (!m_storage)
+            throw std::invalid_argument{ "Externally stored triangle mesh data requires an owner." };
+
+        if (!m_normals.empty() && m_normals.size() != m_vertices.size())
+            throw std::invalid_argument{ "Triangle mesh must have exactly one normal per vertex." };
+
+        this->validateBufferSizes();
+        this->validateIndices();
+        if (m_bvh.getPrimitiveCount() != this->getTriangleCount())
+            throw std::invalid_argument{ "Triangle mesh hierarchy must contain every triangle exactly once." };
+    }
+
+    bool TriangleMeshData::operator==(const TriangleMeshData& rhs) const
+    {
+        return std::ranges::equal(m_vertices, rhs.m_vertices) &&
+               std::ranges::equal(m_normals, rhs.m_normals) &&
+               std::ranges::equal(m_indices, rhs.m_indices);
+    }
+
+    void TriangleMeshData::validateBufferSizes() const
+    {
+        if (m_indices.size() % 3 != 0)
+            throw std::invalid_argument{ "Triangle mesh index count must be a multiple of three." };
+    }
+
+    void TriangleMeshData::validateIndices() const
+    {
+        if (std::any_of(m_indices.begin(), m_indices.end(),
+                        [&](const uint32_t index) { return index >= m_vertices.size(); }))
+            throw std::invalid_argument{ "Triangle mesh indices must reference an existing vertex." };
+    }
+
+    void TriangleMeshData::buildHierarchy()
+    {
+        this->validateBufferSizes();
+        this->validateIndices();
+
+        // Bound each triangle, only keeping the boxes for as long as it takes to build the hierarchy
+        std::vector<BoundingBox> triangle_bounds(this->getTriangleCount());
+        for (size_t triangle_index = 0; triangle_index < triangle_bounds.size(); ++triangle_index) {
+            for (const uint32_t vertex_index : this->getTriangleAt(triangle_index)) {
+                triangle_bounds[triangle_index].addPoint(m_vertices[vertex_index]);
+            }
+        }
+
+        m_bvh = BoundingVolumeHierarchy{ triangle_bounds,
+                                         DEFAULT_BVH_MAX_LEAF_SIZE,
+                                         BvhSplitMethod::SurfaceAreaHeuristic };
+    }
+
+    // Surface Normal for a Triangle Mesh
+    Vector4 TriangleMesh::calculateSurfaceNormal(const Vector4& transformed_point) const
+    {
+        if (m_mesh_data->getTriangleCount() == 0)
+            throw std::invalid_argument{ "Triangle mesh normals require the mesh to have a triangle." };
+
+        // Without an intersection to identify the triangle, search every triangle for the one closest to the point.
+        // Rendering always passes the intersection, so this linear search is only used by direct queries.
+        const std::span<const Vector4> vertices{ m_mesh_data->getVertices() };
+        size_t closest_triangle_index{ 0 };
+        double closest_squared_distance{ std::numeric_limits<double>::infinity() };
+        for (size_t triangle_index = 0; triangle_index < m_mesh_data->getTriangleCount(); ++triangle_index) {
+            const auto [ index_a, index_b, index_c ] { m_mesh_data->getTriangleAt(triangle_index) };
+            const Vector4 offset{ transformed_point - findClosestPointOnTriangle(transformed_point,
+                                                                                vertices[index_a],
+                                                                                vertices[index_b],
+                                                                                vertices[index_c]) };
+            const double squared_distance{ dotProduct(offset, offset) };
+            if (squared_distance < closest_squared_distance) {
+                closest_triangle_index = triangle_index;
+                closest_squared_distance = squared_distance;
+            }
+        }
+
+        return this->calculateFlatNormal(closest_triangle_index);
+    }
+
+    // Surface Normal at an Intersection with a Triangle Mesh
+    Vector4 TriangleMesh::calculateIntersectionNormal([[maybe_unused]] const Vector4& transformed_point,
+                                                      const Intersection& intersection) const
+    {
+        const auto [ index_a, index_b, index_c ] { m_mesh_data->getTriangleAt(intersection.getPrimitiveIndex()) };
+
+        // Interpolate the vertex normals across the face using the barycentric coordinates of the intersection
+        if (m_mesh_data->hasVertexNormals()) {
+            const std::span<const Vector4> normals{ m_mesh_data->getNormals() };
+            const double u{ intersection.getU() };
+            const double v{ intersection.getV() };
+            return normalize(normals[index_a] * (1.0 - u - v) + normals[index_b] * u + normals[index_c] * v);
+        }
+
+        return this->calculateFlatNormal(intersection.getPrimitiveIndex());
+    }
+
+    Vector4 TriangleMesh::calculateFlatNormal(const size_t triangle_index) const
+    {
+        const auto [ index_a, index_b, index_c ] { m_mesh_data->getTriangleAt(triangle_index) };
+        const std::span<const Vector4> vertices{ m_mesh_data->getVertices() };
+        const Vector4 edge_a{ vertices[index_b] - vertices[index_a] };
+        const Vector4 edge_b{ vertices[index_c] - vertices[index_a] };
+        return normalize(edge_b.crossProduct(edge_a));
+    }
+
+    // Ray-Triangle Mesh Intersection Calculator
+    void TriangleMesh::calculateIntersections(const Ray& transformed_ray,
+                                              std::vector<Intersection>& intersections) const
+    {
+        const auto first_intersection{ static_cast<std::ptrdiff_t>(intersections.size()) };
+        m_mesh_data->getBoundingVolumeHierarchy().forEachCandidate(transformed_ray, [&](const uint32_t triangle_index) {
+            const auto triangle_intersection{ this->intersectTriangle(transformed_ray, triangle_index) };
+            if (triangle_intersection)
+                intersections.push_back(triangle_intersection.value());
+        });
+
+        // Sort only the intersections with this mesh, leaving any earlier entries in the list untouched
+        std::sort(intersections.begin() + first_intersection, intersections.end());
+    }
+
+    // Closest Ray-Triangle Mesh Intersection
+    std::optional<Intersection> TriangleMesh::calculateClosestIntersection(const Ray& transformed_ray,
+                                                                           const double t_min,
+                                                                           double t_max) const
+    {
+        // Narrow the interval as each closer intersection is found, so more distant triangles can be skipped
+        std::optional<Intersection> closest_intersection{ std::nullopt };
+        m_mesh_data->getBoundingVolumeHierarchy().forEachCandidate(
+                transformed_ray, t_min, t_max, [&](const uint32_t triangle_index) {
+            const auto triangle_intersection{ this->intersectTriangle(transformed_ray, triangle_index) };
+            if (triangle_intersection &&
+                    triangle_intersection->getT() >= t_min &&
+                    triangle_intersection->getT() <= t_max) {
+                closest_intersection = triangle_intersection;
+                t_max = triangle_intersection->getT();
+            }
+        });
+
+        return closest_intersection;
+    }
+
+    // Any Ray-Triangle Mesh Intersection
+    bool TriangleMesh::checkForIntersectionWithin(const Ray& transformed_ray,
+                                                  const double t_min,
+                                                  const double t_max) const
+    {
+        return m_mesh_data->getBoundingVolumeHierarchy().anyOfCandidates(
+                transformed_ray, t_min, t_max, [&](const uint32_t triangle_index) {
+            const auto triangle_intersection{ this->intersectTriangle(transformed_ray, triangle_index) };
+            return triangle_intersection &&
+                   triangle_intersection->getT() >= t_min &&
+                   utils::isLess(triangle_intersection->getT(), t_max);
+        });
+    }
+
+    // Triangle Mesh Object Equivalency Check
+    bool TriangleMesh::areEquivalent(const Object& other_object) const
+    {
+        const TriangleMesh& other_mesh{ dynamic_cast<const TriangleMesh&>(other_object) };
+
+        return
+                this->getTransform() == other_mesh.getTransform() &&
+                this->getMaterial() == other_mesh.getMaterial() &&
+                (m_mesh_data == other_mesh.m_mesh_data || *m_mesh_data == *other_mesh.m_mesh_data);
+    }
+
+    void TriangleMesh::validateMeshData() const
+    {
+        if (!m_mesh_data)
+            throw std::invalid_argument{ "Triangle mesh data cannot be null." };
+    }
+
+    std::optional<Intersection> TriangleMesh::intersectTriangle(const Ray& transformed_ray,
+                                                                const uint32_t triangle_index) const
+    {
+        RenderStatisticsCollector::recordIntersectionTest(ShapeType::Triangle);
+
+        // Intersect the ray with the triangle as for a standalone triangle, deriving the edges from the shared vertices
+        const std::span<const Vector4> vertices{ m_mesh_data->getVertices() };
+        const auto [ index_a, index_b, index_c ] { m_mesh_data->getTriangleAt(triangle_index) };
+        const Vector4& vertex_a{ vertices[index_a] };
+        const Vector4 edge_a{ vertices[index_b] - vertex_a };
+        const Vector4 edge_b{ vertices[index_c] - vertex_a };
+
+        const Vector4 ray_direction{ transformed_ray.getDirection() };
+        const Vector4 ray_cross_edge_b{ ray_direction.crossProduct(edge_b) };
+        const double determinant{ dotProduct(edge_a, ray_cross_edge_b) };
+
+        if (utils::areEqual(determinant, 0.0))
+            // Ray is parallel to the triangle plane
+            return std::nullopt;
+
+        const double inverse_determinant{ 1.0 / determinant };
+        const Vector4 vertex_a_to_origin{ transformed_ray.getOrigin() - vertex_a };
+        const double u{ inverse_determinant * dotProduct(vertex_a_to_origin, ray_cross_edge_b) };
+
+        if (utils::isLess(u, 0.0) || utils::isGreater(u, 1.0))
+            // Ray misses Edge B (Vertex A to Vertex C)
+            return std::nullopt;
+
+        const Vector4 origin_cross_edge_a{ vertex_a_to_origin.crossProduct(edge_a) };
+        const double v{ inverse_determinant * dotProduct(ray_direction, origin_cross_edge_a) };
+
+        if (utils::isLess(v, 0.0) || utils::isGreater(u + v, 1.0))
+            // Ray misses Edges B & C
+            return std::nullopt;
+
+        const double t{ inverse_determinant * dotProduct(edge_b, origin_cross_edge_a) };
+        return Intersection{ t, this, triangle_index, u, v };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "surface.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "bounding_volume_hierarchy.hpp"
+
+namespace gfx {
+    // Indexed triangle geometry which may be shared by any number of meshes. Each triangle is stored as three
+    // indices into the vertex list, and the triangles are organized into a bounding volume hierarchy on construction.
+    // The buffers are either owned by the mesh data or referenced in external storage, such as a memory-mapped file.
+    class TriangleMeshData
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor
+        TriangleMeshData() = delete;
+
+        // Flat Shaded Constructor
+        TriangleMeshData(std::vector<Vector4> vertices, std::vector<uint32_t> indices);
+
+        // Smooth Shaded Constructor, interpolating the normals of each triangle's vertices across its face
+        TriangleMeshData(std::vector<Vector4> vertices, std::vector<Vector4> normals, std::vector<uint32_t> indices);
+
+        // External Storage Constructor, referencing the buffers and a prebuilt hierarchy without copying them. The
+        // storage pointer keeps the referenced memory alive. The buffer sizes and indices are checked, but the vertices
+        // and normals are used as they are. The normals may be empty.
+        TriangleMeshData(std::span<const Vector4> vertices,
+                         std::span<const Vector4> normals,
+                         std::span<const uint32_t> indices,
+                         BoundingVolumeHierarchy bvh,
+                         std::shared_ptr<const void> storage);
+
+        // Copy Constructor (Deleted, mesh data is shared by pointer)
+        TriangleMeshData(const TriangleMeshData&) = delete;
+
+        /* Destructor */
+
+        ~TriangleMeshData() = default;
+
+        /* Assignment Operators */
+
+        TriangleMeshData& operator=(const TriangleMeshData&) = delete;
+
+        /* Accessors */
+
+        [[nodiscard]] size_t getVertexCount() const
+        { return m_vertices.size(); }
+
+        [[nodiscard]] size_t getTriangleCount() const
+        { return m_indices.size() / 3; }
+
+        [[nodiscard]] bool hasVertexNormals() const
+        { return !m_normals.empty(); }
+
+        [[nodiscard]] std::span<const Vector4> getVertices() const
+        { return m_vertices; }
+
+        [[nodiscard]] std::span<const Vector4> getNormals() const
+        { return m_normals; }
+
+        [[nodiscard]] std::span<const uint32_t> getIndices() const
+        { return m_indices; }
+
+        // Returns true if the buffers are referenced in external storage rather than owned by the mesh data
+        [[nodiscard]] bool isExternallyStored() const
+        { return m_storage != nullptr; }
+
+        // Returns the indices of the three vertices of a triangle
+        [[nodiscard]] std::array<uint32_t, 3> getTriangleAt(const size_t triangle_index) const
+        {
+            return { m_indices[3 * triangle_index],
+                     m_indices[3 * triangle_index + 1],
+                     m_indices[3 * triangle_index + 2] };
+        }
+
+        [[nodiscard]] const BoundingVolumeHierarchy& getBoundingVolumeHierarchy() const
+        { return m_bvh; }
+
+        [[nodiscard]] BoundingBox getBounds() const
+        { return m_bvh.getBounds(); }
+
+        /* Comparison Operator Overloads */
+
+        [[nodiscard]] bool operator==(const TriangleMeshData& rhs) const;
+
+    private:
+        /* Data Members */
+
+        std::vector<Vector4> m_vertex_buffer{ };        // Owned buffers, empty if the mesh is stored externally
+        std::vector<Vector4> m_normal_buffer{ };
+        std::vector<uint32_t> m_index_buffer{ };
+        std::span<const Vector4> m_vertices{ };
+        std::span<const Vector4> m_normals{ };          // One per vertex, or empty for flat shading
+        std::span<const uint32_t> m_indices{ };
+        std::shared_ptr<const void> m_storage{ };       // Owner of externally stored buffers, null if owned
+        BoundingVolumeHierarchy m_bvh{ };
+
+        /* Helper Methods */
+
+        // Validates the sizes of the buffers
+        void validateBufferSizes() const;
+
+        // Validates that every index references a vertex, since the intersection code reads vertices unchecked
+        void validateIndices() const;
+
+        // Validates the buffers and builds the bounding volume hierarchy over the triangles
+        void buildHierarchy();
+    };
+
+    // A surface made up of the triangles of a shared mesh, drawn with a single transform and material. Triangles are
+    // referenced by their index in the mesh rather than stored as separate objects, so copies of a mesh share its
+    // geometry and each triangle only costs its three indices and its share of the hierarchy.
+    class TriangleMesh : public Surface
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor
+        TriangleMesh() = delete;
+
+        // Mesh-Only Constructor
+        explicit TriangleMesh(std::shared_ptr<const TriangleMeshData> mesh_data)
+                : Surface{ }, m_mesh_data{ std::move(mesh_data) }
+        { this->validateMeshData(); }
+
+        // Transform Constructor
+        TriangleMesh(const Matrix4& transform, std::shared_ptr<const TriangleMeshData> mesh_data)
+                : Surface{ transform }, m_mesh_data{ std::move(mesh_data) }
+        { this->validateMeshData(); }
+
+        // Material Constructor
+        TriangleMesh(const Material& material, std::shared_ptr<const TriangleMeshData> mesh_data)
+                : Surface{ material }, m_mesh_data{ std::move(mesh_data) }
+        { this->validateMeshData(); }
+
+        // Standard Constructor
+        TriangleMesh(const Matrix4& transform,
+                     const Material& material,
+                     std::shared_ptr<const TriangleMeshData> mesh_data)
+                : Surface{ transform, material }, m_mesh_data{ std::move(mesh_data) }
+        { this->validateMeshData(); }
+
+        // Copy Constructor
+        TriangleMesh(const TriangleMesh&) = default;
+
+        /* Destructor */
+
+        ~TriangleMesh() override = default;
+
+        /* Assignment Operators */
+
+        TriangleMesh& operator=(const TriangleMesh&) = default;
+
+        /* Accessors */
+
+        [[nodiscard]] const TriangleMeshData& getMeshData() const
+        { return *m_mesh_data; }
+
+        [[nodiscard]] const std::shared_ptr<const TriangleMeshData>& getMeshDataPtr() const
+        { return m_mesh_data; }
+
+        [[nodiscard]] size_t getTriangleCount() const
+        { return m_mesh_data->getTriangleCount(); }
+
+        [[nodiscard]] BoundingBox getBounds() const override
+        { return m_mesh_data->getBounds(); }
+
+        /* Object Operations */
+
+        // Creates a clone of this mesh to be stored in an object list, sharing the mesh data
+        [[nodiscard]] std::shared_ptr<Object> clone() const override
+        { return std::make_shared<TriangleMesh>(*this); }
+
+    private:
+        /* Data Members */
+
+        std::shared_ptr<const TriangleMeshData> m_mesh_data{ };
+
+        /* Shape Helper Method Overrides */
+
+        // Returns the flat normal of the triangle closest to the point, since a point alone does not identify the
+        // triangle it lies on. Smooth shaded normals require the barycentric coordinates of an intersection.
+        [[nodiscard]] Vector4 calculateSurfaceNormal(const Vector4& transformed_point) const override;
+        [[nodiscard]] Vector4 calculateIntersectionNormal(const Vector4& transformed_point,
+                                                          const Intersection& intersection) const override;
+
+        /* Triangle Mesh Helper Methods */
+
+        // Returns the normal of the plane containing a triangle, ignoring any vertex normals
+        [[nodiscard]] Vector4 calculateFlatNormal(size_t triangle_index) const;
+
+        /* Object Helper Method Overrides */
+
+        void calculateIntersections(const Ray& transformed_ray,
+                                    std::vector<Intersection>& intersections) const override;
+        [[nodiscard]] std::optional<Intersection> calculateClosestIntersection(const Ray& transformed_ray,
+                                                                               double t_min,
+                                                                               double t_max) const override;
+        [[nodiscard]] bool checkForIntersectionWithin(const Ray& transformed_ray,
+                                                      double t_min,
+                                                      double t_max) const override;
+        [[nodiscard]] bool areEquivalent(const Object& other_object) const override;
+
+        /* Triangle Mesh Helper Methods */
+
+        // Throws an exception if the mesh was constructed without mesh data
+        void validateMeshData() const;
+
+        // Returns the intersection of a ray in object space with a single triangle of the mesh, if one exists
+        [[nodiscard]] std::optional<Intersection> intersectTriangle(const Ray& transformed_ray,
+                                                                    uint32_t triangle_index) const;
+    };
+}
@@ -0,0 +1,244 @@
+#include "gtest/gtest.h"
+#include "triangle_mesh.hpp"
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "matrix4.hpp"
+#include "material.hpp"
+#include "ray.hpp"
+#include "intersection.hpp"
+#include "transform.hpp"
+
+// Returns a flat mesh of unit squares covering [0, size] along the x and y axes, with two triangles per square
+static std::shared_ptr<const gfx::TriangleMeshData> createGridMeshData(const uint32_t size)
+{
+    std::vector<gfx::Vector4> vertices{ };
+    for (uint32_t y = 0; y <= size; ++y)
+        for (uint32_t x = 0; x <= size; ++x) {
+            vertices.push_back(gfx::createPoint(x, y, 0));
+        }
+
+    std::vector<uint32_t> indices{ };
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x) {
+            const uint32_t corner{ y * (size + 1) + x };
+            indices.insert(indices.end(), { corner, corner + 1, corner + size + 1 });
+            indices.insert(indices.end(), { corner + 1, corner + size + 2, corner + size + 1 });
+        }
+
+    return std::make_shared<const gfx::TriangleMeshData>(std::move(vertices), std::move(indices));
+}
+
+// Tests constructing mesh data from vertex and index buffers
+TEST(GraphicsTriangleMesh, MeshDataConstructor)
+{
+    const auto mesh_data{ createGridMeshData(4) };
+
+    const gfx::BoundingBox bounds_expected{ 0, 0, 0, 4, 4, 0 };
+
+    EXPECT_EQ(mesh_data->getVertexCount(), 25);
+    EXPECT_EQ(mesh_data->getTriangleCount(), 32);
+    EXPECT_FALSE(mesh_data->hasVertexNormals());
+    EXPECT_EQ(mesh_data->getBounds(), bounds_expected);
+    EXPECT_EQ(mesh_data->getBoundingVolumeHierarchy().getPrimitiveCount(), 32);
+
+    const std::array<uint32_t, 3> triangle_expected{ 1, 6, 5 };
+    EXPECT_EQ(mesh_data->getTriangleAt(1), triangle_expected);
+}
+
+// Tests that constructing mesh data from inconsistent buffers throws an exception
+TEST(GraphicsTriangleMesh, MeshDataConstructorInvalidBuffers)
+{
+    const std::vector<gfx::Vector4> vertices{ gfx::createPoint(0, 0, 0),
+                                              gfx::createPoint(1, 0, 0),
+                                              gfx::createPoint(0, 1, 0) };
+
+    // Test an index count which is not a multiple of three
+    EXPECT_THROW({ const gfx::TriangleMeshData mesh_data(vertices, { 0, 1 }); }, std::invalid_argument);
+
+    // Test an index which does not reference a vertex
+    EXPECT_THROW({ const gfx::TriangleMeshData mesh_data(vertices, { 0, 1, 3 }); }, std::invalid_argument);
+
+    // Test a normal count which does not match the vertex count
+    EXPECT_THROW({
+        const gfx::TriangleMeshData mesh_data(vertices, { gfx::createVector(0, 0, -1) }, { 0, 1, 2 });
+    }, std::invalid_argument);
+}
+
+// Tests that externally stored indices which do not reference a vertex are rejected
+TEST(GraphicsTriangleMesh, MeshDataExternalStorageInvalidIndices)
+{
+    const auto mesh_data{ createGridMeshData(2) };
+    std::vector<uint32_t> indices(mesh_data->getIndices().begin(), mesh_data->getIndices().end());
+
+    // Returns the mesh data referencing the current indices and the hierarchy of the original mesh
+    const auto create_mesh_data{ [&]() {
+        const gfx::BoundingVolumeHierarchy& bvh{ mesh_data->getBoundingVolumeHierarchy() };
+        return gfx::TriangleMeshData{ mesh_data->getVertices(),
+                                      { },
+                                      indices,
+                                      gfx::BoundingVolumeHierarchy{ bvh.getWideNodes(), bvh.getPrimitiveIndices(),
+                                                                    mesh_data },
+                                      mesh_data };
+    } };
+    EXPECT_NO_THROW(static_cast<void>(create_mesh_data()));
+
+    indices[4] = static_cast<uint32_t>(mesh_data->getVertexCount());
+    EXPECT_THROW(static_cast<void>(create_mesh_data()), std::invalid_argument);
+}
+
+// Tests the standard constructor
+TEST(GraphicsTriangleMesh, StandardConstructor)
+{
+    const auto mesh_data{ createGridMeshData(2) };
+    const gfx::Matrix4 transform_expected{ gfx::createTranslationMatrix(1, 2, 3) };
+    const gfx::Material material_expected{ gfx::Color{ 1, 0, 0 } };
+    const gfx::TriangleMesh mesh{ transform_expected, material_expected, mesh_data };
+
+    EXPECT_EQ(mesh.getTransform(), transform_expected);
+    EXPECT_EQ(mesh.getMaterial(), material_expected);
+    EXPECT_EQ(mesh.getTriangleCount(), 8);
+    EXPECT_EQ(mesh.getMeshDataPtr(), mesh_data);
+
+    // Test constructing a mesh without mesh data
+    EXPECT_THROW({ const gfx::TriangleMesh invalid_mesh{ nullptr }; }, std::invalid_argument);
+}
+
+// Tests that copies of a mesh share the same mesh data
+TEST(GraphicsTriangleMesh, CopySharesMeshData)
+{
+    const gfx::TriangleMesh mesh{ createGridMeshData(2) };
+    const gfx::TriangleMesh mesh_copy{ mesh };
+    const auto mesh_clone{ std::dynamic_pointer_cast<gfx::TriangleMesh>(mesh.clone()) };
+
+    ASSERT_NE(mesh_clone, nullptr);
+    EXPECT_EQ(&mesh_copy.getMeshData(), &mesh.getMeshData());
+    EXPECT_EQ(&mesh_clone->getMeshData(), &mesh.getMeshData());
+}
+
+// Tests the equality and inequality operators
+TEST(GraphicsTriangleMesh, EqualityOperator)
+{
+    const gfx::TriangleMesh mesh_a{ createGridMeshData(2) };
+    const gfx::TriangleMesh mesh_b{ createGridMeshData(2) };
+    const gfx::TriangleMesh mesh_c{ createGridMeshData(3) };
+    const gfx::TriangleMesh mesh_d{ gfx::createScalingMatrix(2), mesh_a.getMeshDataPtr() };
+
+    EXPECT_TRUE(mesh_a == mesh_b);
+    EXPECT_FALSE(mesh_a == mesh_c);
+    EXPECT_TRUE(mesh_a != mesh_d);
+}
+
+// Tests casting a ray which hits a single triangle of a mesh
+TEST(GraphicsTriangleMesh, RayTriangleMeshHit)
+{
+    const gfx::TriangleMesh mesh{ createGridMeshData(4) };
+
+    // The point (2.25, 1.25) lies in the lower triangle of the square at (2, 1), the 13th triangle of the grid
+    const gfx::Ray ray{ 2.25, 1.25, -2, 0, 0, 1 };
+    const std::vector<gfx::Intersection> intersections{ mesh.getObjectIntersections(ray) };
+
+    ASSERT_EQ(intersections.size(), 1);
+    EXPECT_FLOAT_EQ(intersections[0].getT(), 2);
+    EXPECT_EQ(intersections[0].getPrimitiveIndex(), 12);
+    EXPECT_FLOAT_EQ(intersections[0].getU(), 0.25);
+    EXPECT_FLOAT_EQ(intersections[0].getV(), 0.25);
+    EXPECT_EQ(&intersections[0].getObject(), &mesh);
+
+    // Test a ray which misses the mesh
+    const gfx::Ray ray_miss{ 5, 1, -2, 0, 0, 1 };
+    EXPECT_TRUE(mesh.getObjectIntersections(ray_miss).empty());
+}
+
+// Tests finding the closest intersection and any intersection with a transformed mesh
+TEST(GraphicsTriangleMesh, ClosestAndAnyIntersection)
+{
+    // Rotate the grid to stand on its edge, so that a ray along the x-axis passes through the middle of the mesh
+    const gfx::TriangleMesh mesh{ gfx::createTranslationMatrix(1, 0, 0) * gfx::createYRotationMatrix(M_PI_2),
+                                  createGridMeshData(4) };
+    const gfx::Ray ray{ -5, 0.5, -0.5, 1, 0, 0 };
+
+    const auto closest_intersection{ mesh.getClosestIntersection(ray, 0, 100) };
+    ASSERT_TRUE(closest_intersection.has_value());
+    EXPECT_FLOAT_EQ(closest_intersection->getT(), 6);
+
+    EXPECT_FALSE(mesh.getClosestIntersection(ray, 0, 5).has_value());
+    EXPECT_TRUE(mesh.hasIntersectionWithin(ray, 0, 7));
+    EXPECT_FALSE(mesh.hasIntersectionWithin(ray, 0, 5));
+}
+
+// Tests calculating the surface normal of a flat shaded mesh
+TEST(GraphicsTriangleMesh, GetSurfaceNormalFlat)
+{
+    const gfx::TriangleMesh mesh{ createGridMeshData(2) };
+    const gfx::Ray ray{ 0.5, 0.25, -2, 0, 0, 1 };
+
+    const auto hit{ mesh.getClosestIntersection(ray, 0, 100) };
+    ASSERT_TRUE(hit.has_value());
+
+    const gfx::Vector4 normal_expected{ gfx::createVector(0, 0, -1) };
+    EXPECT_EQ(mesh.getSurfaceNormalAt(ray.position(hit->getT()), hit.value()), normal_expected);
+
+    // Test that a point alone gives the flat normal of the closest triangle, as for any other surface
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(0.5, 0.25, 0)), normal_expected);
+}
+
+// Tests that a point alone gives the flat normal of the triangle closest to it, whether the closest point of that
+// triangle is on its face, an edge, or a vertex
+TEST(GraphicsTriangleMesh, GetSurfaceNormalClosestTriangle)
+{
+    // Two triangles facing in different directions, one in the z = 0 plane and one in the x = 3 plane
+    const auto mesh_data{ std::make_shared<const gfx::TriangleMeshData>(
+            std::vector<gfx::Vector4>{ gfx::createPoint(0, 0, 0),
+                                       gfx::createPoint(1, 0, 0),
+                                       gfx::createPoint(0, 1, 0),
+                                       gfx::createPoint(3, 0, 0),
+                                       gfx::createPoint(3, 1, 0),
+                                       gfx::createPoint(3, 0, 1) },
+            std::vector<uint32_t>{ 0, 1, 2, 3, 4, 5 }) };
+    const gfx::TriangleMesh mesh{ gfx::createTranslationMatrix(0, 2, 0), mesh_data };
+
+    const gfx::Vector4 normal_a{ gfx::createVector(0, 0, -1) };
+    const gfx::Vector4 normal_b{ gfx::createVector(-1, 0, 0) };
+
+    // Test points closest to the face, an edge, and a vertex of the first triangle
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(0.25, 2.25, -0.5)), normal_a);
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(1, 3, 0.1)), normal_a);
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(-1, 1, 0)), normal_a);
+
+    // Test points closest to the face and a vertex of the second triangle, transformed by the mesh transform
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(2.8, 2.25, 0.25)), normal_b);
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(4, 2, 2)), normal_b);
+
+    // Test that a mesh without any triangles has no normal
+    const gfx::TriangleMesh empty_mesh{ std::make_shared<const gfx::TriangleMeshData>(
+            std::vector<gfx::Vector4>{ }, std::vector<uint32_t>{ }) };
+    EXPECT_THROW({ const gfx::Vector4 normal{ empty_mesh.getSurfaceNormalAt(gfx::createPoint(0, 0, 0)) }; },
+                 std::invalid_argument);
+}
+
+// Tests interpolating the vertex normals of a smooth shaded mesh
+TEST(GraphicsTriangleMesh, GetSurfaceNormalSmooth)
+{
+    const auto mesh_data{ std::make_shared<const gfx::TriangleMeshData>(
+            std::vector<gfx::Vector4>{ gfx::createPoint(0, 0, 0),
+                                       gfx::createPoint(1, 0, 0),
+                                       gfx::createPoint(0, 1, 0) },
+            std::vector<gfx::Vector4>{ gfx::createVector(0, 0, -1),
+                                       gfx::createVector(1, 0, 0),
+                                       gfx::createVector(0, 1, 0) },
+            std::vector<uint32_t>{ 0, 1, 2 }) };
+    const gfx::TriangleMesh mesh{ mesh_data };
+
+    // A hit at the second vertex uses its normal alone
+    const gfx::Intersection vertex_b_hit{ 1, &mesh, 0, 1, 0 };
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(1, 0, 0), vertex_b_hit), gfx::createVector(1, 0, 0));
+
+    // A hit between the second and third vertices blends their normals equally
+    const gfx::Intersection edge_hit{ 1, &mesh, 0, 0.5, 0.5 };
+    EXPECT_EQ(mesh.getSurfaceNormalAt(gfx::createPoint(0.5, 0.5, 0), edge_hit),
+              gfx::normalize(gfx::createVector(1, 1, 0)));
+}
\ No newline at end of file
@@ -3,8 +3,7 @@
 #include <algorithm>
 
 #include "surface.hpp"
-#include "util_functions.hpp"
-#include "shading_functions.hpp"
+#include "render_statistics.hpp"
 
 namespace gfx {
     // Point Light Constructor
@@ -16,145 +15,134 @@ namespace gfx {
     void World::addObject(const Object& object)
     {
         m_objects.push_back(object.clone());
+        m_is_finalized = false;
     }
 
     // Object Inserter (from pointer)
     void World::addObject(const std::shared_ptr<Object>& object)
     {
         m_objects.push_back(object);
+        m_is_finalized = false;
     }
 
-    // World Intersection Calculator
-    std::vector<Intersection> World::getAllIntersections(const Ray& ray) const
+    void World::finalize()
     {
-        std::vector<Intersection> world_intersections{ };
+        // Objects with infinite extents cannot be partitioned spatially, so they are kept in a separate list that
+        // is tested against every ray, with the remaining objects placed in the hierarchy
+        std::vector<BoundingBox> bounded_object_bounds{ };
+        m_bounded_object_indices.clear();
+        m_unbounded_object_indices.clear();
+        for (size_t object_index = 0; object_index < m_objects.size(); ++object_index) {
+            const BoundingBox object_bounds{ m_objects[object_index]->getLocalSpaceBounds() };
+            if (isFiniteBoundingBox(object_bounds)) {
+                bounded_object_bounds.push_back(object_bounds);
+                m_bounded_object_indices.push_back(object_index);
+            } else {
+                m_unbounded_object_indices.push_back(object_index);
+            }
+        }
 
-        // Determine intersections for each object and aggregate into a single list
+        m_bvh = BoundingVolumeHierarchy{ bounded_object_bounds };
+
+        // Compose the transforms through each group once, rather than walking up the tree at every shading point
         for (const auto& object : m_objects) {
-            std::vector<Intersection> object_intersections{ object->getObjectIntersections(ray) };
-            world_intersections.insert(world_intersections.end(),
-                                       object_intersections.begin(),
-                                       object_intersections.end());
+            object->cacheWorldTransform();
         }
+        m_is_finalized = true;
+    }
 
-        // Sort list and return
-        std::sort(world_intersections.begin(), world_intersections.end());
+    // World Intersection Calculator
+    std::vector<Intersection> World::getAllIntersections(const Ray& ray) const
+    {
+        std::vector<Intersection> world_intersections{ };
+        this->getAllIntersections(ray, world_intersections);
         return world_intersections;
     }
 
-    bool World::isShadowed(const Vector4& point) const
+    // World Intersection Calculator (into existing list)
+    void World::getAllIntersections(const Ray& ray, std::vector<Intersection>& world_intersections) const
     {
-        // Get the direction vector to the light source
-        const Vector4 light_source_displacement{ m_light_source.position - point };
-
-        // Cast a ray towards the light source to see if it intersects with any other object
-        const Ray shadow_ray( point, normalize(light_source_displacement));
-        const auto possible_hit{ getHit(this->getAllIntersections(shadow_ray)) };
-
-        // If the intersection occurs closer than the distance to the vector, the point is shadowed
-        if (possible_hit && utils::isLess(possible_hit.value().getT(), light_source_displacement.magnitude())) {
-            return true;
+        world_intersections.clear();
+        const auto add_object_intersections{ [&](const Object& object) {
+            object.appendObjectIntersections(ray, world_intersections);
+        } };
+
+        // Determine intersections for each object and aggregate into a single list, only testing objects whose
+        // bounding volumes are intersected by the ray once the hierarchy has been built
+        if (m_is_finalized) {
+            m_bvh.forEachCandidate(ray, [&](const uint32_t bvh_index) {
+                add_object_intersections(*m_objects[m_bounded_object_indices[bvh_index]]);
+            });
+            for (const size_t object_index : m_unbounded_object_indices) {
+                add_object_intersections(*m_objects[object_index]);
+            }
+        } else {
+            for (const auto& object : m_objects) {
+                add_object_intersections(*object);
+            }
         }
 
-        return false;
+        // Sort list
+        std::sort(world_intersections.begin(), world_intersections.end());
     }
 
-    Color World::calculatePixelColor(const Ray& ray, const int remaining_bounces) const
+    std::optional<Intersection> World::getClosestHit(const Ray& ray, const double t_min, double t_max) const
     {
-        // Get the list of intersections for the ray and check for a hit
-        const std::vector<Intersection> world_intersections{ this->getAllIntersections(ray) };
-        auto possible_hit{ getHit(world_intersections) };
-
-        // Hit found calculate the color at that position
-        if (possible_hit) {
-            // Pre-compute values to utilize in shadow, reflection, and refraction calculations
-            const DetailedIntersection detailed_hit{ possible_hit.value(), ray };
-            const bool is_shadowed{ this->isShadowed(detailed_hit.getOverPoint()) };
-            const Color reflected_color{ this->calculateReflectedColorAt(detailed_hit, remaining_bounces) };
-            const Color refracted_color{ this->calculateRefractedColorAt(detailed_hit,
-                                                                         world_intersections,
-                                                                         remaining_bounces) };
-
-            // Calculate the surface color using the shading model
-            Color surface_color{ calculateSurfaceColor(detailed_hit.getObject(),
-                                                       m_light_source,
-                                                       detailed_hit.getOverPoint(),
-                                                       detailed_hit.getSurfaceNormal(),
-                                                       detailed_hit.getViewVector(),
-                                                       is_shadowed) };
-
-            // Apply Fresnel Effect for reflective transparent materials,
-            const Material hit_material{ detailed_hit.getObject().getMaterial() };
-            if (utils::isGreater(hit_material.getProperties().reflectivity, 0.0) &&
-                utils::isGreater(hit_material.getProperties().transparency, 0.0))
-            {
-                const auto [ n1, n2 ] { getRefractiveIndices(detailed_hit, world_intersections) };
-                const double reflectance{ calculateReflectance(detailed_hit.getViewVector(),
-                                                               detailed_hit.getSurfaceNormal(),
-                                                               n1, n2) };
-                return surface_color + (reflected_color * reflectance) + (refracted_color * (1 - reflectance));
+        // Narrow the interval as each closer intersection is found, so more distant objects can be skipped
+        std::optional<Intersection> closest_hit{ std::nullopt };
+        const auto test_object{ [&](const Object& object) {
+            const auto object_hit{ object.getClosestIntersection(ray, t_min, t_max) };
+            if (object_hit) {
+                closest_hit = object_hit;
+                t_max = object_hit->getT();
+            }
+        } };
+
+        if (m_is_finalized) {
+            m_bvh.forEachCandidate(ray, t_min, t_max, [&](const uint32_t bvh_index) {
+                test_object(*m_objects[m_bounded_object_indices[bvh_index]]);
+            });
+            for (const size_t object_index : m_unbounded_object_indices) {
+                test_object(*m_objects[object_index]);
+            }
+        } else {
+            for (const auto& object : m_objects) {
+                test_object(*object);
             }
-
-            // Otherwise return calculated color
-            return surface_color + reflected_color + refracted_color;
-        }
-        // No hit found, return black
-        else {
-            return black();
         }
+
+        return closest_hit;
     }
 
-    Color World::calculateReflectedColorAt(const DetailedIntersection& intersection, int remaining_bounces) const
+    bool World::hasIntersectionWithin(const Ray& ray, const double t_min, const double t_max) const
     {
-        // Bounce a ray to see what colors the reflective surface picks up
-        const Material& object_material{ intersection.getObject().getMaterial() };
-        const double object_reflectivity{ object_material.getProperties().reflectivity };
-        if (utils::areNotEqual(object_reflectivity, 0.0) && remaining_bounces > 0) {
-            const Ray reflection_vector{ intersection.getOverPoint(),
-                                         intersection.getReflectionVector() };
-            return object_reflectivity * this->calculatePixelColor(reflection_vector, remaining_bounces - 1);
-        }
-        // Non-reflective surface, return black
-        else {
-            return black();
+        const auto is_object_intersected{ [&](const std::shared_ptr<Object>& object_ptr) {
+            return object_ptr->hasIntersectionWithin(ray, t_min, t_max);
+        } };
+
+        if (m_is_finalized) {
+            return
+                    m_bvh.anyOfCandidates(ray, t_min, t_max, [&](const uint32_t bvh_index) {
+                        return is_object_intersected(m_objects[m_bounded_object_indices[bvh_index]]);
+                    }) ||
+                    std::any_of(m_unbounded_object_indices.begin(), m_unbounded_object_indices.end(),
+                                [&](const size_t object_index) {
+                                    return is_object_intersected(m_objects[object_index]);
+                                });
         }
+
+        return std::any_of(m_objects.begin(), m_objects.end(), is_object_intersected);
     }
 
-    Color World::calculateRefractedColorAt(const DetailedIntersection& intersection,
-                                           const std::vector<Intersection>& possible_overlaps,
-                                           const int remaining_bounces) const
+    bool World::isShadowed(const Vector4& point) const
     {
-        const Material& object_material{ intersection.getObject().getMaterial() };
-        const double object_transparency{ object_material.getProperties().transparency };
-        if (utils::areNotEqual(object_transparency, 0.0) && remaining_bounces > 0) {
-            // Calculate the trig values for the angles of refraction using Snell's Law: θᵢ/θᵣ = n2/n1
-            // Assume θᵢ is the angle of incidence and θᵣ is the angle of refraction
-            const auto [ n1, n2 ] { getRefractiveIndices(intersection, possible_overlaps) };
-            const Vector4 view_vector{ intersection.getViewVector() };
-            const Vector4 normal_vector{ intersection.getSurfaceNormal() };
-
-            // θᵢ is formed by the view vector and the normal, so the cos(θᵢ) is their dot product
-            const double cos_i{ dotProduct(view_vector, normal_vector) };
-
-            // Using the identity sin²θ + cos²θ = 1 gives us sin²(θᵣ) = (n1 / n2)² * (1 - cos²(θᵢ))
-            const double n_ratio{ n1 / n2 };
-            const double sin2_r{ std::pow(n_ratio, 2) * (1 - std::pow(cos_i, 2)) };
-
-            // Total internal reflection occurs when no real solution exists for θᵣ, i.e. when sin²(θᵣ) exceeds 1
-            if (utils::isGreater(sin2_r, 1.0)) {
-                return black();
-            }
-
-            // Use the refraction formula to calculate the refraction direction and create the refraction ray
-            const double cos_r{ std::sqrt(1 - sin2_r) };
-            const Ray refraction_ray{ intersection.getUnderPoint(),
-                                      normal_vector * (n_ratio * cos_i - cos_r) - view_vector * n_ratio };
+        // Get the direction vector to the light source
+        const Vector4 light_source_displacement{ m_light_source.position - point };
+        const double light_source_distance{ light_source_displacement.magnitude() };
 
-            // Recursively calculate the refracted color
-            return object_transparency * this->calculatePixelColor(refraction_ray, remaining_bounces - 1) ;
-        } else {
-            // Opaque object or maximum recursion, return black
-            return black();
-        }
+        // Cast a ray towards the light source, the point is shadowed if any object lies between it and the light
+        const Ray shadow_ray{ point, normalize(light_source_displacement) };
+        RenderStatisticsCollector::recordRay(RayType::Shadow);
+        return this->hasIntersectionWithin(shadow_ray, 0, light_source_distance);
     }
-}
\ No newline at end of file
+}
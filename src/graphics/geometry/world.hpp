@@ -2,11 +2,14 @@
 
 #include <vector>
 #include <memory>
+#include <limits>
+#include <optional>
 
 #include "light.hpp"
 #include "vector4.hpp"
 #include "ray.hpp"
 #include "intersection.hpp"
+#include "bounding_volume_hierarchy.hpp"
 
 namespace gfx {
     class Object;
@@ -30,14 +33,17 @@ namespace gfx {
                 : m_light_source{ Color{ 1, 1, 1 },
                                   createPoint(-10, 10, -10) },
                 m_objects { first_object_ptr, remaining_object_ptrs...  }
-        {}
+        { this->finalize(); }
 
         template<typename... ObjectRefs>
         explicit World(const Object& first_object_ref,
                        const ObjectRefs&... remaining_object_refs)
                 : m_light_source{ Color{ 1, 1, 1 },
                                   createPoint(-10, 10, -10) }
-        { addObjects(first_object_ref, remaining_object_refs...); }
+        {
+            addObjects(first_object_ref, remaining_object_refs...);
+            this->finalize();
+        }
 
         // Standard Constructors
         template<typename... ObjectPtrs>
@@ -46,14 +52,17 @@ namespace gfx {
               const ObjectPtrs&... remaining_objects)
                 : m_light_source{ light_source },
                 m_objects { first_object, remaining_objects...  }
-        {}
+        { this->finalize(); }
 
         template<typename... ObjectRefs>
         World(const PointLight& light_source,
               const Object& first_object,
               const ObjectRefs&... remaining_objects)
                 : m_light_source{ light_source }
-        { addObjects(first_object, remaining_objects...); }
+        {
+            addObjects(first_object, remaining_objects...);
+            this->finalize();
+        }
 
         // Copy Constructor
         World(const World&) = default;
@@ -84,31 +93,47 @@ namespace gfx {
         [[nodiscard]] const Object& getObjectAt(const size_t index) const
         { return *m_objects.at(index); }
 
+        // Returns true if the bounding volume hierarchy is up-to-date with the objects in the world
+        [[nodiscard]] bool isFinalized() const
+        { return m_is_finalized; }
+
+        [[nodiscard]] const BoundingVolumeHierarchy& getBoundingVolumeHierarchy() const
+        { return m_bvh; }
+
         /* Mutators */
 
-        // Adds a single object to the world
+        // Adds a single object to the world, invalidating the bounding volume hierarchy
         void addObject(const Object& object);
         void addObject(const std::shared_ptr<Object>& object);
 
+        // Builds the bounding volume hierarchy over the objects in the world and caches the composed world transform
+        // of every object and descendant. Until this is called, intersection queries test every object in the world,
+        // so it should be called once the scene has been fully assembled. Objects must not be transformed after the
+        // world is finalized.
+        void finalize();
+
         /* Ray-Tracing Operations */
 
         // Returns a sorted list of all intersections with objects in this world with a passed-in Ray
         [[nodiscard]] std::vector<Intersection> getAllIntersections(const Ray& ray) const;
 
-        // Returns true if the passed-in position is in shadow
-        [[nodiscard]] bool isShadowed(const Vector4& point) const;
+        // Replaces the contents of the passed-in list with the sorted list of all intersections with a ray, reusing
+        // the list's existing storage
+        void getAllIntersections(const Ray& ray, std::vector<Intersection>& world_intersections) const;
 
-        // Returns the pixel color for the ray hit using pre-computed vector data for that point in world space
-        [[nodiscard]] Color calculatePixelColor(const Ray& ray, int remaining_bounces = 5) const;
+        // Returns the intersection closest to the ray origin with a t-value within the interval [t_min, t_max],
+        // without building the full list of intersections
+        [[nodiscard]] std::optional<Intersection> getClosestHit(
+                const Ray& ray,
+                double t_min = 0,
+                double t_max = std::numeric_limits<double>::infinity()) const;
 
-        // Returns the reflected color at a ray-object intersection
-        [[nodiscard]] Color calculateReflectedColorAt(const DetailedIntersection& intersection,
-                                                      int remaining_bounces = 5) const;
+        // Returns true if any object in this world intersects the ray at a t-value satisfying t_min <= t < t_max,
+        // stopping at the first such intersection found
+        [[nodiscard]] bool hasIntersectionWithin(const Ray& ray, double t_min, double t_max) const;
 
-        // Returns the refracted color at a ray-object intersection
-        [[nodiscard]] Color calculateRefractedColorAt(const DetailedIntersection& intersection,
-                                                      const std::vector<Intersection>& possible_overlaps,
-                                                      int remaining_bounces = 5) const;
+        // Returns true if the passed-in position is in shadow
+        [[nodiscard]] bool isShadowed(const Vector4& point) const;
 
     private:
         /* Data Members */
@@ -116,6 +141,10 @@ namespace gfx {
         PointLight m_light_source{ Color{ 1, 1, 1 },
                                    createPoint(-10, 10, -10) };
         std::vector<std::shared_ptr<Object>> m_objects{ };
+        BoundingVolumeHierarchy m_bvh{ };
+        std::vector<size_t> m_bounded_object_indices{ };      // Maps hierarchy primitive indices to objects
+        std::vector<size_t> m_unbounded_object_indices{ };    // Objects with infinite bounds, i.e. planes
+        bool m_is_finalized{ false };
 
         /* Helper Methods */
 
@@ -1,16 +1,16 @@
 #include "gtest/gtest.h"
 #include "world.hpp"
 
+#include <cmath>
 #include <vector>
 
 #include "light.hpp"
-#include "surface.hpp"
 #include "sphere.hpp"
 #include "ray.hpp"
 #include "transform.hpp"
 #include "intersection.hpp"
 #include "plane.hpp"
-#include "pattern_texture_3d.hpp"
+#include "util_functions.hpp"
 
 static const gfx::World default_world {
     gfx::PointLight { gfx::Color{ 1, 1, 1 },
@@ -142,317 +142,163 @@ TEST(GraphicsWorld, WorldIntersections)
     EXPECT_FLOAT_EQ(world_intersections.at(3).getT(), 6);
 }
 
-// Tests calculating whether various points are in shadow
-TEST(GraphicsWorld, PointIsShadowed)
-{
-    // Test a point where nothing is collinear with point and light source
-    ASSERT_FALSE(default_world.isShadowed(gfx::createPoint(0, 10, 0)));
-
-    // Test a point where an object is between the point and the light
-    ASSERT_TRUE(default_world.isShadowed(gfx::createPoint(10, -10, 10)));
-
-    // Test a point where the light source is between the point and an object
-    ASSERT_FALSE(default_world.isShadowed(gfx::createPoint(-20, 20, -20)));
-
-    // Test a point where the point is between an object and the light source
-    ASSERT_FALSE(default_world.isShadowed(gfx::createPoint(-2, 2, -2)));
-}
-
-// Test shading a color when a ray misses all objects in a world
-TEST(GraphicsWorld, CalculatePixelColorMiss)
-{
-    const gfx::Ray ray{ 0, 0, -5,
-                        0, 1, 0 };
-
-    const gfx::Color pixel_color_expected{ 0, 0, 0 };
-    const gfx::Color pixel_color_actual{ default_world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
-}
-
-// Test shading a color when a ray hits an object in world from the outside
-TEST(GraphicsWorld, CalculatePixelColorHitOutside)
+// Tests that adding an object to a finalized world invalidates the bounding volume hierarchy
+TEST(GraphicsWorld, FinalizeWorld)
 {
-    const gfx::Ray ray{ 0, 0, -5,
-                        0, 0, 1 };
-
-    const gfx::Color pixel_color_expected{ 0.380661, 0.475827, 0.285496  };
-    const gfx::Color pixel_color_actual{ default_world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
-}
-
-// Test shading a color when a ray hits an object in world from the inside
-TEST(GraphicsWorld, CalculatePixelColorHitInside)
-{
-    const gfx::MaterialProperties properties{ .diffuse = 0.7, .specular = 0.2 };
-    const gfx::Material material{ 0.8, 1.0, 0.6, properties };
-
-    const gfx::Sphere sphere_a{ material };
-    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5) };
-    const gfx::PointLight light_source{ gfx::Color{ 1, 1, 1 },
-                                        gfx::createPoint( 0, 0.25, 0 )};
-    const gfx::World world{ light_source, sphere_a, sphere_b };
-    const gfx::Ray ray{ 0, 0, 0,
-                        0, 0, 1 };
-
-    const gfx::Color pixel_color_expected{ 0.904984, 0.904984, 0.904984  };
-    const gfx::Color pixel_color_actual{ world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
-}
+    gfx::World world{ };
 
-// Test shading a color when a ray intersection is behind the ray origin
-TEST(GraphicsWorld, CalculatePixelColorHitBehind)
-{
-    const gfx::MaterialProperties properties_a{ .ambient = 1, .diffuse = 0.7, .specular = 0.2 };
-    const gfx::Material sphere_a_material{  0.8, 1.0, 0.6, properties_a };
-    const gfx::Sphere sphere_a{ sphere_a_material };
+    world.addObject(gfx::Sphere{ });
+    EXPECT_FALSE(world.isFinalized());
 
-    const gfx::Material sphere_b_material{ gfx::MaterialProperties{ .ambient = 1 } };
-    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5), sphere_b_material };
+    world.finalize();
+    EXPECT_TRUE(world.isFinalized());
+    EXPECT_EQ(world.getBoundingVolumeHierarchy().getPrimitiveCount(), 1);
 
-    const gfx::PointLight light_source{ gfx::Color{ 1, 1, 1 },
-                                        gfx::createPoint( 0, 0.25, 0 )};
-    const gfx::World world{ light_source, sphere_a, sphere_b };
-    const gfx::Ray ray{ 0, 0, 0.75,
-                        0, 0, -1 };
+    world.addObject(gfx::Plane{ });
+    EXPECT_FALSE(world.isFinalized());
 
-    const gfx::Color pixel_color_expected{ gfx::white() };
-    const gfx::Color pixel_color_actual{ world.calculatePixelColor(ray) };
+    // Planes have infinite bounds and are excluded from the hierarchy
+    world.finalize();
+    EXPECT_TRUE(world.isFinalized());
+    EXPECT_EQ(world.getBoundingVolumeHierarchy().getPrimitiveCount(), 1);
 
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+    // Finalizing caches the world transform of every object
+    EXPECT_TRUE(world.getObjectAt(0).hasCachedWorldTransform());
+    EXPECT_TRUE(world.getObjectAt(1).hasCachedWorldTransform());
 }
 
-// Tests shading a color when a ray intersection point is in shadow
-TEST(GraphicsWorld, CalculatePixelColorInShadow)
+// Tests that world intersections are identical with and without the bounding volume hierarchy
+TEST(GraphicsWorld, WorldIntersectionsFinalized)
 {
-    gfx::Sphere sphere_a{ };
-    gfx::Sphere sphere_b{ gfx::createTranslationMatrix(0, 0, 10) };
-    const gfx::PointLight light_source{ gfx::Color{ 1, 1, 1 },
-                                        gfx::createPoint( 0, 0, -10 )};
-    const gfx::World world{ light_source, sphere_a, sphere_b };
-    const gfx::Ray ray{ 0, 0, 5,
-                        0, 0, 1 };
-
-    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
-    const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(ray) };
-    auto possible_hit{ getHit(world_intersections) };
-
-    ASSERT_TRUE(possible_hit);
-    const gfx::Intersection intersection_expected{ 4, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(1)) };
-    const gfx::Intersection& intersection_actual{ possible_hit.value() };
-
-    EXPECT_EQ(intersection_actual, intersection_expected);
-
-    const gfx::Color pixel_color_expected{ 0.1, 0.1, 0.1 };
-    const gfx::Color pixel_color_actual{ world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+    gfx::World world{ };
+    for (int x = -4; x <= 4; ++x) {
+        for (int z = -4; z <= 4; ++z) {
+            world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(x * 3, 0, z * 3) *
+                                         gfx::createScalingMatrix(0.5 + 0.1 * ((x + z) % 3)) });
+        }
+    }
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0) });
+
+    std::vector<gfx::Ray> rays{ };
+    for (int i = 0; i < 64; ++i) {
+        const double angle{ i * 0.1 };
+        rays.emplace_back(gfx::createPoint(std::cos(angle) * 20, 5, std::sin(angle) * 20),
+                          gfx::normalize(gfx::createVector(-std::cos(angle) * 20 + i % 5, -5, -std::sin(angle) * 20)));
+    }
+
+    std::vector<std::vector<gfx::Intersection>> intersections_expected{ };
+    for (const auto& ray : rays) {
+        intersections_expected.push_back(world.getAllIntersections(ray));
+    }
+
+    world.finalize();
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(rays[i]) };
+        ASSERT_EQ(world_intersections.size(), intersections_expected[i].size());
+        for (size_t j = 0; j < world_intersections.size(); ++j) {
+            EXPECT_EQ(world_intersections[j], intersections_expected[i][j]);
+        }
+    }
 }
 
-// Tests calculating the reflected color for a non-reflective material
-TEST(GraphicsWorld, CalculateReflectedColorNonReflective)
+// Tests finding the closest hit along a ray
+TEST(GraphicsWorld, GetClosestHit)
 {
-    const gfx::Ray ray{ 0, 0, 1,
+    const gfx::Ray ray{ 0, 0, -5,
                         0, 0, 1 };
 
-    const gfx::Intersection base_intersection{ 1, dynamic_cast<const gfx::Surface*>(&default_world.getObjectAt(1)) };
-    const gfx::DetailedIntersection detailed_intersection{ base_intersection, ray };
-
-    const gfx::Color color_expected{ gfx::black() };
-    const gfx::Color color_actual{ default_world.calculateReflectedColorAt(detailed_intersection) };
-    EXPECT_EQ(color_actual, color_expected);
+    const auto closest_hit{ default_world.getClosestHit(ray) };
+    ASSERT_TRUE(closest_hit);
+    EXPECT_EQ(closest_hit.value(), gfx::getHit(default_world.getAllIntersections(ray)).value());
+    EXPECT_FLOAT_EQ(closest_hit->getT(), 4);
+
+    // Restricting the interval skips intersections outside of it
+    const auto interval_hit{ default_world.getClosestHit(ray, 4.25, 5) };
+    ASSERT_TRUE(interval_hit);
+    EXPECT_FLOAT_EQ(interval_hit->getT(), 4.5);
+    EXPECT_FALSE(default_world.getClosestHit(ray, 0, 3.5));
+
+    // Rays originating inside an object hit it from within
+    const gfx::Ray inside_ray{ 0, 0, 0,
+                               0, 0, 1 };
+    const auto inside_hit{ default_world.getClosestHit(inside_ray) };
+    ASSERT_TRUE(inside_hit);
+    EXPECT_FLOAT_EQ(inside_hit->getT(), 0.5);
 }
 
-// Tests calculating the reflected color for a reflective material
-TEST(GraphicsWorld, CalculateReflectedColorReflective)
+// Tests that the closest hit matches the first non-negative intersection in a world with many objects
+TEST(GraphicsWorld, GetClosestHitFinalized)
 {
-    gfx::World world{ default_world };
-
-    const gfx::Material plane_material{ gfx::MaterialProperties{ .reflectivity = 0.5 }};
-    const gfx::Plane plane{ gfx::createTranslationMatrix(0, -1, 0), plane_material };
-    world.addObject(plane);
-
-    const gfx::Ray ray{ 0, 0, -3,
-                        0, -M_SQRT2 / 2, M_SQRT2 /2 };
-
-    const gfx::DetailedIntersection intersection{ gfx::Intersection{ M_SQRT2, &plane }, ray };
-
-    const gfx::Color color_expected{ 0.190331, 0.237913, 0.142748 };
-    const gfx::Color color_actual{ world.calculateReflectedColorAt(intersection) };
-    EXPECT_EQ(color_actual, color_expected);
+    gfx::World world{ };
+    for (int x = -3; x <= 3; ++x) {
+        for (int z = -3; z <= 3; ++z) {
+            world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(x * 2.5, 0, z * 2.5) });
+        }
+    }
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0) });
+    world.finalize();
+
+    for (int i = 0; i < 32; ++i) {
+        const gfx::Ray ray{ gfx::createPoint(i * 0.4 - 6, 0.5, -12),
+                            gfx::normalize(gfx::createVector(0.05 * (i % 4), -0.1 * (i % 3), 1)) };
+        const auto hit_expected{ gfx::getHit(world.getAllIntersections(ray)) };
+        const auto hit_actual{ world.getClosestHit(ray) };
+
+        ASSERT_EQ(hit_actual.has_value(), hit_expected.has_value());
+        if (hit_expected) {
+            EXPECT_EQ(hit_actual.value(), hit_expected.value());
+        }
+    }
 }
 
-// Tests shading a color on a surface with a reflective material
-TEST(GraphicsWorld, CalculatePixelColorReflectiveMaterial)
+// Tests calculating whether various points are in shadow
+TEST(GraphicsWorld, PointIsShadowed)
 {
-    gfx::World world{ default_world };
-
-    const gfx::Material plane_material{ gfx::MaterialProperties{ .reflectivity = 0.5 } };
-    const gfx::Plane plane{ gfx::createTranslationMatrix(0, -1, 0), plane_material };
-    world.addObject(plane);
-
-    const gfx::Ray ray{ 0, 0, -3,
-                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
-
-    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
-    const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(ray) };
-    auto possible_hit{ getHit(world_intersections) };
-
-    ASSERT_TRUE(possible_hit);
-    const gfx::Intersection intersection_expected{ M_SQRT2, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(2)) };
-    const gfx::Intersection& intersection_actual{ possible_hit.value() };
-
-    EXPECT_EQ(intersection_actual, intersection_expected);
-
-    const gfx::Color pixel_color_expected{ 0.876756, 0.924339, 0.829173 };
-    const gfx::Color pixel_color_actual{ world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
-}
+    // Test a point where nothing is collinear with point and light source
+    ASSERT_FALSE(default_world.isShadowed(gfx::createPoint(0, 10, 0)));
 
-// Tests calculating the refracted color for an opaque material
-TEST(GraphicsWorld, CalculateRefractedColorOpaque)
-{
-    const gfx::Ray ray{ 0, 0, -5,
-                        0, 0, 1 };
+    // Test a point where an object is between the point and the light
+    ASSERT_TRUE(default_world.isShadowed(gfx::createPoint(10, -10, 10)));
 
-    const std::vector<gfx::Intersection> world_intersections{ default_world.getAllIntersections(ray) };
-    const gfx::DetailedIntersection hit{ world_intersections[0], ray };
+    // Test a point where the light source is between the point and an object
+    ASSERT_FALSE(default_world.isShadowed(gfx::createPoint(-20, 20, -20)));
 
-    const gfx::Color color_expected{ gfx::black() };
-    const gfx::Color color_actual{ default_world.calculateRefractedColorAt(hit, world_intersections) };
-    EXPECT_EQ(color_actual, color_expected);
+    // Test a point where the point is between an object and the light source
+    ASSERT_FALSE(default_world.isShadowed(gfx::createPoint(-2, 2, -2)));
 }
 
-// Tests calculating the refracted color at the maximum recursive depth
-TEST(GraphicsWorld, CalculateRefractedColorMaximumDepth)
+// Tests checking for any intersection within an interval along a ray
+TEST(GraphicsWorld, HasIntersectionWithin)
 {
     const gfx::Ray ray{ 0, 0, -5,
                         0, 0, 1 };
 
-    const std::vector<gfx::Intersection> world_intersections{ default_world.getAllIntersections(ray) };
-    const gfx::DetailedIntersection hit{ world_intersections[0], ray };
-
-    const gfx::Color color_expected{ gfx::black() };
-    const gfx::Color color_actual{ default_world.calculateRefractedColorAt(hit,
-                                                                           world_intersections,
-                                                                           0) };
-    EXPECT_EQ(color_actual, color_expected);
+    EXPECT_TRUE(default_world.hasIntersectionWithin(ray, 0, 10));
+    EXPECT_TRUE(default_world.hasIntersectionWithin(ray, 4.25, 4.75));
+    EXPECT_FALSE(default_world.hasIntersectionWithin(ray, 0, 4));
+    EXPECT_FALSE(default_world.hasIntersectionWithin(ray, 6.5, 10));
 }
 
-// Tests calculating the refracted color under total internal reflection
-TEST(GraphicsWorld, CalculateRefractedColorTotalInternalReflection)
+// Tests that shadow queries match the first hit along the shadow ray in a world with many objects
+TEST(GraphicsWorld, PointIsShadowedFinalized)
 {
-    const gfx::MaterialProperties properties_a{ .diffuse = 0.7,
-                                                .specular = 0.2,
-                                                .transparency = 1,
-                                                .refractive_index = 1.5 };
-    const gfx::Material sphere_a_material{ 0.8, 1.0, 0.6, properties_a };
-    const gfx::Sphere sphere_a{ sphere_a_material };
-    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5) };
-
-    const gfx::World world{ sphere_a, sphere_b };
-    const gfx::Ray ray{ 0, 0, M_SQRT2 / 2,
-                        0, 1, 0 };
-
-    const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(ray) };
-    const gfx::DetailedIntersection hit{ world_intersections[1], ray };
-
-    const gfx::Color color_expected{ gfx::black() };
-    const gfx::Color color_actual{ world.calculateRefractedColorAt(hit, world_intersections) };
-    EXPECT_EQ(color_actual, color_expected);
-}
-
-// Tests calculating the refracted color using refraction rays
-TEST(GraphicsWorld, CalculateRefractedColor)
-{
-    const gfx::MaterialProperties properties_a{ .ambient = 1, .diffuse = 0.7, .specular = 0.2 };
-    const TestPattern3D sphere_a_texture{ };
-    const gfx::Material sphere_a_material{ sphere_a_texture, properties_a };
-    const gfx::Sphere sphere_a{ sphere_a_material };
-
-    const gfx::MaterialProperties properties_b{ .transparency = 1, .refractive_index = 1.5 };
-    const gfx::Material sphere_b_material{ properties_b };
-    const gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5), sphere_b_material };
-
-    const gfx::World world{ sphere_a, sphere_b };
-
-    const gfx::Ray ray{ 0, 0, 0.1,
-                        0, 1, 0 };
-
-    const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(ray) };
-    const gfx::DetailedIntersection hit{ world_intersections[2], ray };
-
-    const gfx::Color color_expected{ 0, 0.998883, 0.047216 };
-    const gfx::Color color_actual{ world.calculateRefractedColorAt(hit, world_intersections) };
-    EXPECT_EQ(color_actual, color_expected);
-}
-
-// Tests shading pixels in a refractive (transparent) material
-TEST(GraphicsWorld, CalculatePixelColorTransparentMaterial)
-{
-    gfx::World world{ default_world };
-
-    const gfx::Material floor_material{ gfx::MaterialProperties{ .transparency = 0.5, .refractive_index = 1.5 } };
-    const gfx::Plane floor{ gfx::createTranslationMatrix(0, -1, 0), floor_material };
-    world.addObject(floor);
-
-    const gfx::Material ball_material{ 1, 0, 0, gfx::MaterialProperties{ .ambient = 0.5 } };
-    const gfx::Sphere ball{ gfx::createTranslationMatrix(0, -3.5, -0.5), ball_material };
-    world.addObject(ball);
-
-    const gfx::Ray ray{ 0, 0, -3,
-                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
-
-    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
-    const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(ray) };
-    auto possible_hit{ getHit(world_intersections) };
-
-    ASSERT_TRUE(possible_hit);
-    const gfx::Intersection intersection_expected{ M_SQRT2, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(2)) };
-    const gfx::Intersection& intersection_actual{ possible_hit.value() };
-
-    EXPECT_EQ(intersection_actual, intersection_expected);
-
-    const gfx::Color pixel_color_expected{ 0.936425, 0.686425, 0.686425 };
-    const gfx::Color pixel_color_actual{ world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
+    gfx::World world{ gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) } };
+    for (int x = -3; x <= 3; ++x) {
+        for (int z = -3; z <= 3; ++z) {
+            world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(x * 2.5, 0, z * 2.5) });
+        }
+    }
+    world.finalize();
+
+    for (int x = -8; x <= 8; ++x) {
+        for (int z = -8; z <= 8; ++z) {
+            const gfx::Vector4 point{ gfx::createPoint(x, -1.5, z) };
+            const gfx::Vector4 light_displacement{ world.getLightSource().position - point };
+            const gfx::Ray shadow_ray{ point, gfx::normalize(light_displacement) };
+            const auto hit{ gfx::getHit(world.getAllIntersections(shadow_ray)) };
+            const bool is_shadowed_expected{ hit && utils::isLess(hit->getT(), light_displacement.magnitude()) };
+
+            EXPECT_EQ(world.isShadowed(point), is_shadowed_expected);
+        }
+    }
 }
-
-// Tests shading pixels in a material that is both refractive and reflective
-TEST(GraphicsWorld, CalculatePixelColorReflectiveTransparentMaterial)
-{
-    gfx::World world{ default_world };
-
-    const gfx::MaterialProperties floor_material_properties{ .reflectivity = 0.5,
-                                                             .transparency = 0.5,
-                                                             .refractive_index = 1.5 };
-    const gfx::Material floor_material{ floor_material_properties };
-    const gfx::Plane floor{ gfx::createTranslationMatrix(0, -1, 0), floor_material };
-    world.addObject(floor);
-
-    const gfx::Material ball_material{ 1, 0, 0, gfx::MaterialProperties{ .ambient = 0.5 } };
-    const gfx::Sphere ball{ gfx::createTranslationMatrix(0, -3.5, -0.5), ball_material };
-    world.addObject(ball);
-
-    const gfx::Ray ray{ 0, 0, -3,
-                        0, -M_SQRT2 / 2, M_SQRT2 / 2 };
-
-    // Validate state is correctly initialized before repeating this calculation in calculatePixelColor()
-    const std::vector<gfx::Intersection> world_intersections{ world.getAllIntersections(ray) };
-    auto possible_hit{ getHit(world_intersections) };
-
-    ASSERT_TRUE(possible_hit);
-    const gfx::Intersection intersection_expected{ M_SQRT2, dynamic_cast<const gfx::Surface*>(&world.getObjectAt(2)) };
-    const gfx::Intersection& intersection_actual{ possible_hit.value() };
-
-    EXPECT_EQ(intersection_actual, intersection_expected);
-
-    const gfx::Color pixel_color_expected{ 0.933915, 0.696434, 0.692431 };
-    const gfx::Color pixel_color_actual{ world.calculatePixelColor(ray) };
-
-    EXPECT_EQ(pixel_color_actual, pixel_color_expected);
-}
\ No newline at end of file
@@ -8,7 +8,7 @@ namespace gfx {
     {
         return
                 utils::areEqual(ambient, rhs.ambient) &&
-                utils::areEqual(ambient, rhs.ambient) &&
+                utils::areEqual(diffuse, rhs.diffuse) &&
                 utils::areEqual(specular, rhs.specular) &&
                 utils::areEqual(shininess, rhs.shininess) &&
                 utils::areEqual(reflectivity, rhs.reflectivity) &&
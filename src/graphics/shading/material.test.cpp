@@ -283,6 +283,12 @@ TEST(GraphicsMaterial, Mutators)
             gfx::black()
             ));
     EXPECT_EQ(material.getTexture(), pattern_expected);
+
+    // Test that a texture moved in by pointer stays shared, so changes made through the pointer are sampled
+    const auto shared_texture_ptr{ std::make_shared<gfx::ColorTexture>(gfx::white()) };
+    material.setTexture(std::shared_ptr<gfx::Texture>{ shared_texture_ptr });
+    *shared_texture_ptr = gfx::ColorTexture{ gfx::red() };
+    EXPECT_EQ(material.getTexture().getTextureColorAt(gfx::createPoint(0, 0, 0), gfx::ProjectionMap), gfx::red());
 }
 
 // Tests creating a glassy material using the factory function
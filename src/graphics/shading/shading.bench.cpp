@@ -0,0 +1,168 @@
+#include "benchmark/benchmark.h"
+#include "shading_functions.hpp"
+
+#include <functional>
+#include <vector>
+
+#include "material.hpp"
+#include "sphere.hpp"
+#include "light.hpp"
+#include "transform.hpp"
+#include "intersection.hpp"
+#include "world.hpp"
+#include "compiled_texture.hpp"
+#include "texture_map.hpp"
+#include "color_texture.hpp"
+#include "gradient_texture_3d.hpp"
+#include "stripe_pattern_3d.hpp"
+#include "ring_pattern_3d.hpp"
+#include "checkered_pattern_3d.hpp"
+
+// Benchmarks shading a surface point with the Phong shading model
+static void BM_CalculateSurfaceColor(benchmark::State& state)
+{
+    const gfx::Sphere sphere{ gfx::Material{ } };
+    const gfx::PointLight point_light{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) };
+    gfx::Vector4 surface_position{ 0, 0, -1, 1 };
+    const gfx::Vector4 surface_normal{ 0, 0, -1, 0 };
+    const gfx::Vector4 view_vector{ normalize(gfx::createVector(0.2, 0.3, -1)) };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(surface_position);
+        benchmark::DoNotOptimize(gfx::calculateSurfaceColor(sphere,
+                                                            point_light,
+                                                            surface_position,
+                                                            surface_normal,
+                                                            view_vector));
+    }
+}
+BENCHMARK(BM_CalculateSurfaceColor);
+
+// Benchmarks finding the refractive indices at each intersection through three overlapping glass spheres
+static void BM_GetRefractiveIndices(benchmark::State& state)
+{
+    const gfx::MaterialProperties glassy_properties_a{ .transparency = 1, .refractive_index = 1.5 };
+    const gfx::MaterialProperties glassy_properties_b{ .transparency = 1, .refractive_index = 2.0 };
+    const gfx::MaterialProperties glassy_properties_c{ .transparency = 1, .refractive_index = 2.5 };
+    const gfx::Sphere glass_sphere_a{ gfx::createScalingMatrix(2), gfx::Material{ glassy_properties_a } };
+    const gfx::Sphere glass_sphere_b{ gfx::createTranslationMatrix(0, 0, -0.25), gfx::Material{ glassy_properties_b } };
+    const gfx::Sphere glass_sphere_c{ gfx::createTranslationMatrix(0, 0, 0.25), gfx::Material{ glassy_properties_c } };
+    const gfx::World world{ glass_sphere_a, glass_sphere_b, glass_sphere_c };
+    const std::vector<gfx::Intersection> intersections{ world.getAllIntersections(gfx::Ray{ 0, 0, -4, 0, 0, 1 }) };
+
+    for (auto _ : state) {
+        for (const gfx::Intersection& intersection : intersections) {
+            benchmark::DoNotOptimize(gfx::getRefractiveIndices(intersection, intersections));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(intersections.size()));
+}
+BENCHMARK(BM_GetRefractiveIndices);
+// Returns a checkered pattern of rings and stripes, three levels deep with a transform at each level
+static gfx::CheckeredPattern3D createNestedPattern()
+{
+    const gfx::StripePattern3D stripe_pattern{ gfx::createScalingMatrix(0.25, 0.25, 0.25), gfx::red(), gfx::green() };
+    const gfx::GradientTexture3D gradient{ gfx::createXRotationMatrix(M_PI_2), gfx::blue(), gfx::yellow() };
+    const gfx::RingPattern3D ring_pattern{ gfx::createTranslationMatrix(1, 0, 1), stripe_pattern, gradient };
+    return gfx::CheckeredPattern3D{ gfx::createYRotationMatrix(M_PI_4),
+                                    ring_pattern,
+                                    gfx::StripePattern3D{ gfx::cyan(), gfx::magenta() } };
+}
+
+// Returns points along a line crossing several repetitions of the nested pattern, in the order a scanline of pixels
+// would sample them
+static std::vector<gfx::Vector4> createTextureSamplePoints()
+{
+    std::vector<gfx::Vector4> sample_points{ };
+    for (int i = 0; i < 1024; ++i)
+        sample_points.push_back(gfx::createPoint(i * 0.01 - 5, 0.5, i * 0.003 - 1.5));
+
+    return sample_points;
+}
+
+// Benchmarks sampling a nested pattern through the virtual methods of each texture in the tree
+static void BM_SampleTextureVirtual(benchmark::State& state)
+{
+    const gfx::CheckeredPattern3D texture{ createNestedPattern() };
+    const std::vector<gfx::Vector4> sample_points{ createTextureSamplePoints() };
+    for (auto _ : state) {
+        for (const gfx::Vector4& sample_point : sample_points)
+            benchmark::DoNotOptimize(texture.getTextureColorAt(sample_point, gfx::ProjectionMap));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sample_points.size()));
+}
+BENCHMARK(BM_SampleTextureVirtual);
+
+// Benchmarks sampling the same nested pattern after compiling it into a list of nodes
+static void BM_SampleTextureCompiled(benchmark::State& state)
+{
+    const gfx::CompiledTexture texture{ createNestedPattern() };
+    const std::vector<gfx::Vector4> sample_points{ createTextureSamplePoints() };
+    for (auto _ : state) {
+        for (const gfx::Vector4& sample_point : sample_points)
+            benchmark::DoNotOptimize(texture.getColorAt(sample_point, gfx::ProjectionMap));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sample_points.size()));
+}
+BENCHMARK(BM_SampleTextureCompiled);
+
+// Returns points scattered over the unit sphere, as sampled by the texture mapping benchmarks
+static std::vector<gfx::Vector4> createMappingSamplePoints()
+{
+    std::vector<gfx::Vector4> sample_points{ };
+    for (int i = 0; i < 1024; ++i) {
+        const double azimuth{ i * 0.7 };
+        const double height{ (i % 64) / 32.0 - 1 + 1.0 / 64 };
+        const double radius{ std::sqrt(1 - height * height) };
+        sample_points.push_back(gfx::createPoint(radius * std::cos(azimuth), height, radius * std::sin(azimuth)));
+    }
+
+    return sample_points;
+}
+
+// Returns the mapping selected by a benchmark argument
+static gfx::TextureMap getBenchmarkMapping(const int64_t mapping_type)
+{
+    return gfx::TextureMap{ static_cast<gfx::TextureMapType>(mapping_type) };
+}
+
+// Benchmarks mapping points to texture space through a type-erased function object, as each surface stored its
+// mapping before mappings were reduced to their type
+static void BM_MapTextureCoordinatesTypeErased(benchmark::State& state)
+{
+    const std::function<gfx::Vector3(const gfx::Vector4&)> mapping{ getBenchmarkMapping(state.range(0)) };
+    const std::vector<gfx::Vector4> sample_points{ createMappingSamplePoints() };
+    for (auto _ : state) {
+        for (const gfx::Vector4& sample_point : sample_points)
+            benchmark::DoNotOptimize(mapping(sample_point));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sample_points.size()));
+}
+BENCHMARK(BM_MapTextureCoordinatesTypeErased)->DenseRange(0, 4)->ArgName("mapping");
+
+// Benchmarks mapping points to texture space one at a time
+static void BM_MapTextureCoordinates(benchmark::State& state)
+{
+    const gfx::TextureMap mapping{ getBenchmarkMapping(state.range(0)) };
+    const std::vector<gfx::Vector4> sample_points{ createMappingSamplePoints() };
+    for (auto _ : state) {
+        for (const gfx::Vector4& sample_point : sample_points)
+            benchmark::DoNotOptimize(mapping(sample_point));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sample_points.size()));
+}
+BENCHMARK(BM_MapTextureCoordinates)->DenseRange(0, 4)->ArgName("mapping");
+
+// Benchmarks mapping a list of points to texture space at once
+static void BM_MapTextureCoordinatesBatch(benchmark::State& state)
+{
+    const gfx::TextureMap mapping{ getBenchmarkMapping(state.range(0)) };
+    const std::vector<gfx::Vector4> sample_points{ createMappingSamplePoints() };
+    std::vector<gfx::Vector3> texture_coordinates(sample_points.size());
+    for (auto _ : state) {
+        mapping.mapPoints(sample_points, texture_coordinates);
+        benchmark::DoNotOptimize(texture_coordinates.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sample_points.size()));
+}
+BENCHMARK(BM_MapTextureCoordinatesBatch)->DenseRange(0, 4)->ArgName("mapping");
@@ -1,8 +1,8 @@
 #include "shading_functions.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <list>
-#include <unordered_map>
+#include <vector>
 
 #include "util_functions.hpp"
 
@@ -13,16 +13,38 @@ namespace gfx {
                                 const Vector4& surface_normal,
                                 const Vector4& view_vector,
                                 const bool is_shadowed)
+    {
+        return calculateSurfaceColor(object, object.getMaterial(), light, point_position, surface_normal, view_vector,
+                                     is_shadowed);
+    }
+
+    Color calculateSurfaceColor(const Surface& object,
+                                const Material& material,
+                                const PointLight& light,
+                                const Vector4& point_position,
+                                const Vector4& surface_normal,
+                                const Vector4& view_vector,
+                                const bool is_shadowed)
     {
         // The base surface color from direct light
-        const Color object_color{ object.getObjectColorAt(point_position) };
+        return calculateSurfaceColor(object.getObjectColorAt(point_position, material), material.getProperties(),
+                                     light, point_position, surface_normal, view_vector, is_shadowed);
+    }
+
+    Color calculateSurfaceColor(const Color& object_color,
+                                const MaterialProperties& material_properties,
+                                const PointLight& light,
+                                const Vector4& point_position,
+                                const Vector4& surface_normal,
+                                const Vector4& view_vector,
+                                const bool is_shadowed)
+    {
         const Color effective_color{ object_color * light.intensity };
 
         // The direction vector to the light source
         const Vector4 light_vector{ normalize(light.position - point_position) };
 
         // Simulate the ambient color as a percentage of the base surface color
-        const MaterialProperties& material_properties{ object.getMaterial().getProperties() };
         const Color ambient{ effective_color * material_properties.ambient };
 
         // Check if the light is on the same side of the surface as the viewpoint
@@ -51,10 +73,11 @@ namespace gfx {
     std::pair<double, double> getRefractiveIndices(const Intersection& hit,
                                                    const std::vector<Intersection>& possible_overlaps)
     {
-        // The order in which objects are added must be maintained, but we use a map to facilitate quick removal
-        // of objects from the list at arbitrary positions without having to repeatedly search the list
-        std::list<const Surface*> containing_objects_list{ };
-        std::unordered_map<const Surface*, std::list<const Surface*>::iterator> object_list_iterator_map{ };
+        // The order in which objects are added must be maintained. Rays are rarely inside more than a few objects
+        // at once, so a short list which is searched linearly is cheaper than a map, and reusing the list's storage
+        // on each thread avoids allocating for every refracted ray.
+        thread_local std::vector<const Surface*> containing_objects_list{ };
+        containing_objects_list.clear();
 
         // Assume the exited medium is air
         double n1 = 1.0;
@@ -67,15 +90,13 @@ namespace gfx {
             }
 
             const Surface* object_ptr{ &intersection.getObject() };
-            if (object_list_iterator_map.contains(object_ptr)) {
+            const auto list_iter{ std::find(containing_objects_list.begin(), containing_objects_list.end(), object_ptr) };
+            if (list_iter != containing_objects_list.end()) {
                 // The ray has exited this object, remove it from the list
-                auto list_iter{ object_list_iterator_map[object_ptr] };
                 containing_objects_list.erase(list_iter);
-                object_list_iterator_map.erase(object_ptr);
             } else {
                 // The ray is entering this object, append it to the end of the list
                 containing_objects_list.push_back(object_ptr);
-                object_list_iterator_map[object_ptr] = std::prev(containing_objects_list.end());
             }
 
             if (intersection == hit && !containing_objects_list.empty()) {
@@ -115,4 +136,28 @@ namespace gfx {
         const double r_0{ std::pow((n1 - n2) / (n1 + n2), 2) };
         return r_0 + (1 - r_0) * std::pow(1 - cos_schlick, 5);
     }
-}
\ No newline at end of file
+
+    std::optional<Ray> calculateRefractionRay(const DetailedIntersection& intersection, double n1, double n2)
+    {
+        // Calculate the trig values for the angles of refraction using Snell's Law: θᵢ/θᵣ = n2/n1
+        // Assume θᵢ is the angle of incidence and θᵣ is the angle of refraction
+        const Vector4 view_vector{ intersection.getViewVector() };
+        const Vector4 normal_vector{ intersection.getSurfaceNormal() };
+
+        // θᵢ is formed by the view vector and the normal, so the cos(θᵢ) is their dot product
+        const double cos_i{ dotProduct(view_vector, normal_vector) };
+
+        // Using the identity sin²θ + cos²θ = 1 gives us sin²(θᵣ) = (n1 / n2)² * (1 - cos²(θᵢ))
+        const double n_ratio{ n1 / n2 };
+        const double sin2_r{ std::pow(n_ratio, 2) * (1 - std::pow(cos_i, 2)) };
+
+        // Total internal reflection occurs when no real solution exists for θᵣ, i.e. when sin²(θᵣ) exceeds 1
+        if (utils::isGreater(sin2_r, 1.0)) {
+            return std::nullopt;
+        }
+
+        // Use the refraction formula to calculate the refraction direction and create the refraction ray
+        const double cos_r{ std::sqrt(1 - sin2_r) };
+        return Ray{ intersection.getUnderPoint(), normal_vector * (n_ratio * cos_i - cos_r) - view_vector * n_ratio };
+    }
+}
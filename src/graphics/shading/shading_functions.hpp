@@ -1,9 +1,12 @@
 #pragma once
 
+#include <optional>
+
 #include "color.hpp"
 #include "surface.hpp"
 #include "light.hpp"
 #include "vector4.hpp"
+#include "ray.hpp"
 #include "intersection.hpp"
 
 namespace gfx {
@@ -15,6 +18,26 @@ namespace gfx {
                                               const Vector4& view_vector,
                                               bool is_shadowed = false);
 
+    // Returns the surface color of an object drawn with the passed-in material, rather than the material it would
+    // look up through its parents
+    [[nodiscard]] Color calculateSurfaceColor(const Surface& object,
+                                              const Material& material,
+                                              const PointLight& light,
+                                              const Vector4& point_position,
+                                              const Vector4& surface_normal,
+                                              const Vector4& view_vector,
+                                              bool is_shadowed = false);
+
+    // Returns the surface color at a surface point from an object color which has already been sampled from its
+    // texture, so that callers can sample the texture however they store it
+    [[nodiscard]] Color calculateSurfaceColor(const Color& object_color,
+                                              const MaterialProperties& material_properties,
+                                              const PointLight& light,
+                                              const Vector4& point_position,
+                                              const Vector4& surface_normal,
+                                              const Vector4& view_vector,
+                                              bool is_shadowed = false);
+
 
     // Returns a pair containing the refractive indices for a ray-object intersection within
     // a group of intersections of potentially overlapping objects
@@ -25,4 +48,9 @@ namespace gfx {
     [[nodiscard]] double calculateReflectance(const Vector4& view_vector,
                                               const Vector4& normal_vector,
                                               double n1, double n2);
+
+    // Returns the ray transmitted through the surface at a ray-object intersection between media with the passed-in
+    // refractive indices, or nullopt if the ray undergoes total internal reflection
+    [[nodiscard]] std::optional<Ray> calculateRefractionRay(const DetailedIntersection& intersection,
+                                                            double n1, double n2);
 }
\ No newline at end of file
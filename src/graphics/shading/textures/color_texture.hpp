@@ -29,6 +29,9 @@ namespace gfx {
 
         /* Accessors */
 
+        [[nodiscard]] const Color& getColor() const
+        { return m_color; }
+
         [[nodiscard]] Color getTextureColorAt(const Vector4& object_point,
                                               const TextureMap& mapping) const override
         { return m_color; }
@@ -0,0 +1,68 @@
+#include "compiled_texture.hpp"
+
+#include <typeinfo>
+
+#include "color_texture.hpp"
+
+namespace gfx {
+    CompiledTexture::CompiledTexture(const Texture& texture)
+    {
+        this->addTexture(texture);
+    }
+
+    uint32_t CompiledTexture::addTexture(const Texture& texture)
+    {
+        // Reserve the node before adding any children, since adding them may reallocate the list
+        const auto node_index{ static_cast<uint32_t>(m_nodes.size()) };
+        m_nodes.emplace_back();
+
+        // Only textures of exactly the supported types are compiled, since a derived type may override how they are
+        // sampled
+        Node node{ };
+        const std::type_info& texture_type{ typeid(texture) };
+        if (texture_type == typeid(ColorTexture))
+        {
+            node.type = NodeType::Color;
+            node.color_a = static_cast<const ColorTexture&>(texture).getColor();
+        }
+        else if (texture_type == typeid(GradientTexture3D))
+        {
+            const auto& gradient{ static_cast<const GradientTexture3D&>(texture) };
+            node.type = NodeType::Gradient;
+            node.color_a = gradient.getColorA();
+            node.color_b = gradient.getColorB();
+        }
+        else if (texture_type == typeid(StripePattern3D) ||
+                 texture_type == typeid(RingPattern3D) ||
+                 texture_type == typeid(CheckeredPattern3D))
+        {
+            if (texture_type == typeid(StripePattern3D))
+                node.type = NodeType::Stripe;
+            else if (texture_type == typeid(RingPattern3D))
+                node.type = NodeType::Ring;
+            else
+                node.type = NodeType::Checkered;
+
+            const auto& pattern{ static_cast<const PatternTexture3D&>(texture) };
+            node.child_indices[0] = this->addTexture(pattern.getTextureA());
+            node.child_indices[1] = this->addTexture(pattern.getTextureB());
+        }
+        else
+        {
+            // The fallback texture applies its own transform, so the point is passed to it unchanged
+            node.type = NodeType::Fallback;
+            node.fallback_index = static_cast<uint32_t>(m_fallback_textures.size());
+            m_fallback_textures.push_back(texture.clone());
+        }
+
+        if (node.type != NodeType::Color && node.type != NodeType::Fallback)
+        {
+            const Matrix4& inverse_transform{ static_cast<const Texture3D&>(texture).getInverseTransform() };
+            node.is_transformed = !inverse_transform.isIdentityMatrix();
+            node.inverse_transform = inverse_transform;
+        }
+
+        m_nodes[node_index] = node;
+        return node_index;
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "color.hpp"
+#include "matrix4.hpp"
+#include "vector4.hpp"
+#include "texture.hpp"
+#include "texture_map.hpp"
+#include "gradient_texture_3d.hpp"
+#include "stripe_pattern_3d.hpp"
+#include "ring_pattern_3d.hpp"
+#include "checkered_pattern_3d.hpp"
+
+namespace gfx {
+    // A texture tree flattened into a list of nodes, which is sampled by walking from the root node to a leaf in a
+    // single loop rather than through a virtual call at each level of the tree. Colors, gradients, and the stripe,
+    // ring, and checkered patterns are compiled into nodes, and any other texture is kept as a copy which is sampled
+    // through its virtual methods. Only these fallback textures use the texture mapping.
+    class CompiledTexture
+    {
+    public:
+        /* Helper Types */
+
+        // Categories of texture stored in the nodes of a compiled texture
+        enum class NodeType : uint8_t {
+            Color,
+            Gradient,
+            Stripe,
+            Ring,
+            Checkered,
+            Fallback    // Any other texture, which is sampled through its virtual methods
+        };
+
+        // A single texture in the tree. Children are always stored after their parent, with the root at index zero.
+        struct Node {
+            NodeType type{ NodeType::Color };
+            bool is_transformed{ false };       // False if the texture transform is the identity and can be skipped
+            std::array<uint32_t, 2> child_indices{ };   // Children of pattern nodes, texture A followed by B
+            uint32_t fallback_index{ 0 };       // Index of the texture sampled by a fallback node
+            Color color_a{ };                   // Color of a color node, or the first color of a gradient
+            Color color_b{ };                   // Second color of a gradient
+            Matrix4 inverse_transform{ };
+        };
+
+        /* Constructors */
+
+        // Default Constructor
+        CompiledTexture() = delete;
+
+        // Standard Constructor, compiling a texture and all of its children
+        explicit CompiledTexture(const Texture& texture);
+
+        // Copy Constructor
+        CompiledTexture(const CompiledTexture&) = default;
+
+        // Move Constructor
+        CompiledTexture(CompiledTexture&&) noexcept = default;
+
+        /* Destructor */
+
+        ~CompiledTexture() = default;
+
+        /* Assignment Operators */
+
+        CompiledTexture& operator=(const CompiledTexture&) = default;
+        CompiledTexture& operator=(CompiledTexture&&) noexcept = default;
+
+        /* Accessors */
+
+        [[nodiscard]] const std::vector<Node>& getNodes() const
+        { return m_nodes; }
+
+        [[nodiscard]] size_t getFallbackTextureCount() const
+        { return m_fallback_textures.size(); }
+
+        // Samples the texture at a point in object space, matching the color returned by the original texture
+        [[nodiscard]] Color getColorAt(const Vector4& object_point, const TextureMap& mapping) const;
+
+    private:
+        /* Data Members */
+
+        std::vector<Node> m_nodes{ };
+        std::vector<std::shared_ptr<const Texture>> m_fallback_textures{ };
+
+        /* Compilation Helper Methods */
+
+        // Appends the node for a texture followed by the nodes of its children, returning the index of the node
+        uint32_t addTexture(const Texture& texture);
+    };
+
+    // Defined in the header so that the loop is inlined into the shading code which samples the texture
+    inline Color CompiledTexture::getColorAt(const Vector4& object_point, const TextureMap& mapping) const
+    {
+        Vector4 point{ object_point };
+        const Node* node{ &m_nodes.front() };
+        while (true)
+        {
+            if (node->is_transformed)
+                point = node->inverse_transform * point;
+
+            bool is_texture_a{ true };
+            switch (node->type)
+            {
+                case NodeType::Color:
+                    return node->color_a;
+                case NodeType::Gradient:
+                    return GradientTexture3D::blendColorsAt(point, node->color_a, node->color_b);
+                case NodeType::Stripe:
+                    is_texture_a = StripePattern3D::isTextureAAt(point);
+                    break;
+                case NodeType::Ring:
+                    is_texture_a = RingPattern3D::isTextureAAt(point);
+                    break;
+                case NodeType::Checkered:
+                    is_texture_a = CheckeredPattern3D::isTextureAAt(point);
+                    break;
+                case NodeType::Fallback:
+                    return m_fallback_textures[node->fallback_index]->getTextureColorAt(point, mapping);
+            }
+
+            node = &m_nodes[is_texture_a ? node->child_indices[0] : node->child_indices[1]];
+        }
+    }
+}
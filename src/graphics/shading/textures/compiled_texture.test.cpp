@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+#include "compiled_texture.hpp"
+
+#include <vector>
+
+#include "transform.hpp"
+#include "color.hpp"
+
+#include "color_texture.hpp"
+#include "gradient_texture_3d.hpp"
+#include "stripe_pattern_3d.hpp"
+#include "ring_pattern_3d.hpp"
+#include "checkered_pattern_3d.hpp"
+
+// Returns a grid of points spanning several repetitions of each pattern, including negative coordinates
+static std::vector<gfx::Vector4> createSamplePoints()
+{
+    std::vector<gfx::Vector4> sample_points{ };
+    for (int i = -8; i <= 8; ++i)
+        for (int j = -8; j <= 8; ++j)
+            for (int k = -8; k <= 8; ++k)
+                sample_points.push_back(gfx::createPoint(i * 0.37, j * 0.41, k * 0.29));
+
+    return sample_points;
+}
+
+// Expects a compiled texture to return the same color as the texture it was compiled from at every sample point
+static void expectMatchingColors(const gfx::Texture& texture)
+{
+    const gfx::CompiledTexture compiled_texture{ texture };
+    for (const gfx::Vector4& sample_point : createSamplePoints())
+        ASSERT_EQ(compiled_texture.getColorAt(sample_point, gfx::ProjectionMap),
+                  texture.getTextureColorAt(sample_point, gfx::ProjectionMap));
+}
+
+// Tests compiling a solid color texture
+TEST(GraphicsCompiledTexture, ColorTexture)
+{
+    const gfx::ColorTexture texture{ gfx::cyan() };
+    const gfx::CompiledTexture compiled_texture{ texture };
+
+    ASSERT_EQ(compiled_texture.getNodes().size(), 1);
+    EXPECT_EQ(compiled_texture.getNodes()[0].type, gfx::CompiledTexture::NodeType::Color);
+    EXPECT_EQ(compiled_texture.getFallbackTextureCount(), 0);
+    EXPECT_EQ(compiled_texture.getColorAt(gfx::createPoint(1, 2, 3), gfx::ProjectionMap), gfx::cyan());
+}
+
+// Tests compiling gradient textures with and without a transform
+TEST(GraphicsCompiledTexture, GradientTexture)
+{
+    const gfx::GradientTexture3D gradient{ gfx::white(), gfx::black() };
+    const gfx::CompiledTexture compiled_gradient{ gradient };
+    ASSERT_EQ(compiled_gradient.getNodes().size(), 1);
+    EXPECT_EQ(compiled_gradient.getNodes()[0].type, gfx::CompiledTexture::NodeType::Gradient);
+    EXPECT_FALSE(compiled_gradient.getNodes()[0].is_transformed);
+    expectMatchingColors(gradient);
+
+    const gfx::GradientTexture3D transformed_gradient{ gfx::createScalingMatrix(2, 1, 1) *
+                                                       gfx::createZRotationMatrix(M_PI_4),
+                                                       gfx::red(), gfx::blue() };
+    EXPECT_TRUE(gfx::CompiledTexture{ transformed_gradient }.getNodes()[0].is_transformed);
+    expectMatchingColors(transformed_gradient);
+}
+
+// Tests compiling each of the two-tone patterns
+TEST(GraphicsCompiledTexture, PatternTextures)
+{
+    const gfx::Matrix4 transform{ gfx::createTranslationMatrix(0.5, 0, 0) * gfx::createYRotationMatrix(M_PI_4 / 2) };
+
+    const gfx::StripePattern3D stripe_pattern{ transform, gfx::white(), gfx::black() };
+    const gfx::CompiledTexture compiled_stripe_pattern{ stripe_pattern };
+    ASSERT_EQ(compiled_stripe_pattern.getNodes().size(), 3);
+    EXPECT_EQ(compiled_stripe_pattern.getNodes()[0].type, gfx::CompiledTexture::NodeType::Stripe);
+    EXPECT_EQ(compiled_stripe_pattern.getNodes()[0].child_indices[0], 1);
+    EXPECT_EQ(compiled_stripe_pattern.getNodes()[0].child_indices[1], 2);
+    expectMatchingColors(stripe_pattern);
+
+    const gfx::RingPattern3D ring_pattern{ transform, gfx::white(), gfx::black() };
+    EXPECT_EQ(gfx::CompiledTexture{ ring_pattern }.getNodes()[0].type, gfx::CompiledTexture::NodeType::Ring);
+    expectMatchingColors(ring_pattern);
+
+    const gfx::CheckeredPattern3D checkered_pattern{ transform, gfx::white(), gfx::black() };
+    EXPECT_EQ(gfx::CompiledTexture{ checkered_pattern }.getNodes()[0].type,
+              gfx::CompiledTexture::NodeType::Checkered);
+    expectMatchingColors(checkered_pattern);
+}
+
+// Tests compiling patterns nested several levels deep, each with its own transform
+TEST(GraphicsCompiledTexture, NestedPatterns)
+{
+    const gfx::StripePattern3D stripe_pattern{ gfx::createScalingMatrix(0.25, 0.25, 0.25),
+                                               gfx::red(), gfx::green() };
+    const gfx::GradientTexture3D gradient{ gfx::createXRotationMatrix(M_PI_2), gfx::blue(), gfx::yellow() };
+    const gfx::RingPattern3D ring_pattern{ gfx::createTranslationMatrix(1, 0, 1), stripe_pattern, gradient };
+    const gfx::CheckeredPattern3D checkered_pattern{ gfx::createYRotationMatrix(M_PI_4),
+                                                     ring_pattern,
+                                                     gfx::ColorTexture{ gfx::magenta() } };
+    const gfx::CompiledTexture compiled_texture{ checkered_pattern };
+
+    // Checkered, ring, stripe, two colors, gradient, and the final color
+    ASSERT_EQ(compiled_texture.getNodes().size(), 7);
+    EXPECT_EQ(compiled_texture.getFallbackTextureCount(), 0);
+    for (size_t node_index = 0; node_index < compiled_texture.getNodes().size(); ++node_index)
+    {
+        const gfx::CompiledTexture::Node& node{ compiled_texture.getNodes()[node_index] };
+        if (node.type == gfx::CompiledTexture::NodeType::Stripe ||
+            node.type == gfx::CompiledTexture::NodeType::Ring ||
+            node.type == gfx::CompiledTexture::NodeType::Checkered)
+        {
+            EXPECT_GT(node.child_indices[0], node_index);
+            EXPECT_GT(node.child_indices[1], node_index);
+        }
+    }
+
+    expectMatchingColors(checkered_pattern);
+}
+
+// Tests that unsupported textures are sampled through their own methods, including as children of patterns
+TEST(GraphicsCompiledTexture, FallbackTextures)
+{
+    const TestPattern3D test_pattern{ gfx::createScalingMatrix(2, 2, 2), gfx::white(), gfx::black() };
+    const gfx::CompiledTexture compiled_test_pattern{ test_pattern };
+    ASSERT_EQ(compiled_test_pattern.getNodes().size(), 1);
+    EXPECT_EQ(compiled_test_pattern.getNodes()[0].type, gfx::CompiledTexture::NodeType::Fallback);
+    EXPECT_EQ(compiled_test_pattern.getFallbackTextureCount(), 1);
+    expectMatchingColors(test_pattern);
+
+    const gfx::StripePattern3D stripe_pattern{ gfx::createTranslationMatrix(0.5, 0, 0),
+                                               test_pattern,
+                                               gfx::ColorTexture{ gfx::black() } };
+    EXPECT_EQ(gfx::CompiledTexture{ stripe_pattern }.getFallbackTextureCount(), 1);
+    expectMatchingColors(stripe_pattern);
+}
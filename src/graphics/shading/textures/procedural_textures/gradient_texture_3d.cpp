@@ -1,11 +1,9 @@
 #include "gradient_texture_3d.hpp"
 
-#include <cmath>
-
 namespace gfx {
     Color GradientTexture3D::sample3DTextureAt(const Vector4& transformed_point, const TextureMap& mapping) const
     {
-        return m_color_a + (m_color_b - m_color_a) * (transformed_point.x() - std::floor(transformed_point.x()));
+        return blendColorsAt(transformed_point, m_color_a, m_color_b);
     }
 
     bool GradientTexture3D::areEquivalent(const Texture& other_texture) const
@@ -2,6 +2,8 @@
 
 #include "texture_3d.hpp"
 
+#include <cmath>
+
 namespace gfx {
     class GradientTexture3D : public Texture3D
     {
@@ -38,6 +40,14 @@ namespace gfx {
         [[nodiscard]] std::shared_ptr<Texture> clone() const override
         { return std::make_shared<GradientTexture3D>(*this); }
 
+        /* Gradient Operations */
+
+        // Returns the blend of two colors at a point in gradient space, repeating every unit along the x-axis
+        [[nodiscard]] static Color blendColorsAt(const Vector4& transformed_point,
+                                                 const Color& color_a,
+                                                 const Color& color_b)
+        { return color_a + (color_b - color_a) * (transformed_point.x() - std::floor(transformed_point.x())); }
+
     private:
         /* Data Members */
 
@@ -2,6 +2,8 @@
 
 #include "pattern_texture_3d.hpp"
 
+#include <cmath>
+
 namespace gfx {
     class CheckeredPattern3D : public PatternTexture3D
     {
@@ -40,6 +42,18 @@ namespace gfx {
         [[nodiscard]] std::shared_ptr<Texture> clone() const override
         { return std::make_shared<CheckeredPattern3D>(*this); }
 
+        /* Pattern Operations */
+
+        // Returns true if the first texture of the checkered pattern is sampled at a point in pattern space
+        [[nodiscard]] static bool isTextureAAt(const Vector4& transformed_point)
+        {
+            return static_cast<int>(
+                    std::floor(transformed_point.x()) +
+                    std::floor(transformed_point.y()) +
+                    std::floor(transformed_point.z())
+                    ) % 2 == 0;
+        }
+
     private:
         /* Texture Helper Method Overrides */
 
@@ -1,12 +1,9 @@
 #include "ring_pattern_3d.hpp"
 
-#include <cmath>
-
 namespace gfx {
     Color RingPattern3D::sample3DTextureAt(const Vector4& transformed_point, const TextureMap& mapping) const
     {
-        const double radius{ std::sqrt(std::pow(transformed_point.x(), 2) + std::pow(transformed_point.z(), 2)) };
-        if (static_cast<int>(std::floor(radius)) % 2 == 0)
+        if (isTextureAAt(transformed_point))
             return this->getTextureA().getTextureColorAt(transformed_point, mapping);
 
         return this->getTextureB().getTextureColorAt(transformed_point, mapping);
@@ -2,6 +2,8 @@
 
 #include "pattern_texture_3d.hpp"
 
+#include <cmath>
+
 namespace gfx {
     class RingPattern3D : public PatternTexture3D
     {
@@ -40,6 +42,15 @@ namespace gfx {
         [[nodiscard]] std::shared_ptr<Texture> clone() const override
         { return std::make_shared<RingPattern3D>(*this); }
 
+        /* Pattern Operations */
+
+        // Returns true if the first texture of the ring pattern is sampled at a point in pattern space
+        [[nodiscard]] static bool isTextureAAt(const Vector4& transformed_point)
+        {
+            const double radius{ std::sqrt(std::pow(transformed_point.x(), 2) + std::pow(transformed_point.z(), 2)) };
+            return static_cast<int>(std::floor(radius)) % 2 == 0;
+        }
+
     private:
         /* Texture Helper Method Overrides */
 
@@ -1,11 +1,9 @@
 #include "stripe_pattern_3d.hpp"
 
-#include <cmath>
-
 namespace gfx {
     Color StripePattern3D::sample3DTextureAt(const Vector4& transformed_point, const TextureMap& mapping) const
     {
-        if (static_cast<int>(std::floor(transformed_point.x())) % 2 == 0)
+        if (isTextureAAt(transformed_point))
             return this->getTextureA().getTextureColorAt(transformed_point, mapping);
 
         return this->getTextureB().getTextureColorAt(transformed_point, mapping);
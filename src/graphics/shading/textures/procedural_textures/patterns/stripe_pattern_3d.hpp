@@ -2,6 +2,8 @@
 
 #include "pattern_texture_3d.hpp"
 
+#include <cmath>
+
 namespace gfx {
     class StripePattern3D : public PatternTexture3D
     {
@@ -40,6 +42,12 @@ namespace gfx {
         [[nodiscard]] std::shared_ptr<Texture> clone() const override
         { return std::make_shared<StripePattern3D>(*this); }
 
+        /* Pattern Operations */
+
+        // Returns true if the first texture of the stripe pattern is sampled at a point in pattern space
+        [[nodiscard]] static bool isTextureAAt(const Vector4& transformed_point)
+        { return static_cast<int>(std::floor(transformed_point.x())) % 2 == 0; }
+
     private:
         /* Texture Helper Method Overrides */
 
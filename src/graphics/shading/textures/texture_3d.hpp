@@ -27,6 +27,9 @@ namespace gfx {
         [[nodiscard]] const Matrix4& getTransform() const
         { return m_transform; }
 
+        [[nodiscard]] const Matrix4& getInverseTransform() const
+        { return m_transform_inverse; }
+
         [[nodiscard]] Color getTextureColorAt(const Vector4& object_point,
                                               const TextureMap& mapping) const override;
 
@@ -1,15 +1,42 @@
 #include "texture_map.hpp"
 
-#include <cmath>
+#include <algorithm>
+#include <stdexcept>
 
 namespace gfx {
-    Vector3 ProjectionMap(const Vector4& object_point)
-    {
-        return create2DPoint(object_point.x(), object_point.y());
+    namespace {
+        // Applies a mapping function to each point in a list. The function is a template argument rather than a
+        // function argument so that it is inlined into the loop.
+        template<Vector3 (*map_point)(const Vector4&)>
+        void mapEachPoint(const std::span<const Vector4> object_points, const std::span<Vector3> texture_coordinates)
+        {
+            std::transform(object_points.begin(), object_points.end(), texture_coordinates.begin(), map_point);
+        }
     }
 
-    Vector3 PlanarMap(const Vector4& object_point)
+    void TextureMap::mapPoints(const std::span<const Vector4> object_points,
+                               const std::span<Vector3> texture_coordinates) const
     {
-        return create2DPoint(std::fmod(object_point.x(), 1), std::fmod(object_point.z(), 1));
+        if (texture_coordinates.size() < object_points.size())
+            throw std::invalid_argument{ "Texture coordinate list must have an element for every object point." };
+
+        switch (m_type)
+        {
+            case TextureMapType::Projection:
+                mapEachPoint<calculateProjectionMapCoordinate>(object_points, texture_coordinates);
+                break;
+            case TextureMapType::Planar:
+                mapEachPoint<calculatePlanarMapCoordinate>(object_points, texture_coordinates);
+                break;
+            case TextureMapType::Spherical:
+                mapEachPoint<calculateSphericalMapCoordinate>(object_points, texture_coordinates);
+                break;
+            case TextureMapType::Cylindrical:
+                mapEachPoint<calculateCylindricalMapCoordinate>(object_points, texture_coordinates);
+                break;
+            case TextureMapType::Cubic:
+                mapEachPoint<calculateCubicMapCoordinate>(object_points, texture_coordinates);
+                break;
+        }
     }
-}
\ No newline at end of file
+}
@@ -1,16 +1,192 @@
 #pragma once
 
-#include <functional>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
 
 #include "vector3.hpp"
 #include "vector4.hpp"
 
 namespace gfx {
-    using TextureMap = std::function<Vector3(const Vector4&)>;
+    // Methods of mapping a point in object space to a coordinate in texture space
+    enum class TextureMapType : uint8_t {
+        Projection,     // Uses the object x- and y-coordinates directly
+        Planar,         // Repeats the object x- and z-coordinates every unit
+        Spherical,      // Wraps the texture around a sphere centered on the origin
+        Cylindrical,    // Wraps the texture around a cylinder along the y-axis, repeating every unit of height
+        Cubic           // Projects the texture onto each face of a cube centered on the origin
+    };
+
+    // Faces of the cube used by the cubic mapping, in the order they are laid out along the u-axis of the texture
+    enum class CubeFace : uint8_t {
+        Left,
+        Front,
+        Right,
+        Back,
+        Up,
+        Down
+    };
+    constexpr size_t CUBE_FACE_COUNT{ 6 };
+
+    /* Texture Mapping Functions */
+
+    // Returns the remainder of dividing a coordinate by a power of two, with the sign of the coordinate. Since the
+    // division is exact, this matches std::fmod up to the sign of a zero result, without the call into the library.
+    [[nodiscard]] inline double calculateRemainder(const double coordinate, const double period)
+    { return coordinate - period * std::trunc(coordinate / period); }
+
+    // Returns the object x- and y-coordinates as a texture coordinate
+    [[nodiscard]] inline Vector3 calculateProjectionMapCoordinate(const Vector4& object_point)
+    { return Vector3{ object_point.x(), object_point.y(), 1 }; }
+
+    // Returns the object x- and z-coordinates as a texture coordinate, repeating every unit
+    [[nodiscard]] inline Vector3 calculatePlanarMapCoordinate(const Vector4& object_point)
+    { return Vector3{ calculateRemainder(object_point.x(), 1), calculateRemainder(object_point.z(), 1), 1 }; }
+
+    // Returns the texture coordinate of a point on a sphere centered on the origin, with u measured around the
+    // y-axis from the negative z-axis and v running from the bottom of the sphere to the top
+    [[nodiscard]] inline Vector3 calculateSphericalMapCoordinate(const Vector4& object_point)
+    {
+        const double azimuth{ std::atan2(object_point.x(), object_point.z()) };
+        const double radius{ std::sqrt(object_point.x() * object_point.x() +
+                                       object_point.y() * object_point.y() +
+                                       object_point.z() * object_point.z()) };
+        const double polar_angle{ std::acos(object_point.y() / radius) };
+        return Vector3{ 0.5 - azimuth / (2 * std::numbers::pi), 1 - polar_angle / std::numbers::pi, 1 };
+    }
+
+    // Returns the texture coordinate of a point on a cylinder along the y-axis, with u measured around the y-axis
+    // as for the spherical mapping and v repeating every unit of height
+    [[nodiscard]] inline Vector3 calculateCylindricalMapCoordinate(const Vector4& object_point)
+    {
+        const double azimuth{ std::atan2(object_point.x(), object_point.z()) };
+        return Vector3{ 0.5 - azimuth / (2 * std::numbers::pi), object_point.y() - std::floor(object_point.y()), 1 };
+    }
+
+    // Returns the face of a cube centered on the origin which the direction from the origin to a point passes through
+    [[nodiscard]] inline CubeFace getCubeFace(const Vector4& object_point)
+    {
+        const double abs_x{ std::abs(object_point.x()) };
+        const double abs_y{ std::abs(object_point.y()) };
+        const double abs_z{ std::abs(object_point.z()) };
+        if (abs_x >= abs_y && abs_x >= abs_z)
+            return object_point.x() > 0 ? CubeFace::Right : CubeFace::Left;
+        if (abs_y >= abs_z)
+            return object_point.y() > 0 ? CubeFace::Up : CubeFace::Down;
+
+        return object_point.z() > 0 ? CubeFace::Front : CubeFace::Back;
+    }
+
+    // Returns the texture coordinate of a point on the cube spanning [-1, 1] on each axis. The faces are laid out
+    // side by side along the u-axis in the order of the CubeFace enumeration, each occupying a square of width 1/6.
+    [[nodiscard]] inline Vector3 calculateCubicMapCoordinate(const Vector4& object_point)
+    {
+        const double x{ object_point.x() };
+        const double y{ object_point.y() };
+        const double z{ object_point.z() };
+
+        const CubeFace face{ getCubeFace(object_point) };
+        double face_u{ 0 };
+        double face_v{ calculateRemainder(y + 1, 2) / 2 };
+        switch (face)
+        {
+            case CubeFace::Left:
+                face_u = calculateRemainder(z + 1, 2) / 2;
+                break;
+            case CubeFace::Front:
+                face_u = calculateRemainder(x + 1, 2) / 2;
+                break;
+            case CubeFace::Right:
+                face_u = calculateRemainder(1 - z, 2) / 2;
+                break;
+            case CubeFace::Back:
+                face_u = calculateRemainder(1 - x, 2) / 2;
+                break;
+            case CubeFace::Up:
+                face_u = calculateRemainder(x + 1, 2) / 2;
+                face_v = calculateRemainder(1 - z, 2) / 2;
+                break;
+            case CubeFace::Down:
+                face_u = calculateRemainder(x + 1, 2) / 2;
+                face_v = calculateRemainder(z + 1, 2) / 2;
+                break;
+        }
+
+        return Vector3{ (static_cast<double>(face) + face_u) / CUBE_FACE_COUNT, face_v, 1 };
+    }
+
+    // A mapping from object space to texture space. Only the type of mapping is stored, in a single byte, so that
+    // each surface can hold its own mapping cheaply and sampling dispatches with a switch the compiler can inline.
+    class TextureMap
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor
+        constexpr TextureMap() = default;
+
+        // Standard Constructor
+        constexpr explicit TextureMap(const TextureMapType type)
+                : m_type{ type }
+        {}
+
+        /* Accessors */
+
+        [[nodiscard]] constexpr TextureMapType getType() const
+        { return m_type; }
+
+        /* Mapping Operations */
+
+        // Maps a point in object space to texture space
+        [[nodiscard]] Vector3 operator()(const Vector4& object_point) const
+        {
+            switch (m_type)
+            {
+                case TextureMapType::Projection:
+                    return calculateProjectionMapCoordinate(object_point);
+                case TextureMapType::Planar:
+                    return calculatePlanarMapCoordinate(object_point);
+                case TextureMapType::Spherical:
+                    return calculateSphericalMapCoordinate(object_point);
+                case TextureMapType::Cylindrical:
+                    return calculateCylindricalMapCoordinate(object_point);
+                case TextureMapType::Cubic:
+                    return calculateCubicMapCoordinate(object_point);
+            }
+
+            return calculateProjectionMapCoordinate(object_point);
+        }
+
+        // Maps each point in a list to texture space, writing the texture coordinate to the matching element of the
+        // passed-in list. The type of mapping is only checked once for the whole list. Throws if the list of texture
+        // coordinates is shorter than the list of points.
+        void mapPoints(std::span<const Vector4> object_points, std::span<Vector3> texture_coordinates) const;
+
+        /* Comparison Operator Overloads */
+
+        [[nodiscard]] constexpr bool operator==(const TextureMap& rhs) const = default;
+
+    private:
+        /* Data Members */
+
+        TextureMapType m_type{ TextureMapType::Projection };
+    };
+
+    /* Texture Maps */
 
     // A direct mapping of the object x- and y-coordinates to texture space
-    [[nodiscard]] Vector3 ProjectionMap(const Vector4& object_point);
+    inline constexpr TextureMap ProjectionMap{ TextureMapType::Projection };
+
+    // A planar projection of the object x- and z-coordinates, repeating every unit
+    inline constexpr TextureMap PlanarMap{ TextureMapType::Planar };
+
+    // A mapping of latitude and longitude around the origin to texture space
+    inline constexpr TextureMap SphericalMap{ TextureMapType::Spherical };
+
+    // A mapping of the angle around and height along the y-axis to texture space
+    inline constexpr TextureMap CylindricalMap{ TextureMapType::Cylindrical };
 
-    // A planar projection of the
-    [[nodiscard]] Vector3 PlanarMap(const Vector4& object_point);
+    // A projection onto the faces of a cube centered on the origin
+    inline constexpr TextureMap CubicMap{ TextureMapType::Cubic };
 }
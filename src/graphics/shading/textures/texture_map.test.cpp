@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 #include "texture_map.hpp"
 
+#include <stdexcept>
+#include <vector>
+
 // Test using the projection mapping to map object space coordinates to texture space
 TEST(GraphicsTextureMap, ProjectionMap)
 {
@@ -13,4 +16,98 @@ TEST(GraphicsTextureMap, ProjectionMap)
     const gfx::Vector3 texture_coordinate_b_expected{ gfx::create2DPoint(0, 0) };
     const gfx::Vector3 texture_coordinate_b_actual{ gfx::ProjectionMap(object_coordinate_b) };
     EXPECT_EQ(texture_coordinate_b_actual, texture_coordinate_b_expected);
-}
\ No newline at end of file
+}
+
+// Test using the planar mapping, which repeats the object x- and z-coordinates every unit
+TEST(GraphicsTextureMap, PlanarMap)
+{
+    EXPECT_EQ(gfx::PlanarMap(gfx::createPoint(0.25, 0, 0.5)), gfx::create2DPoint(0.25, 0.5));
+    EXPECT_EQ(gfx::PlanarMap(gfx::createPoint(1.25, 5, 4.5)), gfx::create2DPoint(0.25, 0.5));
+    EXPECT_EQ(gfx::PlanarMap(gfx::createPoint(0.25, -2, 1)), gfx::create2DPoint(0.25, 0));
+}
+
+// Test using the spherical mapping on points around the unit sphere
+TEST(GraphicsTextureMap, SphericalMap)
+{
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(0, 0, -1)), gfx::create2DPoint(0, 0.5));
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(1, 0, 0)), gfx::create2DPoint(0.25, 0.5));
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(0, 0, 1)), gfx::create2DPoint(0.5, 0.5));
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(-1, 0, 0)), gfx::create2DPoint(0.75, 0.5));
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(0, 1, 0)), gfx::create2DPoint(0.5, 1));
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(0, -1, 0)), gfx::create2DPoint(0.5, 0));
+    EXPECT_EQ(gfx::SphericalMap(gfx::createPoint(M_SQRT1_2, M_SQRT1_2, 0)), gfx::create2DPoint(0.25, 0.75));
+}
+
+// Test using the cylindrical mapping on points around a cylinder along the y-axis
+TEST(GraphicsTextureMap, CylindricalMap)
+{
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(0, 0, -1)), gfx::create2DPoint(0, 0));
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(0, 0.5, -1)), gfx::create2DPoint(0, 0.5));
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(0, 1, -1)), gfx::create2DPoint(0, 0));
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(M_SQRT1_2, 0.5, -M_SQRT1_2)), gfx::create2DPoint(0.125, 0.5));
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(1, 0.5, 0)), gfx::create2DPoint(0.25, 0.5));
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(M_SQRT1_2, 0.5, M_SQRT1_2)), gfx::create2DPoint(0.375, 0.5));
+    EXPECT_EQ(gfx::CylindricalMap(gfx::createPoint(0, -0.25, 1)), gfx::create2DPoint(0.5, 0.75));
+}
+
+// Test finding the face of the cube a point lies on
+TEST(GraphicsTextureMap, GetCubeFace)
+{
+    EXPECT_EQ(gfx::getCubeFace(gfx::createPoint(-1, 0.5, -0.25)), gfx::CubeFace::Left);
+    EXPECT_EQ(gfx::getCubeFace(gfx::createPoint(1.1, -0.75, 0.8)), gfx::CubeFace::Right);
+    EXPECT_EQ(gfx::getCubeFace(gfx::createPoint(0.1, 0.6, 0.9)), gfx::CubeFace::Front);
+    EXPECT_EQ(gfx::getCubeFace(gfx::createPoint(-0.7, 0, -2)), gfx::CubeFace::Back);
+    EXPECT_EQ(gfx::getCubeFace(gfx::createPoint(0.5, 1, 0.9)), gfx::CubeFace::Up);
+    EXPECT_EQ(gfx::getCubeFace(gfx::createPoint(-0.2, -1.3, 1.1)), gfx::CubeFace::Down);
+}
+
+// Test using the cubic mapping, with the faces laid out side by side along the u-axis
+TEST(GraphicsTextureMap, CubicMap)
+{
+    // Returns the texture coordinate of a point within a face, offset to the position of that face in the texture
+    const auto createCubeCoordinate{ [](const gfx::CubeFace face, const double u, const double v) {
+        return gfx::create2DPoint((static_cast<double>(face) + u) / gfx::CUBE_FACE_COUNT, v);
+    } };
+
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(-0.5, 0.5, 1)), createCubeCoordinate(gfx::CubeFace::Front, 0.25, 0.75));
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(0.5, -0.5, 1)), createCubeCoordinate(gfx::CubeFace::Front, 0.75, 0.25));
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(0.5, 0.5, -1)), createCubeCoordinate(gfx::CubeFace::Back, 0.25, 0.75));
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(-1, 0.5, -0.5)), createCubeCoordinate(gfx::CubeFace::Left, 0.25, 0.75));
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(1, 0.5, 0.5)), createCubeCoordinate(gfx::CubeFace::Right, 0.25, 0.75));
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(-0.5, 1, -0.5)), createCubeCoordinate(gfx::CubeFace::Up, 0.25, 0.75));
+    EXPECT_EQ(gfx::CubicMap(gfx::createPoint(-0.5, -1, 0.5)), createCubeCoordinate(gfx::CubeFace::Down, 0.25, 0.75));
+}
+
+// Test mapping a list of points at once against mapping each point individually
+TEST(GraphicsTextureMap, MapPoints)
+{
+    const std::vector<gfx::Vector4> object_points{ gfx::createPoint(0.3, -0.8, 0.5),
+                                                   gfx::createPoint(-1, 0.25, 0.75),
+                                                   gfx::createPoint(0.6, 1, -0.1),
+                                                   gfx::createPoint(-0.4, -0.2, -1) };
+    for (const gfx::TextureMap mapping : { gfx::ProjectionMap,
+                                           gfx::PlanarMap,
+                                           gfx::SphericalMap,
+                                           gfx::CylindricalMap,
+                                           gfx::CubicMap })
+    {
+        std::vector<gfx::Vector3> texture_coordinates(object_points.size());
+        mapping.mapPoints(object_points, texture_coordinates);
+        for (size_t i = 0; i < object_points.size(); ++i)
+            EXPECT_EQ(texture_coordinates[i], mapping(object_points[i]));
+    }
+
+    // Test that a list of texture coordinates too short for every point is rejected rather than written past
+    std::vector<gfx::Vector3> short_texture_coordinates(object_points.size() - 1);
+    EXPECT_THROW(gfx::CubicMap.mapPoints(object_points, short_texture_coordinates), std::invalid_argument);
+}
+
+// Test that a mapping is stored in a single byte, and compares equal only to a mapping of the same type
+TEST(GraphicsTextureMap, Representation)
+{
+    EXPECT_EQ(sizeof(gfx::TextureMap), 1);
+    EXPECT_EQ(gfx::TextureMap{ }, gfx::ProjectionMap);
+    EXPECT_EQ(gfx::TextureMap{ gfx::TextureMapType::Cubic }, gfx::CubicMap);
+    EXPECT_NE(gfx::SphericalMap, gfx::CylindricalMap);
+    EXPECT_EQ(gfx::CubicMap.getType(), gfx::TextureMapType::Cubic);
+}
@@ -0,0 +1,105 @@
+#include "render_statistics.hpp"
+
+#include <format>
+#include <numeric>
+
+namespace gfx {
+    std::mutex RenderStatisticsCollector::s_exited_threads_mutex{ };
+    RenderStatistics RenderStatisticsCollector::s_exited_threads_statistics{ };
+
+    RenderStatistics& RenderStatistics::operator+=(const RenderStatistics& rhs)
+    {
+        for (size_t i = 0; i < RAY_TYPE_COUNT; ++i) {
+            ray_counts[i] += rhs.ray_counts[i];
+        }
+        for (size_t i = 0; i < SHAPE_TYPE_COUNT; ++i) {
+            intersection_test_counts[i] += rhs.intersection_test_counts[i];
+        }
+        bounding_box_test_count += rhs.bounding_box_test_count;
+        bvh_node_visit_count += rhs.bvh_node_visit_count;
+        for (size_t i = 0; i <= MAX_RECORDED_RECURSION_DEPTH; ++i) {
+            recursion_depth_counts[i] += rhs.recursion_depth_counts[i];
+        }
+
+        return *this;
+    }
+
+    uint64_t RenderStatistics::getTotalRayCount() const
+    {
+        return std::accumulate(ray_counts.begin(), ray_counts.end(), uint64_t{ 0 });
+    }
+
+    uint64_t RenderStatistics::getTotalIntersectionTestCount() const
+    {
+        return std::accumulate(intersection_test_counts.begin(), intersection_test_counts.end(), uint64_t{ 0 });
+    }
+
+    RenderStatistics RenderStatisticsCollector::collect()
+    {
+        const std::lock_guard lock{ s_exited_threads_mutex };
+        RenderStatistics statistics{ s_exited_threads_statistics };
+        statistics += getThreadStatistics();
+        return statistics;
+    }
+
+    void RenderStatisticsCollector::reset()
+    {
+        const std::lock_guard lock{ s_exited_threads_mutex };
+        s_exited_threads_statistics = RenderStatistics{ };
+        getThreadStatistics() = RenderStatistics{ };
+    }
+
+    RenderStatistics& RenderStatisticsCollector::getThreadStatistics()
+    {
+        // Owns a thread's counters, handing them over to the exited thread totals when the thread exits
+        struct ThreadStatistics {
+            RenderStatistics statistics{ };
+
+            ~ThreadStatistics()
+            {
+                const std::lock_guard lock{ s_exited_threads_mutex };
+                s_exited_threads_statistics += statistics;
+            }
+        };
+
+        thread_local ThreadStatistics thread_statistics{ };
+        return thread_statistics.statistics;
+    }
+
+    std::string formatRenderStatistics(const RenderStatistics& statistics)
+    {
+        constexpr std::array<std::string_view, RAY_TYPE_COUNT> ray_type_names{
+            "Primary", "Shadow", "Reflection", "Refraction" };
+        constexpr std::array<std::string_view, SHAPE_TYPE_COUNT> shape_type_names{
+            "Sphere", "Plane", "Cube", "Cylinder", "Cone", "Triangle" };
+
+        std::string output{ std::format("{:<24} {:>16}\n", "Rays", "Count") };
+        for (size_t i = 0; i < RAY_TYPE_COUNT; ++i) {
+            output += std::format("{:<24} {:>16}\n", ray_type_names[i], statistics.ray_counts[i]);
+        }
+        output += std::format("{:<24} {:>16}\n\n", "Total", statistics.getTotalRayCount());
+
+        output += std::format("{:<24} {:>16}\n", "Intersection Tests", "Count");
+        for (size_t i = 0; i < SHAPE_TYPE_COUNT; ++i) {
+            output += std::format("{:<24} {:>16}\n", shape_type_names[i], statistics.intersection_test_counts[i]);
+        }
+        output += std::format("{:<24} {:>16}\n", "Total", statistics.getTotalIntersectionTestCount());
+        output += std::format("{:<24} {:>16}\n", "Bounding Boxes", statistics.bounding_box_test_count);
+        output += std::format("{:<24} {:>16}\n\n", "BVH Nodes Visited", statistics.bvh_node_visit_count);
+
+        // Only list depths up to the deepest level reached
+        output += std::format("{:<24} {:>16}\n", "Recursion Depth", "Shading Calls");
+        size_t max_depth{ 0 };
+        for (size_t depth = 0; depth <= MAX_RECORDED_RECURSION_DEPTH; ++depth) {
+            if (statistics.recursion_depth_counts[depth] > 0)
+                max_depth = depth;
+        }
+        for (size_t depth = 0; depth <= max_depth; ++depth) {
+            const std::string depth_label{ depth == MAX_RECORDED_RECURSION_DEPTH ? std::format("{}+", depth)
+                                                                                 : std::format("{}", depth) };
+            output += std::format("{:<24} {:>16}\n", depth_label, statistics.recursion_depth_counts[depth]);
+        }
+
+        return output;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace gfx {
+    // Categories of rays traced while rendering
+    enum class RayType {
+        Primary,      // Cast from the camera through a pixel
+        Shadow,       // Cast from a surface point towards the light source
+        Reflection,   // Bounced off a reflective surface
+        Refraction    // Transmitted through a transparent surface
+    };
+    constexpr size_t RAY_TYPE_COUNT{ 4 };
+
+    // Categories of primitive shapes tested for intersection with a ray
+    enum class ShapeType {
+        Sphere,
+        Plane,
+        Cube,
+        Cylinder,
+        Cone,
+        Triangle
+    };
+    constexpr size_t SHAPE_TYPE_COUNT{ 6 };
+
+    // Deepest recursion level tracked individually in the histogram, deeper levels share the final bucket
+    constexpr size_t MAX_RECORDED_RECURSION_DEPTH{ 15 };
+
+    // Counters describing the work done to render a frame
+    struct RenderStatistics {
+        std::array<uint64_t, RAY_TYPE_COUNT> ray_counts{ };
+        std::array<uint64_t, SHAPE_TYPE_COUNT> intersection_test_counts{ };
+        uint64_t bounding_box_test_count{ 0 };
+        uint64_t bvh_node_visit_count{ 0 };
+        std::array<uint64_t, MAX_RECORDED_RECURSION_DEPTH + 1> recursion_depth_counts{ };  // Shading calls per depth
+
+        RenderStatistics& operator+=(const RenderStatistics& rhs);
+
+        [[nodiscard]] uint64_t getTotalRayCount() const;
+        [[nodiscard]] uint64_t getTotalIntersectionTestCount() const;
+    };
+
+    // Records render statistics into counters owned by each thread, so that recording never contends between the
+    // render threads. Collection is compiled in by the GFX_RENDER_STATISTICS definition (the ENABLE_RENDER_STATISTICS
+    // CMake option) and must then be switched on at run time. When compiled out, every recording method is empty.
+    class RenderStatisticsCollector
+    {
+    public:
+        /* Constants */
+
+#if defined(GFX_RENDER_STATISTICS)
+        static constexpr bool IS_AVAILABLE{ true };
+#else
+        static constexpr bool IS_AVAILABLE{ false };
+#endif
+
+        /* Collection Control */
+
+        // Switches recording on or off for every thread, which has no effect if collection is not compiled in
+        static void setEnabled(const bool is_enabled)
+        { s_is_enabled.store(IS_AVAILABLE && is_enabled, std::memory_order_relaxed); }
+
+        [[nodiscard]] static bool isEnabled()
+        { return IS_AVAILABLE && s_is_enabled.load(std::memory_order_relaxed); }
+
+        // Returns the counters of every exited thread combined with those of the calling thread. Render threads merge
+        // their counters as they exit, so after a render has finished this is the total for the render.
+        [[nodiscard]] static RenderStatistics collect();
+
+        // Clears the counters of every exited thread and the calling thread
+        static void reset();
+
+        // Returns the number of intersection tests recorded so far by the calling thread, which callers may sample
+        // before and after a unit of work to measure its cost
+        [[nodiscard]] static uint64_t getThreadIntersectionTestCount()
+        {
+            if constexpr (IS_AVAILABLE) {
+                return getThreadStatistics().getTotalIntersectionTestCount();
+            } else {
+                return 0;
+            }
+        }
+
+        /* Recording Methods */
+
+        static void recordRay(const RayType ray_type)
+        {
+            if constexpr (IS_AVAILABLE) {
+                if (isEnabled())
+                    ++getThreadStatistics().ray_counts[static_cast<size_t>(ray_type)];
+            }
+        }
+
+        static void recordIntersectionTest(const ShapeType shape_type)
+        {
+            if constexpr (IS_AVAILABLE) {
+                if (isEnabled())
+                    ++getThreadStatistics().intersection_test_counts[static_cast<size_t>(shape_type)];
+            }
+        }
+
+        static void recordBoundingBoxTest()
+        {
+            if constexpr (IS_AVAILABLE) {
+                if (isEnabled())
+                    ++getThreadStatistics().bounding_box_test_count;
+            }
+        }
+
+        static void recordBvhNodeVisit()
+        {
+            if constexpr (IS_AVAILABLE) {
+                if (isEnabled())
+                    ++getThreadStatistics().bvh_node_visit_count;
+            }
+        }
+
+        // Records a shading call at the passed-in recursion depth, for renderers which shade each depth in turn
+        // rather than recursing
+        static void recordShadingDepth(const size_t depth)
+        {
+            if constexpr (IS_AVAILABLE) {
+                if (isEnabled())
+                    ++getThreadStatistics().recursion_depth_counts[std::min(depth, MAX_RECORDED_RECURSION_DEPTH)];
+            }
+        }
+
+        /* Helper Types */
+
+        // Records the current shading recursion depth on construction and descends one level for its lifetime
+        class RecursionScope
+        {
+        public:
+            RecursionScope()
+            {
+                if constexpr (IS_AVAILABLE) {
+                    if (isEnabled()) {
+                        const size_t depth{ s_recursion_depth++ };
+                        ++getThreadStatistics().recursion_depth_counts[std::min(depth, MAX_RECORDED_RECURSION_DEPTH)];
+                        m_is_recording = true;
+                    }
+                }
+            }
+            RecursionScope(const RecursionScope&) = delete;
+
+            ~RecursionScope()
+            {
+                if constexpr (IS_AVAILABLE) {
+                    if (m_is_recording)
+                        --s_recursion_depth;
+                }
+            }
+
+            RecursionScope& operator=(const RecursionScope&) = delete;
+
+        private:
+            bool m_is_recording{ false };
+        };
+
+    private:
+        /* Data Members */
+
+        static inline std::atomic<bool> s_is_enabled{ false };
+        static inline thread_local size_t s_recursion_depth{ 0 };
+
+        static std::mutex s_exited_threads_mutex;
+        static RenderStatistics s_exited_threads_statistics;
+
+        /* Helper Methods */
+
+        // Returns the calling thread's counters, which are merged into the exited thread totals when it exits
+        [[nodiscard]] static RenderStatistics& getThreadStatistics();
+    };
+
+    /* Render Statistics Functions */
+
+    // Returns a table summarizing the rays, intersection tests, and recursion depths recorded for a render
+    [[nodiscard]] std::string formatRenderStatistics(const RenderStatistics& statistics);
+}
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+#include "render_statistics.hpp"
+
+#include <thread>
+
+#include "world.hpp"
+#include "compiled_scene.hpp"
+#include "light.hpp"
+#include "sphere.hpp"
+#include "ray.hpp"
+
+// Tests combining the counters of two sets of render statistics
+TEST(GraphicsRenderStatistics, AdditionAssignmentOperator)
+{
+    gfx::RenderStatistics statistics_a{ };
+    statistics_a.ray_counts = { 4, 2, 1, 0 };
+    statistics_a.intersection_test_counts = { 3, 0, 0, 0, 0, 1 };
+    statistics_a.bvh_node_visit_count = 7;
+    statistics_a.recursion_depth_counts[0] = 4;
+
+    gfx::RenderStatistics statistics_b{ };
+    statistics_b.ray_counts = { 1, 1, 0, 1 };
+    statistics_b.intersection_test_counts = { 0, 2, 0, 0, 0, 0 };
+    statistics_b.bounding_box_test_count = 5;
+    statistics_b.recursion_depth_counts[1] = 2;
+
+    statistics_a += statistics_b;
+
+    EXPECT_EQ(statistics_a.getTotalRayCount(), 10);
+    EXPECT_EQ(statistics_a.getTotalIntersectionTestCount(), 6);
+    EXPECT_EQ(statistics_a.bounding_box_test_count, 5);
+    EXPECT_EQ(statistics_a.bvh_node_visit_count, 7);
+    EXPECT_EQ(statistics_a.recursion_depth_counts[0], 4);
+    EXPECT_EQ(statistics_a.recursion_depth_counts[1], 2);
+}
+
+// Tests recording the work done to shade a pixel, including counters merged from an exited thread
+TEST(GraphicsRenderStatistics, CollectStatistics)
+{
+    const gfx::World world{ gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) },
+                            gfx::Sphere{ } };
+    const gfx::CompiledScene scene{ world };
+    const gfx::Ray ray{ 0, 0, -5, 0, 0, 1 };
+
+    gfx::RenderStatisticsCollector::reset();
+    gfx::RenderStatisticsCollector::setEnabled(true);
+    static_cast<void>(scene.calculatePixelColor(ray));
+    std::jthread{ [&] { static_cast<void>(scene.calculatePixelColor(ray)); } }.join();
+    gfx::RenderStatisticsCollector::setEnabled(false);
+
+    const gfx::RenderStatistics statistics{ gfx::RenderStatisticsCollector::collect() };
+    if constexpr (gfx::RenderStatisticsCollector::IS_AVAILABLE) {
+        // Each call tests the sphere and casts a shadow ray from its lit front, which bounds culling may reject
+        EXPECT_EQ(statistics.ray_counts[static_cast<size_t>(gfx::RayType::Shadow)], 2);
+        EXPECT_GE(statistics.intersection_test_counts[static_cast<size_t>(gfx::ShapeType::Sphere)], 2);
+        EXPECT_EQ(statistics.recursion_depth_counts[0], 2);
+        EXPECT_EQ(statistics.recursion_depth_counts[1], 0);
+    } else {
+        // Without the counters compiled in, nothing is recorded
+        EXPECT_EQ(statistics.getTotalRayCount(), 0);
+        EXPECT_EQ(statistics.getTotalIntersectionTestCount(), 0);
+    }
+    gfx::RenderStatisticsCollector::reset();
+}
+
+// Tests formatting the recorded statistics as a table
+TEST(GraphicsRenderStatistics, FormatRenderStatistics)
+{
+    gfx::RenderStatistics statistics{ };
+    statistics.ray_counts[static_cast<size_t>(gfx::RayType::Primary)] = 12;
+    statistics.recursion_depth_counts[0] = 12;
+
+    const std::string table{ gfx::formatRenderStatistics(statistics) };
+
+    EXPECT_NE(table.find("Primary"), std::string::npos);
+    EXPECT_NE(table.find("12"), std::string::npos);
+    EXPECT_NE(table.find("Sphere"), std::string::npos);
+}
\ No newline at end of file
@@ -12,32 +12,170 @@
 #include <cstdlib>
 #include <print>
 #include <optional>
+#include <string>
+#include <charconv>
+#include <filesystem>
+#include <vector>
 
 #include "parse.hpp"
 #include "canvas.hpp"
 #include "rendering_functions.hpp"
+#include "compiled_scene.hpp"
+#include "tile_scheduler.hpp"
+#include "render_statistics.hpp"
 
-int main(int argc, char** argv)
+struct ProgramOptions {
+    std::string input_file_path;
+    std::string output_file_path;
+    rt::RenderSettings render_settings;
+    bool print_statistics{ false };
+    bool print_ray_statistics{ false };
+    rt::PPMFormat image_format{ rt::PPMFormat::Plain };
+    std::optional<rt::HeatmapMetric> heatmap_metric{ std::nullopt };
+};
+
+// Parses a non-negative integer option value, returning std::nullopt if the value is not a valid count
+std::optional<size_t> parseCountOption(const std::string_view option_value)
+{
+    size_t count{ 0 };
+    const auto [ end_ptr, error_code ] { std::from_chars(option_value.data(),
+                                                         option_value.data() + option_value.size(),
+                                                         count) };
+    if (error_code != std::errc{ } || end_ptr != option_value.data() + option_value.size()) {
+        return std::nullopt;
+    }
+    return count;
+}
+
+// Reads the command line arguments into a set of program options, returning std::nullopt if they are invalid
+std::optional<ProgramOptions> parseProgramOptions(const int argc, char** argv)
 {
-    // Validate number of arguments
-    if (argc != 3) {
+    if (argc < 3) {
         std::println(std::cerr, "Error: Invalid number of arguments.");
+        return std::nullopt;
+    }
+
+    // Render using every available hardware thread unless a thread count is specified
+    ProgramOptions options{ argv[1], argv[2], rt::RenderSettings{ .thread_count = 0 } };
+    for (int i = 3; i < argc; ++i) {
+        const std::string_view option{ argv[i] };
+        if ((option == "-t" || option == "--threads") && i + 1 < argc) {
+            const auto thread_count{ parseCountOption(argv[++i]) };
+            if (!thread_count) {
+                std::println(std::cerr, "Error: Thread count must be a non-negative integer.");
+                return std::nullopt;
+            }
+            options.render_settings.thread_count = thread_count.value();
+        } else if ((option == "-p" || option == "--packets") && i + 1 < argc) {
+            const auto packet_size{ parseCountOption(argv[++i]) };
+            if (!packet_size || packet_size.value() == 0 || packet_size.value() > rt::MAX_PACKET_SIZE) {
+                std::println(std::cerr, "Error: Packet size must be an integer between 1 and {}.", rt::MAX_PACKET_SIZE);
+                return std::nullopt;
+            }
+            options.render_settings.packet_size = packet_size.value();
+        } else if (option == "-w" || option == "--wavefront") {
+            options.render_settings.tracing_mode = rt::TracingMode::Wavefront;
+        } else if (option == "-s" || option == "--stats") {
+            options.print_statistics = true;
+        } else if (option == "-r" || option == "--ray-stats") {
+            if (!gfx::RenderStatisticsCollector::IS_AVAILABLE) {
+                std::println(std::cerr, "Error: Ray statistics require a build with ENABLE_RENDER_STATISTICS.");
+                return std::nullopt;
+            }
+            options.print_ray_statistics = true;
+        } else if ((option == "-m" || option == "--heatmap") && i + 1 < argc) {
+            const std::string_view metric{ argv[++i] };
+            if (metric == "time") {
+                options.heatmap_metric = rt::HeatmapMetric::RenderTime;
+            } else if (metric == "tests" && gfx::RenderStatisticsCollector::IS_AVAILABLE) {
+                options.heatmap_metric = rt::HeatmapMetric::IntersectionTests;
+            } else if (metric == "tests") {
+                std::println(std::cerr, "Error: Test count heatmaps require a build with ENABLE_RENDER_STATISTICS.");
+                return std::nullopt;
+            } else {
+                std::println(std::cerr, "Error: Heatmap metric must be \"time\" or \"tests\".");
+                return std::nullopt;
+            }
+        } else if (option == "-b" || option == "--binary") {
+            options.image_format = rt::PPMFormat::Binary;
+        } else {
+            std::println(std::cerr, "Error: Unrecognized option \"{}\".", option);
+            return std::nullopt;
+        }
+    }
+
+    if (options.render_settings.tracing_mode == rt::TracingMode::Wavefront && options.render_settings.packet_size > 1) {
+        std::println(std::cerr, "Error: Wavefront tracing cannot be combined with packets.");
+        return std::nullopt;
+    }
+    if (options.heatmap_metric && (options.render_settings.tracing_mode != rt::TracingMode::Recursive ||
+                                   options.render_settings.packet_size > 1)) {
+        std::println(std::cerr, "Error: Heatmaps cannot be combined with wavefront tracing or packets.");
+        return std::nullopt;
+    }
+
+    return options;
+}
+
+int main(int argc, char** argv)
+{
+    // Validate the arguments
+    const auto options{ parseProgramOptions(argc, argv) };
+    if (!options) {
+        std::println(std::cerr, "Usage: {} <input_file> <output_file> [--threads <count>] [--packets <size>] "
+                                "[--wavefront] [--stats] [--ray-stats] [--heatmap <time|tests>] [--binary]",
+                     argv[0]);
         return EXIT_FAILURE;
     }
 
     // Read in scene data
-    std::string_view input_file_path{ argv[1] };
-    std::ifstream input_file{ input_file_path };
+    std::ifstream input_file{ options->input_file_path };
     json scene_data = json::parse(input_file);
     Scene scene{ data::parseSceneData(scene_data) };
 
+    // Compile the world into its render representation once, before any rays are traced
+    const gfx::CompiledScene compiled_scene{ scene.world };
+    if (options->print_statistics) {
+        std::print("{}\n", gfx::formatCompiledSceneStatistics(compiled_scene.getStatistics()));
+    }
+
     // Render the scene to a canvas
-    rt::Canvas image{ rt::render(scene.world, scene.camera) };
+    gfx::RenderStatisticsCollector::setEnabled(options->print_ray_statistics ||
+                                               options->heatmap_metric == rt::HeatmapMetric::IntersectionTests);
+    rt::SchedulerStatistics scheduler_statistics{ };
+    std::vector<double> pixel_costs{ };
+    rt::Canvas image{ options->heatmap_metric ? rt::render(compiled_scene,
+                                                           scene.camera,
+                                                           options->render_settings,
+                                                           scheduler_statistics,
+                                                           options->heatmap_metric.value(),
+                                                           pixel_costs)
+                                              : rt::render(compiled_scene,
+                                                           scene.camera,
+                                                           options->render_settings,
+                                                           scheduler_statistics) };
+    if (options->print_statistics) {
+        std::print("{}", rt::formatSchedulerStatistics(scheduler_statistics));
+    }
+
+    // Export data to PPM file, streaming the rows directly to disk
+    std::ofstream out_file{ options->output_file_path, std::ios_base::binary | std::ios_base::trunc };
+    rt::writePPM(out_file, image, options->image_format);
 
-    // Export data to PPM file
-    const std::string_view output_file_path{ argv[2] };
-    std::ofstream out_file{ output_file_path, std::ios_base::trunc};
-    out_file << rt::exportAsPPM(image);
+    // Export the pixel cost heatmap alongside the image, appending "_heatmap" to the output file name
+    if (options->heatmap_metric) {
+        std::filesystem::path heatmap_file_path{ options->output_file_path };
+        heatmap_file_path.replace_filename(heatmap_file_path.stem().string() + "_heatmap" +
+                                           heatmap_file_path.extension().string());
+        std::ofstream heatmap_file{ heatmap_file_path, std::ios_base::binary | std::ios_base::trunc };
+        rt::writePPM(heatmap_file, rt::createHeatmap(pixel_costs, image.width(), image.height()),
+                     options->image_format);
+    }
+
+    // Summarize the work done to render the scene
+    if (options->print_ray_statistics) {
+        std::print("{}", gfx::formatRenderStatistics(gfx::RenderStatisticsCollector::collect()));
+    }
 
     return EXIT_SUCCESS;
 }
\ No newline at end of file
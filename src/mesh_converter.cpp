@@ -0,0 +1,92 @@
+/*--------------------------------------------------------------
+* Mesh Converter
+*
+* Converts Wavefront OBJ geometry into the memory-mapped mesh
+* cache format read by the ray tracer, building the bounding
+* volume hierarchy once ahead of time rather than on every render
+----------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+
+#include "obj_parser.hpp"
+#include "mesh_cache.hpp"
+
+struct ConverterOptions {
+    std::string input_file_path;
+    std::string output_file_path;
+    std::optional<std::string> group_name{ std::nullopt };
+    bool verify_only{ false };
+};
+
+// Reads the command line arguments into a set of converter options, returning std::nullopt if they are invalid
+std::optional<ConverterOptions> parseConverterOptions(const int argc, char** argv)
+{
+    if (argc == 3 && std::string_view{ argv[1] } == "--verify")
+        return ConverterOptions{ .input_file_path = argv[2], .verify_only = true };
+
+    if (argc < 3) {
+        std::println(std::cerr, "Error: Invalid number of arguments.");
+        return std::nullopt;
+    }
+
+    ConverterOptions options{ argv[1], argv[2] };
+    for (int i = 3; i < argc; ++i) {
+        const std::string_view option{ argv[i] };
+        if ((option == "-g" || option == "--group") && i + 1 < argc) {
+            options.group_name = argv[++i];
+        } else {
+            std::println(std::cerr, "Error: Unrecognized option \"{}\".", option);
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
+
+int main(int argc, char** argv)
+{
+    // Validate the arguments
+    const auto options{ parseConverterOptions(argc, argv) };
+    if (!options) {
+        std::println(std::cerr, "Usage: {} <input_obj_file> <output_cache_file> [--group <name>]\n"
+                                "       {} --verify <cache_file>",
+                     argv[0], argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        const auto start_time{ std::chrono::steady_clock::now() };
+        const auto print_mesh_summary{ [&](const std::string_view action, const gfx::TriangleMeshData& mesh_data) {
+            const std::chrono::duration<double> elapsed_time{ std::chrono::steady_clock::now() - start_time };
+            std::println("{} {} triangles and {} vertices in {:.3f} s.",
+                         action, mesh_data.getTriangleCount(), mesh_data.getVertexCount(), elapsed_time.count());
+        } };
+
+        // Check an existing cache file, including the checksum of every section
+        if (options->verify_only) {
+            const auto mesh_data{ data::loadMeshCache(options->input_file_path, data::MeshCacheValidation::Checksum) };
+            print_mesh_summary("Verified", *mesh_data);
+            return EXIT_SUCCESS;
+        }
+
+        // Parse the OBJ file and build the hierarchy, then write the result out in its in-memory layout
+        const data::ObjData obj_data{ data::parseObjFile(options->input_file_path) };
+        const auto mesh_data{ options->group_name ? data::createTriangleMeshData(obj_data, options->group_name.value())
+                                                  : data::createTriangleMeshData(obj_data) };
+        data::writeMeshCache(*mesh_data, std::filesystem::path{ options->output_file_path });
+        print_mesh_summary("Converted", *mesh_data);
+    } catch (const std::exception& error) {
+        std::println(std::cerr, "Error: {}", error.what());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include "mesh_cache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RT_MESH_CACHE_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace data {
+    // The header is checksummed and written as raw bytes, so it must not contain any padding
+    static_assert(std::is_trivially_copyable_v<MeshCacheHeader>);
+    static_assert(offsetof(MeshCacheHeader, header_checksum) + sizeof(uint64_t) == sizeof(MeshCacheHeader));
+    static_assert(sizeof(MeshCacheHeader) % alignof(MeshCacheHeader) == 0);
+
+    // Memory-Mapped File Constructor
+    MappedFile::MappedFile(const std::filesystem::path& file_path)
+    {
+#ifdef RT_MESH_CACHE_HAS_MMAP
+        const int file_descriptor{ ::open(file_path.c_str(), O_RDONLY) };
+        if (file_descriptor < 0)
+            throw std::invalid_argument{ std::format("Unable to open file \"{}\".", file_path.string()) };
+
+        struct stat file_status{ };
+        if (::fstat(file_descriptor, &file_status) != 0) {
+            ::close(file_descriptor);
+            throw std::invalid_argument{ std::format("Unable to read the size of file \"{}\".", file_path.string()) };
+        }
+
+        // An empty file cannot be mapped, but is still a valid (empty) view
+        m_size = static_cast<size_t>(file_status.st_size);
+        if (m_size > 0) {
+            void* const mapping{ ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0) };
+            if (mapping == MAP_FAILED) {
+                ::close(file_descriptor);
+                throw std::invalid_argument{ std::format("Unable to map file \"{}\".", file_path.string()) };
+            }
+            m_data = static_cast<const std::byte*>(mapping);
+        }
+
+        // The mapping remains valid after the file is closed
+        ::close(file_descriptor);
+#else
+        std::ifstream file{ file_path, std::ios_base::binary | std::ios_base::ate };
+        if (!file)
+            throw std::invalid_argument{ std::format("Unable to open file \"{}\".", file_path.string()) };
+
+        m_buffer.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+#ifdef RT_MESH_CACHE_HAS_MMAP
+        if (m_data)
+            ::munmap(const_cast<std::byte*>(m_data), m_size);
+#endif
+    }
+
+    // Mesh Cache Stream Writer
+    void writeMeshCache(const gfx::TriangleMeshData& mesh_data, std::ostream& cache_stream)
+    {
+        const gfx::BoundingVolumeHierarchy& bvh{ mesh_data.getBoundingVolumeHierarchy() };
+        const std::array<std::span<const std::byte>, MESH_CACHE_SECTION_COUNT> section_bytes{
+                std::as_bytes(mesh_data.getVertices()),
+                std::as_bytes(mesh_data.getNormals()),
+                std::as_bytes(mesh_data.getIndices()),
+                std::as_bytes(bvh.getWideNodes()),
+                std::as_bytes(bvh.getPrimitiveIndices())
+        };
+
+        // Lay out the sections one after another following the header, each starting on an aligned offset
+        const auto align_offset{ [](const uint64_t offset) {
+            return (offset + MESH_CACHE_SECTION_ALIGNMENT - 1) / MESH_CACHE_SECTION_ALIGNMENT *
+                   MESH_CACHE_SECTION_ALIGNMENT;
+        } };
+        MeshCacheHeader header{ };
+        uint64_t section_offset{ align_offset(sizeof(MeshCacheHeader)) };
+        for (size_t i = 0; i < MESH_CACHE_SECTION_COUNT; ++i) {
+            header.sections[i] = MeshCacheSectionRange{ section_offset,
+                                                        section_bytes[i].size(),
+                                                        computeMeshCacheChecksum(section_bytes[i]) };
+            section_offset = align_offset(section_offset + section_bytes[i].size());
+        }
+        header.file_size = section_offset;
+        header.header_checksum = computeMeshCacheChecksum(
+                std::as_bytes(std::span{ &header, 1 }).first(offsetof(MeshCacheHeader, header_checksum)));
+
+        const auto write_bytes{ [&](const std::span<const std::byte> bytes) {
+            cache_stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        } };
+        const std::array<std::byte, MESH_CACHE_SECTION_ALIGNMENT> padding{ };
+        uint64_t written_size{ sizeof(MeshCacheHeader) };
+        write_bytes(std::as_bytes(std::span{ &header, 1 }));
+        for (size_t i = 0; i < MESH_CACHE_SECTION_COUNT; ++i) {
+            write_bytes(std::span{ padding }.first(header.sections[i].offset - written_size));
+            write_bytes(section_bytes[i]);
+            written_size = header.sections[i].offset + header.sections[i].size;
+        }
+        write_bytes(std::span{ padding }.first(header.file_size - written_size));
+
+        if (!cache_stream)
+            throw std::invalid_argument{ "Unable to write mesh cache data to the stream." };
+    }
+
+    // Mesh Cache File Writer
+    void writeMeshCache(const gfx::TriangleMeshData& mesh_data, const std::filesystem::path& cache_file_path)
+    {
+        std::ofstream cache_file{ cache_file_path, std::ios_base::binary | std::ios_base::trunc };
+        if (!cache_file)
+            throw std::invalid_argument{ std::format("Unable to create mesh cache file \"{}\".",
+                                                     cache_file_path.string()) };
+
+        writeMeshCache(mesh_data, cache_file);
+    }
+
+    // Mesh Cache File Loader
+    std::shared_ptr<const gfx::TriangleMeshData> loadMeshCache(const std::filesystem::path& cache_file_path,
+                                                               const MeshCacheValidation validation)
+    {
+        const auto cache_file{ std::make_shared<const MappedFile>(cache_file_path) };
+        const std::span<const std::byte> file_bytes{ cache_file->getBytes() };
+        const auto throw_invalid_cache{ [&](const std::string_view reason) {
+            throw std::invalid_argument{
+                    std::format("Invalid mesh cache file \"{}\": {}.", cache_file_path.string(), reason) };
+        } };
+
+        // Copy the header out of the mapping, since it is small and read field by field
+        MeshCacheHeader header{ };
+        if (file_bytes.size() < sizeof(MeshCacheHeader))
+            throw_invalid_cache("file is too small to contain a header");
+        std::memcpy(&header, file_bytes.data(), sizeof(MeshCacheHeader));
+
+        if (header.magic != MESH_CACHE_MAGIC)
+            throw_invalid_cache("file is not a mesh cache");
+        if (header.version != MESH_CACHE_VERSION)
+            throw_invalid_cache(std::format("unsupported version {}, expected {}", header.version, MESH_CACHE_VERSION));
+        if (header.byte_order_mark != MESH_CACHE_BYTE_ORDER_MARK ||
+                header.vertex_size != sizeof(gfx::Vector4) ||
+                header.bvh_wide_node_size != sizeof(gfx::BoundingVolumeHierarchy::WideNode))
+            throw_invalid_cache("file was written for a different platform or build");
+        if (header.header_checksum != computeMeshCacheChecksum(
+                file_bytes.first(offsetof(MeshCacheHeader, header_checksum))))
+            throw_invalid_cache("header checksum does not match");
+        if (header.file_size != file_bytes.size())
+            throw_invalid_cache("file size does not match the header, the file may be truncated");
+
+        // Check that every section lies within the file and holds a whole number of aligned elements
+        const std::array<size_t, MESH_CACHE_SECTION_COUNT> element_sizes{
+                sizeof(gfx::Vector4),
+                sizeof(gfx::Vector4),
+                sizeof(uint32_t),
+                sizeof(gfx::BoundingVolumeHierarchy::WideNode),
+                sizeof(uint32_t)
+        };
+        for (size_t i = 0; i < MESH_CACHE_SECTION_COUNT; ++i) {
+            const MeshCacheSectionRange& section{ header.sections[i] };
+            if (section.offset % MESH_CACHE_SECTION_ALIGNMENT != 0 ||
+                    section.offset < sizeof(MeshCacheHeader) ||
+                    section.offset > file_bytes.size() ||
+                    section.size > file_bytes.size() - section.offset ||
+                    section.size % element_sizes[i] != 0)
+                throw_invalid_cache("section layout is invalid");
+
+            if (validation == MeshCacheValidation::Checksum &&
+                    section.checksum != computeMeshCacheChecksum(file_bytes.subspan(section.offset, section.size)))
+                throw_invalid_cache("section checksum does not match, the file may be corrupted");
+        }
+
+        // Reference the buffers in place, sharing ownership of the mapping between the mesh data and its hierarchy
+        const auto get_section{ [&]<typename T>(const MeshCacheSection section_id, std::type_identity<T>) {
+            const MeshCacheSectionRange& section{ header.getSection(section_id) };
+            return std::span<const T>{ reinterpret_cast<const T*>(file_bytes.data() + section.offset),
+                                       section.size / sizeof(T) };
+        } };
+        constexpr std::type_identity<gfx::Vector4> vector_type{ };
+        constexpr std::type_identity<uint32_t> index_type{ };
+        constexpr std::type_identity<gfx::BoundingVolumeHierarchy::WideNode> wide_node_type{ };
+        gfx::BoundingVolumeHierarchy bvh{ get_section(MeshCacheSection::BvhWideNodes, wide_node_type),
+                                          get_section(MeshCacheSection::BvhPrimitiveIndices, index_type),
+                                          cache_file };
+        return std::make_shared<const gfx::TriangleMeshData>(get_section(MeshCacheSection::Vertices, vector_type),
+                                                             get_section(MeshCacheSection::Normals, vector_type),
+                                                             get_section(MeshCacheSection::Indices, index_type),
+                                                             std::move(bvh),
+                                                             cache_file);
+    }
+
+    // Mesh Cache Checksum
+    uint64_t computeMeshCacheChecksum(const std::span<const std::byte> bytes)
+    {
+        // Mixes words with the multiply-rotate round used by xxHash64, keeping four lanes in flight to hide latency
+        constexpr uint64_t prime_a{ 0x9E3779B185EBCA87 };
+        constexpr uint64_t prime_b{ 0xC2B2AE3D27D4EB4F };
+        constexpr uint64_t prime_c{ 0x165667B19E3779F9 };
+        const auto mix_word{ [](const uint64_t lane, const uint64_t word) {
+            return std::rotl(lane + word * prime_b, 31) * prime_a;
+        } };
+        const auto load_word{ [](const std::byte* word_bytes) {
+            uint64_t word{ 0 };
+            std::memcpy(&word, word_bytes, sizeof(word));
+            return word;
+        } };
+
+        std::array<uint64_t, 4> lanes{ prime_a + prime_b, prime_b, 0, 0 - prime_a };
+        size_t offset{ 0 };
+        for (; offset + sizeof(uint64_t) * lanes.size() <= bytes.size(); offset += sizeof(uint64_t) * lanes.size()) {
+            for (size_t i = 0; i < lanes.size(); ++i) {
+                lanes[i] = mix_word(lanes[i], load_word(bytes.data() + offset + sizeof(uint64_t) * i));
+            }
+        }
+
+        uint64_t checksum{ std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) +
+                           std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18) };
+        checksum += bytes.size();
+        for (; offset + sizeof(uint64_t) <= bytes.size(); offset += sizeof(uint64_t)) {
+            checksum = std::rotl(checksum ^ mix_word(0, load_word(bytes.data() + offset)), 27) * prime_a + prime_c;
+        }
+        for (; offset < bytes.size(); ++offset) {
+            checksum = std::rotl(checksum ^ (static_cast<uint64_t>(bytes[offset]) * prime_c), 11) * prime_a;
+        }
+
+        // Avalanche the final value so that every input bit affects every output bit
+        checksum ^= checksum >> 33;
+        checksum *= prime_b;
+        checksum ^= checksum >> 29;
+        checksum *= prime_c;
+        checksum ^= checksum >> 32;
+        return checksum;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "triangle_mesh.hpp"
+
+namespace data {
+    // Identifies a mesh cache file. The version is bumped whenever the layout of the file changes, since cache files
+    // are always rebuilt from their source geometry rather than upgraded.
+    constexpr std::array<char, 8> MESH_CACHE_MAGIC{ 'R', 'T', 'M', 'E', 'S', 'H', '\0', '\0' };
+    constexpr uint32_t MESH_CACHE_VERSION{ 3 };
+
+    // File extension used to recognize mesh cache files in scene data
+    constexpr std::string_view MESH_CACHE_EXTENSION{ ".rtmesh" };
+
+    // Written in the native byte order, so that a cache built on a machine with a different byte order is rejected
+    constexpr uint32_t MESH_CACHE_BYTE_ORDER_MARK{ 0x01020304 };
+
+    // Each section starts on a multiple of this offset, keeping every buffer aligned for its element type once mapped
+    constexpr uint64_t MESH_CACHE_SECTION_ALIGNMENT{ 64 };
+
+    // Sections of a mesh cache file, in the order they are stored
+    enum class MeshCacheSection : size_t {
+        Vertices,
+        Normals,
+        Indices,
+        BvhWideNodes,
+        BvhPrimitiveIndices
+    };
+    constexpr size_t MESH_CACHE_SECTION_COUNT{ 5 };
+
+    // Location of a section within a mesh cache file, with a checksum of its contents
+    struct MeshCacheSectionRange {
+        uint64_t offset{ 0 };
+        uint64_t size{ 0 };             // In bytes
+        uint64_t checksum{ 0 };
+    };
+
+    // Header at the start of every mesh cache file. The buffers of the mesh and its bounding volume hierarchy follow
+    // in the exact in-memory layout used by the renderer, so a mapped file can be used without deserializing it.
+    struct MeshCacheHeader {
+        std::array<char, 8> magic{ MESH_CACHE_MAGIC };
+        uint32_t version{ MESH_CACHE_VERSION };
+        uint32_t byte_order_mark{ MESH_CACHE_BYTE_ORDER_MARK };
+        uint32_t vertex_size{ sizeof(gfx::Vector4) };
+        uint32_t bvh_wide_node_size{ sizeof(gfx::BoundingVolumeHierarchy::WideNode) };  // Differs by node width
+        uint64_t file_size{ 0 };
+        std::array<MeshCacheSectionRange, MESH_CACHE_SECTION_COUNT> sections{ };
+        uint64_t header_checksum{ 0 };  // Checksum of every header field preceding this one
+
+        [[nodiscard]] const MeshCacheSectionRange& getSection(const MeshCacheSection section) const
+        { return sections[static_cast<size_t>(section)]; }
+    };
+
+    // How thoroughly a mesh cache file is checked when it is loaded
+    enum class MeshCacheValidation {
+        Header,     // Checks the header, the section layout, and that every index in the mesh and hierarchy is in range
+        Checksum    // Also verifies the checksum of every section, reading the whole file
+    };
+
+    // A read-only view of a whole file, memory-mapped where the platform supports it and read into memory otherwise
+    class MappedFile
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor
+        MappedFile() = delete;
+
+        // Standard Constructor
+        explicit MappedFile(const std::filesystem::path& file_path);
+
+        // Copy Constructor (Deleted, the mapping is shared by pointer)
+        MappedFile(const MappedFile&) = delete;
+
+        /* Destructor */
+
+        ~MappedFile();
+
+        /* Assignment Operators */
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /* Accessors */
+
+        [[nodiscard]] std::span<const std::byte> getBytes() const
+        { return { m_data, m_size }; }
+
+    private:
+        /* Data Members */
+
+        const std::byte* m_data{ nullptr };
+        size_t m_size{ 0 };
+        std::vector<std::byte> m_buffer{ };     // Holds the file contents on platforms without memory mapping
+    };
+
+    /* Mesh Cache Functions */
+
+    // Writes triangle mesh data and its prebuilt bounding volume hierarchy to a stream in the mesh cache format
+    void writeMeshCache(const gfx::TriangleMeshData& mesh_data, std::ostream& cache_stream);
+
+    // Writes triangle mesh data to a mesh cache file, replacing any existing file
+    void writeMeshCache(const gfx::TriangleMeshData& mesh_data, const std::filesystem::path& cache_file_path);
+
+    // Maps a mesh cache file into memory and returns mesh data which references the mapped buffers directly. The
+    // mapping stays open for as long as the mesh data is in use. Throws if the file fails the passed-in validation.
+    [[nodiscard]] std::shared_ptr<const gfx::TriangleMeshData> loadMeshCache(
+            const std::filesystem::path& cache_file_path,
+            MeshCacheValidation validation = MeshCacheValidation::Checksum);
+
+    // Returns a 64-bit checksum of a range of bytes, hashing four independent lanes of eight-byte words at a time
+    [[nodiscard]] uint64_t computeMeshCacheChecksum(std::span<const std::byte> bytes);
+}
@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+#include "mesh_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ray.hpp"
+#include "intersection.hpp"
+
+// Returns smooth shaded mesh data for a flat grid of unit squares covering [0, size] along the x and y axes
+static std::shared_ptr<const gfx::TriangleMeshData> createGridMeshData(const uint32_t size)
+{
+    std::vector<gfx::Vector4> vertices{ };
+    std::vector<gfx::Vector4> normals{ };
+    for (uint32_t y = 0; y <= size; ++y)
+        for (uint32_t x = 0; x <= size; ++x) {
+            vertices.push_back(gfx::createPoint(x, y, 0));
+            normals.push_back(gfx::createVector(0, 0, -1));
+        }
+
+    std::vector<uint32_t> indices{ };
+    for (uint32_t y = 0; y < size; ++y)
+        for (uint32_t x = 0; x < size; ++x) {
+            const uint32_t corner{ y * (size + 1) + x };
+            indices.insert(indices.end(), { corner, corner + 1, corner + size + 1 });
+            indices.insert(indices.end(), { corner + 1, corner + size + 2, corner + size + 1 });
+        }
+
+    return std::make_shared<const gfx::TriangleMeshData>(std::move(vertices), std::move(normals), std::move(indices));
+}
+
+// Returns a path in the temporary directory for a mesh cache file used by a single test
+static std::filesystem::path getTemporaryCachePath(const std::string& test_name)
+{
+    return std::filesystem::temp_directory_path() / ("mesh_cache_" + test_name + std::string{ data::MESH_CACHE_EXTENSION });
+}
+
+// Tests writing mesh data to a cache file and mapping it back in
+TEST(RayTracerMeshCache, WriteAndLoadMeshCache)
+{
+    const auto mesh_data_expected{ createGridMeshData(8) };
+    const std::filesystem::path cache_file_path{ getTemporaryCachePath("round_trip") };
+    data::writeMeshCache(*mesh_data_expected, cache_file_path);
+
+    const auto mesh_data_actual{ data::loadMeshCache(cache_file_path) };
+
+    EXPECT_TRUE(mesh_data_actual->isExternallyStored());
+    EXPECT_EQ(*mesh_data_actual, *mesh_data_expected);
+    EXPECT_EQ(mesh_data_actual->getBounds(), mesh_data_expected->getBounds());
+    EXPECT_EQ(mesh_data_actual->getBoundingVolumeHierarchy().getWideNodes().size(),
+              mesh_data_expected->getBoundingVolumeHierarchy().getWideNodes().size());
+    EXPECT_TRUE(std::ranges::equal(mesh_data_actual->getBoundingVolumeHierarchy().getPrimitiveIndices(),
+                                   mesh_data_expected->getBoundingVolumeHierarchy().getPrimitiveIndices()));
+
+    // The mapped hierarchy is used as-is to intersect the mesh, and keeps the mapping open after loading returns
+    const gfx::TriangleMesh mesh{ mesh_data_actual };
+    const gfx::Ray ray{ 2.25, 1.25, -2, 0, 0, 1 };
+    const auto hit{ mesh.getClosestIntersection(ray, 0, 100) };
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_FLOAT_EQ(hit->getT(), 2);
+    EXPECT_EQ(mesh.getSurfaceNormalAt(ray.position(hit->getT()), hit.value()), gfx::createVector(0, 0, -1));
+
+    std::filesystem::remove(cache_file_path);
+}
+
+// Tests that every section starts on an aligned offset following the header
+TEST(RayTracerMeshCache, MeshCacheLayout)
+{
+    std::ostringstream cache_stream{ };
+    data::writeMeshCache(*createGridMeshData(3), cache_stream);
+    const std::string cache_bytes{ cache_stream.str() };
+
+    ASSERT_GE(cache_bytes.size(), sizeof(data::MeshCacheHeader));
+    data::MeshCacheHeader header{ };
+    std::memcpy(&header, cache_bytes.data(), sizeof(data::MeshCacheHeader));
+
+    EXPECT_EQ(header.magic, data::MESH_CACHE_MAGIC);
+    EXPECT_EQ(header.version, data::MESH_CACHE_VERSION);
+    EXPECT_EQ(header.file_size, cache_bytes.size());
+    EXPECT_EQ(header.getSection(data::MeshCacheSection::Vertices).size, 16 * sizeof(gfx::Vector4));
+    EXPECT_EQ(header.getSection(data::MeshCacheSection::Indices).size, 54 * sizeof(uint32_t));
+    for (const data::MeshCacheSectionRange& section : header.sections) {
+        EXPECT_EQ(section.offset % data::MESH_CACHE_SECTION_ALIGNMENT, 0);
+        EXPECT_GE(section.offset, sizeof(data::MeshCacheHeader));
+        EXPECT_LE(section.offset + section.size, header.file_size);
+    }
+}
+
+// Tests that damaged or mismatched cache files are rejected
+TEST(RayTracerMeshCache, LoadInvalidMeshCache)
+{
+    const std::filesystem::path cache_file_path{ getTemporaryCachePath("invalid") };
+    std::ostringstream cache_stream{ };
+    data::writeMeshCache(*createGridMeshData(4), cache_stream);
+    const std::string cache_bytes{ cache_stream.str() };
+    data::MeshCacheHeader header{ };
+    std::memcpy(&header, cache_bytes.data(), sizeof(data::MeshCacheHeader));
+
+    const auto write_cache_file{ [&](const std::string& bytes) {
+        std::ofstream cache_file{ cache_file_path, std::ios_base::binary | std::ios_base::trunc };
+        cache_file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    } };
+
+    // Test a file which is not a mesh cache
+    write_cache_file("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path)), std::invalid_argument);
+
+    // Test a truncated file
+    write_cache_file(cache_bytes.substr(0, cache_bytes.size() - data::MESH_CACHE_SECTION_ALIGNMENT));
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path)), std::invalid_argument);
+
+    // Test a file with a modified header
+    std::string modified_header_bytes{ cache_bytes };
+    modified_header_bytes[offsetof(data::MeshCacheHeader, version)] = static_cast<char>(data::MESH_CACHE_VERSION + 1);
+    write_cache_file(modified_header_bytes);
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path)), std::invalid_argument);
+
+    // Test a file with a corrupted vertex, which is only detected when the checksums are verified
+    std::string corrupted_bytes{ cache_bytes };
+    corrupted_bytes[header.getSection(data::MeshCacheSection::Vertices).offset + 3] ^= 0x10;
+    write_cache_file(corrupted_bytes);
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path, data::MeshCacheValidation::Checksum)),
+                 std::invalid_argument);
+    EXPECT_NO_THROW(static_cast<void>(data::loadMeshCache(cache_file_path, data::MeshCacheValidation::Header)));
+
+    // Test files with an out of range vertex index, hierarchy node, or primitive index, which would be read out of
+    // bounds by the first ray to reach them, so are rejected without verifying the checksums
+    const auto write_modified_word{ [&](const data::MeshCacheSection section_id, const size_t byte_offset) {
+        std::string modified_bytes{ cache_bytes };
+        const uint32_t out_of_range_value{ 0x7fffffff };
+        std::memcpy(modified_bytes.data() + header.getSection(section_id).offset + byte_offset,
+                    &out_of_range_value,
+                    sizeof(out_of_range_value));
+        write_cache_file(modified_bytes);
+    } };
+    write_modified_word(data::MeshCacheSection::Indices, 5 * sizeof(uint32_t));
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path, data::MeshCacheValidation::Header)),
+                 std::invalid_argument);
+    write_modified_word(data::MeshCacheSection::BvhWideNodes,
+                        offsetof(gfx::BoundingVolumeHierarchy::WideNode, child_offsets));
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path, data::MeshCacheValidation::Header)),
+                 std::invalid_argument);
+    write_modified_word(data::MeshCacheSection::BvhPrimitiveIndices, 0);
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path, data::MeshCacheValidation::Header)),
+                 std::invalid_argument);
+
+    // Test a file which does not exist
+    std::filesystem::remove(cache_file_path);
+    EXPECT_THROW(static_cast<void>(data::loadMeshCache(cache_file_path)), std::invalid_argument);
+}
+
+// Tests that the checksum depends on every byte and the length of the input
+TEST(RayTracerMeshCache, ComputeMeshCacheChecksum)
+{
+    std::vector<std::byte> bytes(100, std::byte{ 0x5A });
+    const uint64_t checksum{ data::computeMeshCacheChecksum(bytes) };
+
+    EXPECT_EQ(data::computeMeshCacheChecksum(bytes), checksum);
+    EXPECT_NE(data::computeMeshCacheChecksum(std::span{ bytes }.first(99)), checksum);
+    for (const size_t changed_index : { 0, 31, 32, 95, 99 }) {
+        std::vector<std::byte> changed_bytes{ bytes };
+        changed_bytes[changed_index] ^= std::byte{ 1 };
+        EXPECT_NE(data::computeMeshCacheChecksum(changed_bytes), checksum);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "benchmark/benchmark.h"
+#include "obj_parser.hpp"
+
+#include <format>
+#include <sstream>
+#include <string>
+
+// Returns the OBJ text of a flat grid of quads with the passed-in number of squares along each side
+static std::string createGridObjText(const int size)
+{
+    std::string obj_text{ "# Benchmark grid\ng grid\n" };
+    for (int y = 0; y <= size; ++y)
+        for (int x = 0; x <= size; ++x) {
+            obj_text += std::format("v {:.6f} {:.6f} {:.6f}\n", x * 0.01, y * 0.01, 0.0);
+        }
+
+    obj_text += "vn 0 0 -1\n";
+    for (int y = 0; y < size; ++y)
+        for (int x = 0; x < size; ++x) {
+            const int corner{ y * (size + 1) + x + 1 };
+            obj_text += std::format("f {}//1 {}//1 {}//1 {}//1\n",
+                                    corner, corner + 1, corner + size + 2, corner + size + 1);
+        }
+
+    return obj_text;
+}
+
+// Benchmarks reading OBJ text in chunks, reporting the parsing throughput in bytes per second
+static void BM_ParseObjStream(benchmark::State& state)
+{
+    const std::string obj_text{ createGridObjText(static_cast<int>(state.range(0))) };
+
+    for (auto _ : state) {
+        std::istringstream obj_stream{ obj_text };
+        const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+        benchmark::DoNotOptimize(obj_data.triangle_corners.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(obj_text.size()));
+}
+BENCHMARK(BM_ParseObjStream)->Arg(100)->Arg(500);
+
+// Benchmarks building triangle mesh data, including its hierarchy, from parsed OBJ data
+static void BM_CreateTriangleMeshData(benchmark::State& state)
+{
+    std::istringstream obj_stream{ createGridObjText(static_cast<int>(state.range(0))) };
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    for (auto _ : state) {
+        const auto mesh_data{ data::createTriangleMeshData(obj_data) };
+        benchmark::DoNotOptimize(mesh_data->getTriangleCount());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(obj_data.getTriangleCount()));
+}
+BENCHMARK(BM_CreateTriangleMeshData)->Arg(100)->Arg(500);
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "obj_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace data {
+    // Streaming OBJ Parser
+    ObjData parseObjStream(std::istream& obj_stream, const size_t chunk_size)
+    {
+        if (chunk_size == 0)
+            throw std::invalid_argument{ "OBJ read chunk size must be greater than zero." };
+
+        // Read the stream a chunk at a time, carrying any incomplete line at the end of a chunk over to the next
+        ObjData obj_data{ };
+        std::vector<char> buffer(chunk_size);
+        size_t buffered_size{ 0 };
+        size_t line_number{ 0 };
+        while (true) {
+            // A line longer than the buffer cannot be completed, so make room for the rest of it
+            if (buffered_size == buffer.size())
+                buffer.resize(2 * buffer.size());
+
+            obj_stream.read(buffer.data() + buffered_size, static_cast<std::streamsize>(buffer.size() - buffered_size));
+            buffered_size += static_cast<size_t>(obj_stream.gcount());
+
+            const std::string_view buffered_data{ buffer.data(), buffered_size };
+            size_t line_start{ 0 };
+            for (size_t line_end = buffered_data.find('\n');
+                 line_end != std::string_view::npos;
+                 line_end = buffered_data.find('\n', line_start)) {
+                parseObjLine(buffered_data.substr(line_start, line_end - line_start), ++line_number, obj_data);
+                line_start = line_end + 1;
+            }
+
+            // The final line of the stream may not end with a newline
+            if (!obj_stream) {
+                if (line_start < buffered_size)
+                    parseObjLine(buffered_data.substr(line_start), ++line_number, obj_data);
+                break;
+            }
+
+            std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(line_start),
+                      buffer.begin() + static_cast<std::ptrdiff_t>(buffered_size),
+                      buffer.begin());
+            buffered_size -= line_start;
+        }
+
+        return obj_data;
+    }
+
+    // OBJ File Parser
+    ObjData parseObjFile(const std::filesystem::path& obj_file_path)
+    {
+        std::ifstream obj_file{ obj_file_path, std::ios_base::binary };
+        if (!obj_file)
+            throw std::invalid_argument{ std::format("Unable to open OBJ file \"{}\".", obj_file_path.string()) };
+
+        return parseObjStream(obj_file);
+    }
+
+    // OBJ Statement Parser
+    void parseObjLine(std::string_view line, const size_t line_number, ObjData& obj_data)
+    {
+        const auto is_whitespace{ [](const char c) { return c == ' ' || c == '\t' || c == '\r'; } };
+        const auto next_token{ [&]() {
+            const auto token_start{ std::find_if_not(line.begin(), line.end(), is_whitespace) };
+            const auto token_end{ std::find_if(token_start, line.end(), is_whitespace) };
+            const std::string_view token{ token_start, token_end };
+            line = std::string_view{ token_end, line.end() };
+            return token;
+        } };
+        const auto throw_invalid_statement{ [&](const std::string_view statement_type) {
+            throw std::invalid_argument{
+                    std::format("Invalid {} on line {} of OBJ data.", statement_type, line_number) };
+        } };
+
+        // Reads the next three coordinates of a vertex position or normal
+        const auto parse_coordinates{ [&](const std::string_view statement_type) {
+            std::array<double, 3> coordinates{ };
+            for (double& coordinate : coordinates) {
+                const std::string_view token{ next_token() };
+                const auto [ end_ptr, error_code ] {
+                        std::from_chars(token.data(), token.data() + token.size(), coordinate) };
+                if (token.empty() || error_code != std::errc{ } || end_ptr != token.data() + token.size())
+                    throw_invalid_statement(statement_type);
+            }
+            return coordinates;
+        } };
+
+        // Converts a one-based or negative relative index into a zero-based index into a list of the passed-in size
+        const auto resolve_index{ [&](const std::string_view index_str, const size_t element_count) {
+            int64_t index{ 0 };
+            const auto [ end_ptr, error_code ] { std::from_chars(index_str.data(),
+                                                                 index_str.data() + index_str.size(),
+                                                                 index) };
+            if (index_str.empty() || error_code != std::errc{ } || end_ptr != index_str.data() + index_str.size())
+                throw_invalid_statement("face");
+
+            const int64_t resolved_index{ index < 0 ? static_cast<int64_t>(element_count) + index : index - 1 };
+            if (index == 0 || resolved_index < 0 || resolved_index >= static_cast<int64_t>(element_count))
+                throw_invalid_statement("face");
+
+            return static_cast<uint32_t>(resolved_index);
+        } };
+
+        // Reads a face corner of the form v, v/vt, v//vn, or v/vt/vn, ignoring any texture coordinate index
+        const auto parse_corner{ [&](const std::string_view corner_str) {
+            const size_t first_slash{ corner_str.find('/') };
+            ObjCorner corner{ resolve_index(corner_str.substr(0, first_slash), obj_data.vertices.size()) };
+            if (first_slash != std::string_view::npos) {
+                const size_t second_slash{ corner_str.find('/', first_slash + 1) };
+                if (second_slash != std::string_view::npos)
+                    corner.normal_index = resolve_index(corner_str.substr(second_slash + 1), obj_data.normals.size());
+            }
+            return corner;
+        } };
+
+        const std::string_view statement{ next_token() };
+        if (statement.empty() || statement.front() == '#') {
+            return;
+        } else if (statement == "v") {
+            const auto [ x, y, z ] { parse_coordinates("vertex") };
+            obj_data.vertices.push_back(gfx::createPoint(x, y, z));
+        } else if (statement == "vn") {
+            const auto [ x, y, z ] { parse_coordinates("vertex normal") };
+            obj_data.normals.push_back(gfx::createVector(x, y, z));
+        } else if (statement == "f") {
+            // Triangulate the polygon into a fan around its first corner as each corner is read
+            const ObjCorner first_corner{ parse_corner(next_token()) };
+            ObjCorner previous_corner{ parse_corner(next_token()) };
+            size_t triangle_count{ 0 };
+            for (std::string_view corner_str = next_token(); !corner_str.empty(); corner_str = next_token()) {
+                const ObjCorner corner{ parse_corner(corner_str) };
+                obj_data.triangle_corners.insert(obj_data.triangle_corners.end(),
+                                                 { first_corner, previous_corner, corner });
+                previous_corner = corner;
+                ++triangle_count;
+            }
+
+            if (triangle_count == 0)
+                throw_invalid_statement("face");
+
+            if (obj_data.groups.empty())
+                obj_data.groups.push_back(ObjGroup{ std::string{ OBJ_DEFAULT_GROUP_NAME } });
+            obj_data.groups.back().triangle_count += triangle_count;
+        } else if (statement == "g" || statement == "o") {
+            // Name the group using the remainder of the line, replacing the current group if it is still empty
+            const auto name_start{ std::find_if_not(line.begin(), line.end(), is_whitespace) };
+            const auto name_end{ std::find_if_not(line.rbegin(), std::make_reverse_iterator(name_start),
+                                                  is_whitespace).base() };
+            const std::string_view group_name{ name_start < name_end ? std::string_view{ name_start, name_end }
+                                                                     : OBJ_DEFAULT_GROUP_NAME };
+            if (!obj_data.groups.empty() && obj_data.groups.back().triangle_count == 0)
+                obj_data.groups.pop_back();
+            obj_data.groups.push_back(ObjGroup{ std::string{ group_name }, obj_data.getTriangleCount() });
+        } else {
+            ++obj_data.ignored_line_count;
+        }
+    }
+
+    // Triangle Mesh Builder (All Groups)
+    std::shared_ptr<const gfx::TriangleMeshData> createTriangleMeshData(const ObjData& obj_data)
+    {
+        const ObjGroup all_triangles{ std::string{ }, 0, obj_data.getTriangleCount() };
+        return createTriangleMeshData(obj_data, std::span<const ObjGroup>{ &all_triangles, 1 });
+    }
+
+    // Triangle Mesh Builder (Named Group)
+    std::shared_ptr<const gfx::TriangleMeshData> createTriangleMeshData(const ObjData& obj_data,
+                                                                        const std::string_view group_name)
+    {
+        std::vector<ObjGroup> named_groups{ };
+        std::copy_if(obj_data.groups.begin(), obj_data.groups.end(), std::back_inserter(named_groups),
+                     [&](const ObjGroup& group) { return group.name == group_name; });
+        if (named_groups.empty())
+            throw std::invalid_argument{ std::format("OBJ data does not contain a group named \"{}\".", group_name) };
+
+        return createTriangleMeshData(obj_data, named_groups);
+    }
+
+    // Triangle Mesh Builder (Group List)
+    std::shared_ptr<const gfx::TriangleMeshData> createTriangleMeshData(const ObjData& obj_data,
+                                                                        const std::span<const ObjGroup> groups)
+    {
+        // Vertex normals are only usable if every corner of the selected triangles has one
+        const auto has_normal{ [](const ObjCorner& corner) { return corner.normal_index != OBJ_NO_NORMAL; } };
+        bool has_vertex_normals{ true };
+        for (const ObjGroup& group : groups) {
+            const auto corners_begin{ obj_data.triangle_corners.begin() +
+                                      static_cast<std::ptrdiff_t>(3 * group.first_triangle) };
+            const auto corners_end{ corners_begin + static_cast<std::ptrdiff_t>(3 * group.triangle_count) };
+            has_vertex_normals = has_vertex_normals && std::all_of(corners_begin, corners_end, has_normal);
+        }
+
+        // Each distinct corner becomes a mesh vertex, which for smooth shaded meshes is each distinct pairing of a
+        // position with a normal. Flat shaded meshes only need to look up the position, so use a direct table.
+        constexpr uint32_t unassigned_index{ std::numeric_limits<uint32_t>::max() };
+        std::vector<uint32_t> position_mesh_indices(has_vertex_normals ? 0 : obj_data.vertices.size(),
+                                                    unassigned_index);
+        std::unordered_map<uint64_t, uint32_t> corner_mesh_indices{ };
+        const auto get_mesh_index{ [&](const ObjCorner& corner) -> uint32_t& {
+            if (!has_vertex_normals)
+                return position_mesh_indices[corner.vertex_index];
+
+            const uint64_t corner_key{ (static_cast<uint64_t>(corner.vertex_index) << 32) | corner.normal_index };
+            return corner_mesh_indices.try_emplace(corner_key, unassigned_index).first->second;
+        } };
+
+        std::vector<gfx::Vector4> vertices{ };
+        std::vector<gfx::Vector4> normals{ };
+        std::vector<uint32_t> indices{ };
+        for (const ObjGroup& group : groups) {
+            indices.reserve(indices.size() + 3 * group.triangle_count);
+            for (size_t i = 3 * group.first_triangle; i < 3 * (group.first_triangle + group.triangle_count); ++i) {
+                const ObjCorner& corner{ obj_data.triangle_corners[i] };
+                uint32_t& mesh_index{ get_mesh_index(corner) };
+                if (mesh_index == unassigned_index) {
+                    mesh_index = static_cast<uint32_t>(vertices.size());
+                    vertices.push_back(obj_data.vertices[corner.vertex_index]);
+                    if (has_vertex_normals)
+                        normals.push_back(obj_data.normals[corner.normal_index]);
+                }
+                indices.push_back(mesh_index);
+            }
+        }
+
+        if (has_vertex_normals && !indices.empty())
+            return std::make_shared<const gfx::TriangleMeshData>(std::move(vertices),
+                                                                 std::move(normals),
+                                                                 std::move(indices));
+        return std::make_shared<const gfx::TriangleMeshData>(std::move(vertices), std::move(indices));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "vector4.hpp"
+#include "triangle_mesh.hpp"
+
+namespace data {
+    // Number of bytes read from an OBJ stream at a time, lines are parsed from each chunk as it arrives
+    constexpr size_t OBJ_READ_CHUNK_SIZE{ 1 << 20 };
+
+    // Marks a face corner which does not reference a vertex normal
+    constexpr uint32_t OBJ_NO_NORMAL{ std::numeric_limits<uint32_t>::max() };
+
+    // A corner of a face, referencing a vertex and optionally a vertex normal by their zero-based indices
+    struct ObjCorner {
+        uint32_t vertex_index{ 0 };
+        uint32_t normal_index{ OBJ_NO_NORMAL };
+
+        bool operator==(const ObjCorner& rhs) const = default;
+    };
+
+    // Name of the group holding any triangles defined before the first group statement
+    constexpr std::string_view OBJ_DEFAULT_GROUP_NAME{ "default" };
+
+    // A named range of triangles, started by a "g" or "o" statement
+    struct ObjGroup {
+        std::string name{ };
+        size_t first_triangle{ 0 };
+        size_t triangle_count{ 0 };
+    };
+
+    // Geometry read from a Wavefront OBJ file, with every polygon triangulated into a fan around its first corner
+    struct ObjData {
+        std::vector<gfx::Vector4> vertices{ };
+        std::vector<gfx::Vector4> normals{ };
+        std::vector<ObjCorner> triangle_corners{ };     // Three consecutive corners per triangle
+        std::vector<ObjGroup> groups{ };
+        size_t ignored_line_count{ 0 };                 // Statements which are not supported, such as texture data
+
+        [[nodiscard]] size_t getTriangleCount() const
+        { return triangle_corners.size() / 3; }
+    };
+
+    /* Wavefront OBJ Functions */
+
+    // Reads OBJ data from a stream in chunks of the passed-in size, so that the whole file is never held in memory.
+    // Vertex positions, vertex normals, faces, and groups are read, while other statements are ignored.
+    [[nodiscard]] ObjData parseObjStream(std::istream& obj_stream, size_t chunk_size = OBJ_READ_CHUNK_SIZE);
+
+    // Reads the OBJ file at the passed-in path
+    [[nodiscard]] ObjData parseObjFile(const std::filesystem::path& obj_file_path);
+
+    // Parses a single line of OBJ data, adding its contents to the passed-in data. The line number is only used to
+    // describe the location of invalid statements.
+    void parseObjLine(std::string_view line, size_t line_number, ObjData& obj_data);
+
+    // Builds triangle mesh data from the triangles of every group in the OBJ data. Vertex normals are only kept if
+    // every face corner references one, otherwise the mesh is flat shaded.
+    [[nodiscard]] std::shared_ptr<const gfx::TriangleMeshData> createTriangleMeshData(const ObjData& obj_data);
+
+    // Builds triangle mesh data from the triangles of every group with the passed-in name in the OBJ data
+    [[nodiscard]] std::shared_ptr<const gfx::TriangleMeshData> createTriangleMeshData(const ObjData& obj_data,
+                                                                                      std::string_view group_name);
+
+    // Builds triangle mesh data from the triangles within the passed-in groups of the OBJ data, keeping only the
+    // vertices referenced by those triangles
+    [[nodiscard]] std::shared_ptr<const gfx::TriangleMeshData> createTriangleMeshData(const ObjData& obj_data,
+                                                                                      std::span<const ObjGroup> groups);
+}
@@ -0,0 +1,216 @@
+#include "gtest/gtest.h"
+#include "obj_parser.hpp"
+
+#include <algorithm>
+#include <format>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// Tests ignoring unrecognized statements, comments, and blank lines
+TEST(RayTracerObjParser, IgnoreUnrecognizedLines)
+{
+    std::istringstream obj_stream{ "There was a young lady named Bright\n"
+                                   "who traveled much faster than light.\n"
+                                   "\n"
+                                   "# She set out one day\n"
+                                   "vt 0.5 0.5\n"
+                                   "usemtl in_a_relative_way\n" };
+
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    EXPECT_EQ(obj_data.ignored_line_count, 4);
+    EXPECT_TRUE(obj_data.vertices.empty());
+    EXPECT_EQ(obj_data.getTriangleCount(), 0);
+}
+
+// Tests reading vertex positions and normals
+TEST(RayTracerObjParser, ParseVertexData)
+{
+    std::istringstream obj_stream{ "v -1 1 0\n"
+                                   "v -1.0000 0.5000 0.0000\n"
+                                   "v 1 0 0 1.0\n"
+                                   "vn 0 0 1\r\n"
+                                   "vn 0.707 0 -0.707" };
+
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    ASSERT_EQ(obj_data.vertices.size(), 3);
+    EXPECT_EQ(obj_data.vertices[0], gfx::createPoint(-1, 1, 0));
+    EXPECT_EQ(obj_data.vertices[1], gfx::createPoint(-1, 0.5, 0));
+    EXPECT_EQ(obj_data.vertices[2], gfx::createPoint(1, 0, 0));
+    ASSERT_EQ(obj_data.normals.size(), 2);
+    EXPECT_EQ(obj_data.normals[0], gfx::createVector(0, 0, 1));
+    EXPECT_EQ(obj_data.normals[1], gfx::createVector(0.707, 0, -0.707));
+}
+
+// Tests reading faces and triangulating polygons into fans
+TEST(RayTracerObjParser, ParseFaceData)
+{
+    std::istringstream obj_stream{ "v -1 1 0\n"
+                                   "v -1 0 0\n"
+                                   "v 1 0 0\n"
+                                   "v 1 1 0\n"
+                                   "v 0 2 0\n"
+                                   "f 1 2 3\n"
+                                   "f 1/1 2/2 3/3 4/4 -1\n" };
+
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    const std::vector<data::ObjCorner> corners_expected{ { 0 }, { 1 }, { 2 },
+                                                         { 0 }, { 1 }, { 2 },
+                                                         { 0 }, { 2 }, { 3 },
+                                                         { 0 }, { 3 }, { 4 } };
+    EXPECT_EQ(obj_data.getTriangleCount(), 4);
+    EXPECT_EQ(obj_data.triangle_corners, corners_expected);
+    ASSERT_EQ(obj_data.groups.size(), 1);
+    EXPECT_EQ(obj_data.groups[0].name, data::OBJ_DEFAULT_GROUP_NAME);
+    EXPECT_EQ(obj_data.groups[0].triangle_count, 4);
+}
+
+// Tests reading faces which reference vertex normals
+TEST(RayTracerObjParser, ParseFaceNormalData)
+{
+    std::istringstream obj_stream{ "v 0 1 0\n"
+                                   "v -1 0 0\n"
+                                   "v 1 0 0\n"
+                                   "vn -1 0 0\n"
+                                   "vn 1 0 0\n"
+                                   "vn 0 1 0\n"
+                                   "f 1//3 2//1 3//2\n"
+                                   "f 1/0/3 2/102/1 3/14/2\n" };
+
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    const std::vector<data::ObjCorner> corners_expected{ { 0, 2 }, { 1, 0 }, { 2, 1 },
+                                                         { 0, 2 }, { 1, 0 }, { 2, 1 } };
+    EXPECT_EQ(obj_data.triangle_corners, corners_expected);
+}
+
+// Tests reading named groups of triangles
+TEST(RayTracerObjParser, ParseGroupData)
+{
+    std::istringstream obj_stream{ "v -1 1 0\n"
+                                   "v -1 0 0\n"
+                                   "v 1 0 0\n"
+                                   "v 1 1 0\n"
+                                   "g Unused\n"
+                                   "g FirstGroup\n"
+                                   "f 1 2 3\n"
+                                   "o Second Group \n"
+                                   "f 1 3 4\n" };
+
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    ASSERT_EQ(obj_data.groups.size(), 2);
+    EXPECT_EQ(obj_data.groups[0].name, "FirstGroup");
+    EXPECT_EQ(obj_data.groups[0].first_triangle, 0);
+    EXPECT_EQ(obj_data.groups[0].triangle_count, 1);
+    EXPECT_EQ(obj_data.groups[1].name, "Second Group");
+    EXPECT_EQ(obj_data.groups[1].first_triangle, 1);
+    EXPECT_EQ(obj_data.groups[1].triangle_count, 1);
+}
+
+// Tests that reading the stream in small chunks produces the same data as reading it whole
+TEST(RayTracerObjParser, ParseObjStreamChunks)
+{
+    std::string obj_text{ };
+    for (int i = 0; i < 50; ++i) {
+        obj_text += std::format("v {} {}.125 -{}.5\n", i, i, i);
+    }
+    for (int i = 3; i <= 50; ++i) {
+        obj_text += std::format("f 1 {} {}\n", i - 1, i);
+    }
+
+    std::istringstream obj_stream_whole{ obj_text };
+    const data::ObjData obj_data_expected{ data::parseObjStream(obj_stream_whole) };
+
+    // Chunks shorter than a line force lines to span several reads
+    for (const size_t chunk_size : { 1, 7, 64 }) {
+        std::istringstream obj_stream_chunked{ obj_text };
+        const data::ObjData obj_data_actual{ data::parseObjStream(obj_stream_chunked, chunk_size) };
+        EXPECT_EQ(obj_data_actual.vertices, obj_data_expected.vertices);
+        EXPECT_EQ(obj_data_actual.triangle_corners, obj_data_expected.triangle_corners);
+    }
+    EXPECT_EQ(obj_data_expected.vertices.size(), 50);
+    EXPECT_EQ(obj_data_expected.getTriangleCount(), 48);
+}
+
+// Tests that invalid statements throw an exception
+TEST(RayTracerObjParser, ParseInvalidObjData)
+{
+    const auto parse_obj_text{ [](const std::string& obj_text) {
+        std::istringstream obj_stream{ obj_text };
+        return data::parseObjStream(obj_stream);
+    } };
+
+    // Test a vertex with a missing coordinate
+    EXPECT_THROW(static_cast<void>(parse_obj_text("v 1 2\n")), std::invalid_argument);
+
+    // Test a vertex with an invalid coordinate
+    EXPECT_THROW(static_cast<void>(parse_obj_text("v 1 two 3\n")), std::invalid_argument);
+
+    // Test a face referencing a vertex which has not been defined
+    EXPECT_THROW(static_cast<void>(parse_obj_text("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n")), std::invalid_argument);
+
+    // Test a face with fewer than three corners
+    EXPECT_THROW(static_cast<void>(parse_obj_text("v 0 0 0\nv 1 0 0\nf 1 2\n")), std::invalid_argument);
+
+    // Test a face referencing a vertex normal which has not been defined
+    EXPECT_THROW(static_cast<void>(parse_obj_text("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1//1 2//1 3//1\n")),
+                 std::invalid_argument);
+}
+
+// Tests building triangle mesh data from OBJ data
+TEST(RayTracerObjParser, CreateTriangleMeshData)
+{
+    std::istringstream obj_stream{ "v -1 1 0\n"
+                                   "v -1 0 0\n"
+                                   "v 1 0 0\n"
+                                   "v 1 1 0\n"
+                                   "v 5 5 5\n"
+                                   "g Left\n"
+                                   "f 1 2 3\n"
+                                   "g Right\n"
+                                   "f 1 3 4\n" };
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    // Test building a mesh from every group, which only keeps the vertices referenced by a face
+    const auto mesh_data{ data::createTriangleMeshData(obj_data) };
+    const std::vector<uint32_t> indices_expected{ 0, 1, 2, 0, 2, 3 };
+    EXPECT_EQ(mesh_data->getVertexCount(), 4);
+    EXPECT_TRUE(std::ranges::equal(mesh_data->getIndices(), indices_expected));
+    EXPECT_FALSE(mesh_data->hasVertexNormals());
+
+    // Test building a mesh from a single group
+    const auto group_mesh_data{ data::createTriangleMeshData(obj_data, "Right") };
+    const std::vector<gfx::Vector4> group_vertices_expected{ gfx::createPoint(-1, 1, 0),
+                                                             gfx::createPoint(1, 0, 0),
+                                                             gfx::createPoint(1, 1, 0) };
+    EXPECT_EQ(group_mesh_data->getTriangleCount(), 1);
+    EXPECT_TRUE(std::ranges::equal(group_mesh_data->getVertices(), group_vertices_expected));
+
+    // Test building a mesh from a group which does not exist
+    EXPECT_THROW(static_cast<void>(data::createTriangleMeshData(obj_data, "Missing")), std::invalid_argument);
+}
+
+// Tests building smooth shaded triangle mesh data, splitting vertices which are paired with different normals
+TEST(RayTracerObjParser, CreateTriangleMeshDataNormals)
+{
+    std::istringstream obj_stream{ "v 0 1 0\n"
+                                   "v -1 0 0\n"
+                                   "v 1 0 0\n"
+                                   "v 0 0 1\n"
+                                   "vn 0 0 -1\n"
+                                   "vn 0 1 0\n"
+                                   "f 1//1 2//1 3//1\n"
+                                   "f 1//2 3//2 4//2\n" };
+    const data::ObjData obj_data{ data::parseObjStream(obj_stream) };
+
+    const auto mesh_data{ data::createTriangleMeshData(obj_data) };
+
+    EXPECT_TRUE(mesh_data->hasVertexNormals());
+    EXPECT_EQ(mesh_data->getVertexCount(), 6);
+    EXPECT_EQ(mesh_data->getNormals()[0], gfx::createVector(0, 0, -1));
+    EXPECT_EQ(mesh_data->getNormals()[5], gfx::createVector(0, 1, 0));
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "parse.hpp"
 
+#include <filesystem>
 #include <string_view>
 #include <unordered_map>
 
@@ -9,6 +10,8 @@
 #include "cube.hpp"
 #include "cylinder.hpp"
 #include "cone.hpp"
+#include "obj_parser.hpp"
+#include "mesh_cache.hpp"
 
 #include "gradient_texture_3d.hpp"
 #include "stripe_pattern_3d.hpp"
@@ -38,6 +41,9 @@ namespace data {
             world.addObject(parseObjectData(object_data));
         }
 
+        // Build the acceleration structure now that the world contains every object
+        world.finalize();
+
         // Get the camera data
         const json& camera_data{ scene_data["camera"] };
         const std::vector<double> input_base_vals{ camera_data["transform"]["input_base"].get<std::vector<double>>() };
@@ -74,6 +80,11 @@ namespace data {
             return parseCompositeSurfaceData(object_data);
         }
 
+        // Load triangle meshes from their OBJ files
+        if (shape_type_str == "mesh") {
+            return parseMeshData(object_data);
+        }
+
         // Define string-to-case mapping for possible shape primitives
         enum class Cases { Plane, Sphere, Cube, Cylinder, Cone };
         static const std::unordered_map<std::string_view, Cases> stringToCaseMap{
@@ -149,9 +160,55 @@ namespace data {
         for (const auto& child_data: child_data_list) {
             composite_surface_ptr->addChild(parseObjectData(child_data));
         }
+
+        // Organize the children into a bounding volume hierarchy, using the leaf size from the scene if specified
+        const size_t bvh_leaf_size{ composite_surface_data.contains("bvh_leaf_size") ?
+                                    composite_surface_data["bvh_leaf_size"].get<size_t>() :
+                                    gfx::DEFAULT_BVH_MAX_LEAF_SIZE };
+        composite_surface_ptr->divide(bvh_leaf_size);
+
         return composite_surface_ptr;
     }
 
+    // Triangle Mesh Loader
+    std::shared_ptr<gfx::TriangleMesh> parseMeshData(const json& mesh_data)
+    {
+        if (!mesh_data.contains("file"))
+            throw std::invalid_argument("Mesh must contain the path of an OBJ or mesh cache file (as file)");
+
+        // Build the transform matrix, if present
+        gfx::Matrix4 transform_matrix{ gfx::createIdentityMatrix() };
+        if (mesh_data.contains("transform"))
+            transform_matrix = buildChained3DTransformMatrix(mesh_data["transform"]);
+
+        // Extract the material data, if present
+        gfx::Material material{ };
+        if (mesh_data.contains("material"))
+            material = parseMaterialData(mesh_data["material"]);
+
+        // Map preprocessed mesh caches directly, skipping the checksum only if the scene explicitly trusts the file
+        const std::filesystem::path mesh_file_path{ mesh_data["file"].get<std::string>() };
+        if (mesh_file_path.extension() == MESH_CACHE_EXTENSION) {
+            if (mesh_data.contains("group"))
+                throw std::invalid_argument("Mesh groups can only be selected from OBJ files");
+
+            const bool verify_checksum{ !mesh_data.contains("verify_checksum") ||
+                                        mesh_data["verify_checksum"].get<bool>() };
+            return std::make_shared<gfx::TriangleMesh>(
+                    transform_matrix, material,
+                    loadMeshCache(mesh_file_path, verify_checksum ? MeshCacheValidation::Checksum
+                                                                  : MeshCacheValidation::Header));
+        }
+
+        // Otherwise read the OBJ geometry, keeping only the requested group if one is named
+        const ObjData obj_data{ parseObjFile(mesh_file_path) };
+        const auto triangle_mesh_data{ mesh_data.contains("group") ?
+                                       createTriangleMeshData(obj_data, mesh_data["group"].get<std::string_view>()) :
+                                       createTriangleMeshData(obj_data) };
+
+        return std::make_shared<gfx::TriangleMesh>(transform_matrix, material, triangle_mesh_data);
+    }
+
     // Material Data Parser
     gfx::Material parseMaterialData(const json& material_data)
     {
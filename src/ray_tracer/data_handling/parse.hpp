@@ -12,6 +12,7 @@
 #include "matrix4.hpp"
 
 #include "composite_surface.hpp"
+#include "triangle_mesh.hpp"
 
 using json = nlohmann::json;
 
@@ -33,6 +34,12 @@ namespace data {
     // Returns a pointer to a newly created composite surface described by the passed-in JSON data
     [[nodiscard]] std::shared_ptr<gfx::CompositeSurface> parseCompositeSurfaceData(const json& composite_surface_data);
 
+    // Returns a pointer to a newly created triangle mesh loaded from the OBJ file described by the passed-in JSON
+    // data, optionally limited to a single named group of the file. Files with the mesh cache extension are mapped
+    // into memory instead, verifying their checksums unless "verify_checksum" is false. Relative file paths are
+    // resolved against the working directory.
+    [[nodiscard]] std::shared_ptr<gfx::TriangleMesh> parseMeshData(const json& mesh_data);
+
     // Returns a newly constructed material based on the passed in material data
     [[nodiscard]] gfx::Material parseMaterialData(const json& material_data);
 
@@ -2,6 +2,8 @@
 #include "parse.hpp"
 
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 
 #include <nlohmann/json.hpp>
 
@@ -445,6 +447,40 @@ TEST(RayTracerParse, ParseConeData)
     EXPECT_EQ(cone_actual, cone_expected);
 }
 
+// Tests creating a triangle mesh from parsed JSON data referencing an OBJ file
+TEST(RayTracerParse, ParseMeshData)
+{
+    const std::filesystem::path obj_file_path{ std::filesystem::temp_directory_path() / "parse_mesh_data.obj" };
+    {
+        std::ofstream obj_file{ obj_file_path };
+        obj_file << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                    "g Lower\nf 1 2 3\n"
+                    "g Upper\nf 1 3 4\n";
+    }
+
+    const json mesh_data{
+            { "shape", "mesh" },
+            { "file", obj_file_path.string() },
+            { "group", "Upper" },
+            { "transform", json::array({
+                { { "type", "translate" }, { "values", json::array({ 0, 0, 2 }) } }
+            })},
+            { "material", {
+                { "color", json::array({ 1, 1, 0.5 }) }
+            } }
+    };
+
+    const gfx::TriangleMesh mesh_actual{ dynamic_cast<const gfx::TriangleMesh&>(*data::parseObjectData(mesh_data)) };
+    EXPECT_EQ(mesh_actual.getTransform(), gfx::createTranslationMatrix(0, 0, 2));
+    EXPECT_EQ(mesh_actual.getMaterial(), (gfx::Material{ gfx::Color{ 1, 1, 0.5 } }));
+    EXPECT_EQ(mesh_actual.getTriangleCount(), 1);
+
+    // Test a mesh without an OBJ file path
+    EXPECT_THROW({ const auto mesh{ data::parseObjectData(json{ { "shape", "mesh" } }) }; }, std::invalid_argument);
+
+    std::filesystem::remove(obj_file_path);
+}
+
 // Tests building a composite surface from parsed JSON data
 TEST(RayTracerParse, BuildCompositeSurface)
 {
@@ -484,4 +520,35 @@ TEST(RayTracerParse, BuildCompositeSurface)
 
     const auto composite_surface_actual_ptr{ data::parseCompositeSurfaceData(composite_surface_data)};
     EXPECT_EQ(*composite_surface_actual_ptr, composite_surface_expected);
+}
+
+// Tests that parsed composite surfaces are divided using the leaf size from the JSON data
+TEST(RayTracerParse, BuildCompositeSurfaceLeafSize)
+{
+    json child_data_list = json::array();
+    for (int i = 0; i < 8; ++i) {
+        const json child_data{
+            { "shape", "sphere" },
+            { "transform", json::array({
+                { { "type", "translate" }, { "values", json::array({ 3 * i, 0, 0 }) } }
+            }) }
+        };
+        child_data_list.push_back(child_data);
+    }
+    const json composite_surface_data{
+            { "shape", "composite_surface" },
+            { "bvh_leaf_size", 1 },
+            { "children", child_data_list }
+    };
+
+    const auto composite_surface_ptr{ data::parseCompositeSurfaceData(composite_surface_data) };
+    ASSERT_TRUE(composite_surface_ptr->isDivided());
+
+    const gfx::BoundingVolumeHierarchy& bvh{ composite_surface_ptr->getBoundingVolumeHierarchy() };
+    EXPECT_EQ(bvh.getPrimitiveCount(), 8);
+    for (const gfx::BoundingVolumeHierarchy::WideNode& node : bvh.getWideNodes()) {
+        for (size_t lane = 0; lane < node.child_count; ++lane) {
+            EXPECT_LE(node.child_primitive_counts[lane], 1);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "benchmark/benchmark.h"
+#include "camera.hpp"
+
+#include <numbers>
+
+#include "transform.hpp"
+
+// Benchmarks casting a ray through every pixel of a transformed camera's viewport
+static void BM_CameraCastRay(benchmark::State& state)
+{
+    const rt::Camera camera{ 160, 120, std::numbers::pi / 3,
+                             gfx::createViewTransformMatrix(gfx::createPoint(0, 1.5, -5),
+                                                            gfx::createPoint(0, 1, 0),
+                                                            gfx::createVector(0, 1, 0)) };
+    for (auto _ : state) {
+        for (size_t y = 0; y < camera.getViewportHeight(); ++y)
+            for (size_t x = 0; x < camera.getViewportWidth(); ++x) {
+                benchmark::DoNotOptimize(camera.castRay(x, y));
+            }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(camera.getViewportWidth() * camera.getViewportHeight()));
+    state.SetLabel(gfx::simd::KERNEL_INSTRUCTION_SET);
+}
+BENCHMARK(BM_CameraCastRay);
\ No newline at end of file
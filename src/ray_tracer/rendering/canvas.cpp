@@ -2,6 +2,7 @@
 
 #include <sstream>
 #include <array>
+#include <charconv>
 
 #include "util_functions.hpp"
 
@@ -9,49 +10,74 @@ namespace rt {
     std::string exportAsPPM(const Canvas& canvas)
     {
         std::ostringstream ppm_data;
+        writePPM(ppm_data, canvas, PPMFormat::Plain);
+        return ppm_data.str();
+    }
 
+    void writePPM(std::ostream& output, const Canvas& canvas, const PPMFormat format)
+    {
         // Create the PPM header
-        ppm_data << PPM_IDENTIFIER << '\n';
-        ppm_data << canvas.width() << ' ' << canvas.height() << '\n';
-        ppm_data << PPM_MAX_COLOR_VALUE << '\n';
-
-        // Write the pixel data to the string
-        unsigned int row_char_count = 0;
-        for (int row = 0; row < canvas.height(); ++row) {
-            for (int col = 0; col < canvas.width(); ++col) {
-
-                // Scale the RGB values and convert to strings, storing in an array for iteration
-                const gfx::Color pixel = canvas[col, row];
-                std::array<std::string, 3> color_value_strs{
-                        std::to_string(utils::clampedScale(pixel.r(), 0, PPM_MAX_COLOR_VALUE)),
-                        std::to_string(utils::clampedScale(pixel.g(), 0, PPM_MAX_COLOR_VALUE)),
-                        std::to_string(utils::clampedScale(pixel.b(), 0, PPM_MAX_COLOR_VALUE)) };
-
-                // Output each scaled value to the string
-                for (const std::string& str: color_value_strs) {
-                    // Wrap the line if the length of the data + a space will exceed PPM_MAX_LINE_LEN
-                    size_t str_len = str.length();
-                    if (row_char_count + str_len + 1 > PPM_MAX_LINE_LEN) {
-                        ppm_data << '\n';
-                        row_char_count = 0;
-                    }
-                    // Otherwise put a space (unless data is first value in row)
-                    else if (row_char_count > 0) {
-                        ppm_data << ' ';
-                        ++row_char_count;
-                    }
-
-                    // Output the color data to the string
-                    ppm_data << str;
-                    row_char_count += str_len;
-                }
+        output << (format == PPMFormat::Binary ? PPM_BINARY_IDENTIFIER : PPM_IDENTIFIER) << '\n';
+        output << canvas.width() << ' ' << canvas.height() << '\n';
+        output << PPM_MAX_COLOR_VALUE << '\n';
+
+        // Encode and write the pixel data a row at a time, reusing the same buffer for every row
+        std::string row_data{ };
+        for (size_t row = 0; row < canvas.height(); ++row) {
+            row_data.clear();
+            appendPPMRow(row_data, canvas, row, format);
+            output.write(row_data.data(), static_cast<std::streamsize>(row_data.size()));
+        }
+    }
+
+    void appendPPMRow(std::string& buffer, const Canvas& canvas, const size_t row, const PPMFormat format)
+    {
+        if (format == PPMFormat::Binary) {
+            // Output each scaled value as a single byte, with no separators
+            for (size_t col = 0; col < canvas.width(); ++col) {
+                const gfx::Color& pixel{ canvas[col, row] };
+                buffer.push_back(static_cast<char>(utils::clampedScale(pixel.r(), 0, PPM_MAX_COLOR_VALUE)));
+                buffer.push_back(static_cast<char>(utils::clampedScale(pixel.g(), 0, PPM_MAX_COLOR_VALUE)));
+                buffer.push_back(static_cast<char>(utils::clampedScale(pixel.b(), 0, PPM_MAX_COLOR_VALUE)));
             }
+            return;
+        }
+
+        size_t row_char_count{ 0 };
+        for (size_t col = 0; col < canvas.width(); ++col) {
+            // Scale the RGB values, storing in an array for iteration
+            const gfx::Color& pixel{ canvas[col, row] };
+            const std::array<int, 3> color_values{
+                    utils::clampedScale(pixel.r(), 0, PPM_MAX_COLOR_VALUE),
+                    utils::clampedScale(pixel.g(), 0, PPM_MAX_COLOR_VALUE),
+                    utils::clampedScale(pixel.b(), 0, PPM_MAX_COLOR_VALUE) };
+
+            // Output each scaled value to the buffer
+            for (const int color_value : color_values) {
+                // Convert the value in place, since a channel never exceeds three digits
+                std::array<char, 3> value_chars{ };
+                const char* value_end{
+                    std::to_chars(value_chars.data(), value_chars.data() + value_chars.size(), color_value).ptr };
+                const auto value_len{ static_cast<size_t>(value_end - value_chars.data()) };
+
+                // Wrap the line if the length of the data + a space will exceed PPM_MAX_LINE_LEN
+                if (row_char_count + value_len + 1 > PPM_MAX_LINE_LEN) {
+                    buffer.push_back('\n');
+                    row_char_count = 0;
+                }
+                // Otherwise put a space (unless data is first value in row)
+                else if (row_char_count > 0) {
+                    buffer.push_back(' ');
+                    ++row_char_count;
+                }
 
-            // Start a new row once all the pixel data for this canvas row is output
-            ppm_data << '\n';
-            row_char_count = 0;
+                // Output the color data to the buffer
+                buffer.append(value_chars.data(), value_len);
+                row_char_count += value_len;
+            }
         }
 
-        return ppm_data.str();
+        // Start a new row once all the pixel data for this canvas row is output
+        buffer.push_back('\n');
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <mdspan>
+#include <ostream>
 #include <string>
 
 #include "color.hpp"
@@ -9,6 +10,7 @@
 namespace rt
 {
     constexpr std::string_view PPM_IDENTIFIER{ "P3" };
+    constexpr std::string_view PPM_BINARY_IDENTIFIER{ "P6" };
     constexpr int PPM_MAX_COLOR_VALUE{ 255 };
     constexpr int PPM_MAX_LINE_LEN{ 70 };
 
@@ -69,8 +71,22 @@ namespace rt
         > m_grid;
     };
 
+    // Encodings of the PPM pixel data
+    enum class PPMFormat {
+        Plain,  // P3, whitespace-separated ASCII values wrapped at PPM_MAX_LINE_LEN characters
+        Binary  // P6, one byte per color channel
+    };
+
     /* Canvas Export Methods */
 
     // Returns a string containing the canvas color data in PPM format
     std::string exportAsPPM(const Canvas& canvas);
+
+    // Writes the canvas color data to an output stream in PPM format, encoding one row at a time so that the
+    // memory used does not grow with the size of the image
+    void writePPM(std::ostream& output, const Canvas& canvas, PPMFormat format = PPMFormat::Plain);
+
+    // Appends the encoded color data of a single canvas row, including its trailing newline for the plain format,
+    // to the passed-in buffer
+    void appendPPMRow(std::string& buffer, const Canvas& canvas, size_t row, PPMFormat format);
 }
\ No newline at end of file
@@ -188,4 +188,39 @@ TEST(RayTracerCanvas, ExportPPMLargerCanvas)
     EXPECT_TRUE(ppm_string.at(ppm_string.length() - 1) == '\n');
 }
 
+// Tests streaming a canvas to the binary PPM format
+TEST(RayTracerCanvas, WritePPMBinary)
+{
+    constexpr size_t width = 3;
+    constexpr size_t height = 2;
+    const rt::Canvas canvas{ width, height };
+
+    // Set the test colors
+    canvas[0, 0] = gfx::Color{ 1.5, 0, 0 };
+    canvas[1, 0] = gfx::Color{ 0, 0.5, 0 };
+    canvas[2, 1] = gfx::Color{ -0.5, 0, 1 };
+
+    std::ostringstream ppm_stream{ };
+    rt::writePPM(ppm_stream, canvas, rt::PPMFormat::Binary);
+    const std::string ppm_string{ ppm_stream.str() };
+
+    // Test that the header is correctly output, followed by three bytes per pixel in row-major order
+    const std::string exp_header{ "P6\n3 2\n255\n" };
+    const std::string exp_pixel_data{ '\xFF', '\x00', '\x00', '\x00', '\x80', '\x00', '\x00', '\x00', '\x00',
+                                      '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\xFF' };
+
+    EXPECT_EQ(ppm_string, exp_header + exp_pixel_data);
+}
+
+// Tests that streaming a canvas to the plain PPM format matches the exported string
+TEST(RayTracerCanvas, WritePPMPlain)
+{
+    const rt::Canvas canvas{ 10, 2, gfx::Color{ 1, 0.8, 0.6 } };
+
+    std::ostringstream ppm_stream{ };
+    rt::writePPM(ppm_stream, canvas);
+
+    EXPECT_EQ(ppm_stream.str(), rt::exportAsPPM(canvas));
+}
+
 #pragma clang diagnostic pop
\ No newline at end of file
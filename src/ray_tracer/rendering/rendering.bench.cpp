@@ -0,0 +1,82 @@
+#include "benchmark/benchmark.h"
+#include "rendering_functions.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "parse.hpp"
+#include "compiled_scene.hpp"
+
+// Benchmarks rendering a scene file from the input directory, using one thread per hardware core and tracing the
+// primary rays in packets of the benchmark argument's edge length
+static void BM_RenderScene(benchmark::State& state,
+                           const std::filesystem::path& scene_path,
+                           const rt::TracingMode tracing_mode)
+{
+    std::ifstream scene_file{ scene_path };
+    const json scene_data = json::parse(scene_file);
+    const Scene scene{ data::parseSceneData(scene_data) };
+    const rt::RenderSettings render_settings{ .thread_count = 0,
+                                              .packet_size = static_cast<size_t>(state.range(0)),
+                                              .tracing_mode = tracing_mode };
+
+    for (auto _ : state) {
+        const rt::Canvas image{ rt::render(scene.world, scene.camera, render_settings) };
+        benchmark::DoNotOptimize(image[0, 0]);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(scene.camera.getViewportWidth() * scene.camera.getViewportHeight()));
+}
+
+// Benchmarks compiling the world of a scene file into its render representation, which each render of a world does
+// once before tracing any rays
+static void BM_CompileScene(benchmark::State& state, const std::filesystem::path& scene_path)
+{
+    std::ifstream scene_file{ scene_path };
+    const json scene_data = json::parse(scene_file);
+    const Scene scene{ data::parseSceneData(scene_data) };
+
+    for (auto _ : state) {
+        const gfx::CompiledScene compiled_scene{ scene.world };
+        benchmark::DoNotOptimize(compiled_scene.getPrimitiveCount());
+    }
+}
+
+// Registers a render benchmark for each JSON scene in the input directory, so new scenes are measured automatically
+static const bool RENDER_BENCHMARKS_REGISTERED{ [] {
+    const std::filesystem::path input_directory{ RT_BENCHMARK_INPUT_DIR };
+    if (!std::filesystem::is_directory(input_directory))
+        return false;
+
+    // Sort the scenes by name, since directory iteration order is unspecified and results are compared across runs
+    std::vector<std::filesystem::path> scene_paths{ };
+    for (const auto& entry : std::filesystem::directory_iterator{ input_directory }) {
+        if (entry.path().extension() == ".json")
+            scene_paths.push_back(entry.path());
+    }
+    std::sort(scene_paths.begin(), scene_paths.end());
+
+    for (const std::filesystem::path& scene_path : scene_paths) {
+        benchmark::RegisterBenchmark(("BM_RenderScene/" + scene_path.stem().string()).c_str(),
+                                     BM_RenderScene, scene_path, rt::TracingMode::Recursive)
+                ->ArgName("packet_size")
+                ->Arg(1)
+                ->Arg(2)
+                ->Arg(4)
+                ->Unit(benchmark::kMillisecond)
+                ->UseRealTime();
+        benchmark::RegisterBenchmark(("BM_RenderSceneWavefront/" + scene_path.stem().string()).c_str(),
+                                     BM_RenderScene, scene_path, rt::TracingMode::Wavefront)
+                ->ArgName("packet_size")
+                ->Arg(1)
+                ->Unit(benchmark::kMillisecond)
+                ->UseRealTime();
+        benchmark::RegisterBenchmark(("BM_CompileScene/" + scene_path.stem().string()).c_str(),
+                                     BM_CompileScene, scene_path)
+                ->Unit(benchmark::kMicrosecond);
+    }
+    return true;
+}() };
\ No newline at end of file
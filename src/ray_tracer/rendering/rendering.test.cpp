@@ -1,13 +1,19 @@
 #include "gtest/gtest.h"
 #include "rendering_functions.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <vector>
 
 #include "color.hpp"
 #include "material.hpp"
 #include "sphere.hpp"
+#include "plane.hpp"
 #include "vector4.hpp"
 #include "transform.hpp"
+#include "tile_scheduler.hpp"
+#include "render_statistics.hpp"
 
 // Tests rendering a world to a canvas
 TEST(RayTracerRendering, RenderWorld)
@@ -34,4 +40,196 @@ TEST(RayTracerRendering, RenderWorld)
     const gfx::Color color_center_pixel_expected{ 0.380661, 0.475827, 0.285496 };
     const gfx::Color color_center_pixel_actual{ image[5, 5] };
     EXPECT_EQ(color_center_pixel_actual, color_center_pixel_expected);
+}
+
+// Tests that rendering a world in parallel tiles produces the same image as the serial renderer
+TEST(RayTracerRendering, RenderWorldParallel)
+{
+    const gfx::Material material{ 0.8, 1.0, 0.6,
+                                  gfx::MaterialProperties{ .diffuse = 0.7, .specular = 0.2 } };
+
+    gfx::Sphere sphere_a{ material };
+    gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5) };
+    const gfx::World world{ sphere_a, sphere_b };
+
+    const gfx::Matrix4 view_transform_matrix{
+            gfx::createViewTransformMatrix(
+                    gfx::createPoint(0, 0, -5),
+                    gfx::createPoint(0, 0, 0),
+                    gfx::createVector(0, 1, 0)) };
+    const rt::Camera camera{ 37, 23, M_PI_2, view_transform_matrix };
+
+    const rt::Canvas image_expected{ rt::render(world, camera) };
+    const rt::Canvas image_actual{ rt::render(world, camera, rt::RenderSettings{ .thread_count = 4,
+                                                                                 .tile_size = 8 }) };
+
+    // Images should be bit-identical, so compare the raw channel values rather than using the relative comparison
+    for (size_t y = 0; y < camera.getViewportHeight(); ++y)
+        for (size_t x = 0; x < camera.getViewportWidth(); ++x) {
+            const gfx::Color pixel_expected{ image_expected[x, y] };
+            const gfx::Color pixel_actual{ image_actual[x, y] };
+            EXPECT_EQ(pixel_actual.r(), pixel_expected.r());
+            EXPECT_EQ(pixel_actual.g(), pixel_expected.g());
+            EXPECT_EQ(pixel_actual.b(), pixel_expected.b());
+        }
+}
+
+// Tests that tracing the primary rays of pixel blocks as packets produces the same image as the serial renderer,
+// including blocks clipped by the edges of the tiles and the reflected and refracted rays traced after each hit
+TEST(RayTracerRendering, RenderWorldPackets)
+{
+    gfx::World world{ gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) } };
+    for (int x = -2; x <= 2; ++x) {
+        for (int z = 0; z <= 2; ++z) {
+            world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(x * 1.5, 0, z * 1.5) *
+                                         gfx::createScalingMatrix(0.6) });
+        }
+    }
+    const gfx::Material glass_material{ gfx::MaterialProperties{ .reflectivity = 0.5,
+                                                                 .transparency = 0.9,
+                                                                 .refractive_index = 1.5 } };
+    world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(0.75, 0.25, -2) * gfx::createScalingMatrix(0.5),
+                                 glass_material });
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0),
+                                gfx::Material{ gfx::MaterialProperties{ .reflectivity = 0.3 } } });
+    world.finalize();
+
+    const gfx::Matrix4 view_transform_matrix{
+            gfx::createViewTransformMatrix(
+                    gfx::createPoint(0, 1.5, -6),
+                    gfx::createPoint(0, 0, 0),
+                    gfx::createVector(0, 1, 0)) };
+    const rt::Camera camera{ 37, 23, M_PI_2, view_transform_matrix };
+
+    const rt::Canvas image_expected{ rt::render(world, camera) };
+    for (size_t packet_size = 1; packet_size <= rt::MAX_PACKET_SIZE; ++packet_size) {
+        const rt::Canvas image_actual{ rt::render(world, camera, rt::RenderSettings{ .thread_count = 2,
+                                                                                     .tile_size = 10,
+                                                                                     .packet_size = packet_size }) };
+
+        for (size_t y = 0; y < camera.getViewportHeight(); ++y)
+            for (size_t x = 0; x < camera.getViewportWidth(); ++x) {
+                const gfx::Color pixel_expected{ image_expected[x, y] };
+                const gfx::Color pixel_actual{ image_actual[x, y] };
+                EXPECT_EQ(pixel_actual.r(), pixel_expected.r());
+                EXPECT_EQ(pixel_actual.g(), pixel_expected.g());
+                EXPECT_EQ(pixel_actual.b(), pixel_expected.b());
+            }
+    }
+
+    EXPECT_THROW(static_cast<void>(rt::render(world, camera, rt::RenderSettings{ .packet_size = 0 })),
+                 std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(rt::render(world, camera, rt::RenderSettings{ .packet_size = 5 })),
+                 std::invalid_argument);
+}
+
+// Tests recording the cost of each pixel while rendering a world
+TEST(RayTracerRendering, RenderWorldHeatmap)
+{
+    gfx::Sphere sphere_a{ };
+    gfx::Sphere sphere_b{ gfx::createScalingMatrix(0.5) };
+    const gfx::World world{ sphere_a, sphere_b };
+
+    const gfx::Matrix4 view_transform_matrix{
+            gfx::createViewTransformMatrix(
+                    gfx::createPoint(0, 0, -5),
+                    gfx::createPoint(0, 0, 0),
+                    gfx::createVector(0, 1, 0)) };
+    const rt::Camera camera{ 21, 11, M_PI_2, view_transform_matrix };
+    const rt::RenderSettings settings{ .thread_count = 2, .tile_size = 4 };
+
+    // Test recording the render time of each pixel, which should not change the rendered image
+    rt::SchedulerStatistics statistics{ };
+    std::vector<double> pixel_costs{ };
+    const rt::Canvas image_expected{ rt::render(world, camera) };
+    const rt::Canvas image_actual{ rt::render(world, camera, settings, statistics, rt::HeatmapMetric::RenderTime,
+                                              pixel_costs) };
+
+    ASSERT_EQ(pixel_costs.size(), 21 * 11);
+    EXPECT_TRUE(std::ranges::all_of(pixel_costs, [](const double cost) { return cost >= 0.0; }));
+    EXPECT_EQ((image_actual[10, 5]), (image_expected[10, 5]));
+
+    // Test recording the intersection tests of each pixel, which requires render statistics to be enabled
+    if constexpr (gfx::RenderStatisticsCollector::IS_AVAILABLE) {
+        gfx::RenderStatisticsCollector::setEnabled(true);
+        const rt::Canvas image{ rt::render(world, camera, settings, statistics, rt::HeatmapMetric::IntersectionTests,
+                                           pixel_costs) };
+        gfx::RenderStatisticsCollector::setEnabled(false);
+        gfx::RenderStatisticsCollector::reset();
+
+        // Rays through the center of the viewport pass through both spheres, while rays through the corners are
+        // culled by the bounds of the world before testing either sphere
+        ASSERT_EQ(pixel_costs.size(), 21 * 11);
+        EXPECT_GE(pixel_costs[5 * 21 + 10], 2.0);
+        EXPECT_EQ(pixel_costs[0], 0.0);
+    } else {
+        EXPECT_THROW({
+            const rt::Canvas image{ rt::render(world, camera, settings, statistics,
+                                               rt::HeatmapMetric::IntersectionTests, pixel_costs) };
+        }, std::invalid_argument);
+    }
+
+    // Test that settings which would trace pixels together rather than one at a time are rejected
+    const rt::RenderSettings wavefront_settings{ .tracing_mode = rt::TracingMode::Wavefront };
+    EXPECT_THROW({
+        const rt::Canvas image{ rt::render(world, camera, wavefront_settings, statistics,
+                                           rt::HeatmapMetric::RenderTime, pixel_costs) };
+    }, std::invalid_argument);
+    const rt::RenderSettings packet_settings{ .packet_size = 4 };
+    EXPECT_THROW({
+        const rt::Canvas image{ rt::render(world, camera, packet_settings, statistics,
+                                           rt::HeatmapMetric::RenderTime, pixel_costs) };
+    }, std::invalid_argument);
+}
+
+// Tests creating a heatmap from a list of pixel costs
+TEST(RayTracerRendering, CreateHeatmap)
+{
+    const std::vector<double> pixel_costs{ 0, 1, 2, 4 };
+    const rt::Canvas heatmap{ rt::createHeatmap(pixel_costs, 2, 2) };
+
+    EXPECT_EQ(heatmap.width(), 2);
+    EXPECT_EQ(heatmap.height(), 2);
+    EXPECT_EQ((heatmap[0, 0]), gfx::Color(0, 0, 0));
+    EXPECT_EQ((heatmap[1, 0]), gfx::Color(0, 0, 1));
+    EXPECT_EQ((heatmap[0, 1]), gfx::Color(0, 1, 0));
+    EXPECT_EQ((heatmap[1, 1]), gfx::Color(1, 0, 0));
+
+    // Test a list of costs which does not match the heatmap dimensions
+    EXPECT_THROW({ const rt::Canvas invalid_heatmap{ rt::createHeatmap(pixel_costs, 3, 2) }; },
+                 std::invalid_argument);
+}
+
+// Tests mapping normalized pixel costs to heatmap colors
+TEST(RayTracerRendering, GetHeatmapColor)
+{
+    EXPECT_EQ(rt::getHeatmapColor(0.0), gfx::Color(0, 0, 0));
+    EXPECT_EQ(rt::getHeatmapColor(0.125), gfx::Color(0, 0, 0.5));
+    EXPECT_EQ(rt::getHeatmapColor(0.75), gfx::Color(1, 1, 0));
+    EXPECT_EQ(rt::getHeatmapColor(1.0), gfx::Color(1, 0, 0));
+
+    // Costs outside of the normalized range are clamped
+    EXPECT_EQ(rt::getHeatmapColor(-1.0), gfx::Color(0, 0, 0));
+    EXPECT_EQ(rt::getHeatmapColor(2.0), gfx::Color(1, 0, 0));
+}
+
+// Tests partitioning a viewport into tiles
+TEST(RayTracerRendering, PartitionIntoTiles)
+{
+    // Test a viewport that divides evenly into tiles
+    const std::vector<rt::Tile> tiles_a_expected{
+            rt::Tile{ 0, 0, 4, 4 }, rt::Tile{ 4, 0, 8, 4 },
+            rt::Tile{ 0, 4, 4, 8 }, rt::Tile{ 4, 4, 8, 8 }
+    };
+    EXPECT_EQ(rt::partitionIntoTiles(8, 8, 4), tiles_a_expected);
+
+    // Test a viewport with tiles clipped along the right and bottom edges
+    const std::vector<rt::Tile> tiles_b_expected{
+            rt::Tile{ 0, 0, 4, 4 }, rt::Tile{ 4, 0, 6, 4 },
+            rt::Tile{ 0, 4, 4, 5 }, rt::Tile{ 4, 4, 6, 5 }
+    };
+    EXPECT_EQ(rt::partitionIntoTiles(6, 5, 4), tiles_b_expected);
+
+    // Test an invalid tile size
+    EXPECT_THROW(auto tiles{ rt::partitionIntoTiles(8, 8, 0) }, std::invalid_argument);
 }
\ No newline at end of file
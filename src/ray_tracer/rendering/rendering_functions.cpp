@@ -1,16 +1,277 @@
 #include "rendering_functions.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+#include "tile_scheduler.hpp"
+#include "wavefront_renderer.hpp"
+#include "render_statistics.hpp"
+
 namespace rt {
+    namespace {
+        // Divides the viewport into tiles and runs the passed-in task on each, spreading the tiles across the number
+        // of workers requested by the render settings without starting more workers than there are tiles. Returns
+        // the scheduling statistics for the run.
+        SchedulerStatistics runTileTasks(const rt::Camera& camera,
+                                         const RenderSettings& settings,
+                                         const std::function<void(const Tile&)>& tile_task)
+        {
+            const std::vector<Tile> tiles{ partitionIntoTiles(camera.getViewportWidth(),
+                                                              camera.getViewportHeight(),
+                                                              settings.tile_size) };
+            const size_t worker_count{ std::clamp(resolveThreadCount(settings.thread_count),
+                                                  size_t{ 1 },
+                                                  std::max(tiles.size(), size_t{ 1 })) };
+            TileScheduler scheduler{ tiles, worker_count };
+            return scheduler.run(tile_task);
+        }
+    }
+
     rt::Canvas render(const gfx::World& world, const rt::Camera& camera)
+    {
+        return render(gfx::CompiledScene{ world }, camera);
+    }
+
+    rt::Canvas render(const gfx::CompiledScene& scene, const rt::Camera& camera)
     {
         rt::Canvas image{ camera.getViewportWidth(), camera.getViewportHeight() };
 
         // Cast a ray to determine the color for each pixel in the viewport
         for (int y = 0; y < camera.getViewportHeight(); ++y)
             for (int x = 0; x < camera.getViewportWidth(); ++x) {
-                image[x, y] = world.calculatePixelColor(camera.castRay(x, y));
+                gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Primary);
+                image[x, y] = scene.calculatePixelColor(camera.castRay(x, y));
             }
 
         return image;
     }
+
+    rt::Canvas render(const gfx::World& world, const rt::Camera& camera, const RenderSettings& settings)
+    {
+        return render(gfx::CompiledScene{ world }, camera, settings);
+    }
+
+    rt::Canvas render(const gfx::CompiledScene& scene, const rt::Camera& camera, const RenderSettings& settings)
+    {
+        SchedulerStatistics statistics{ };
+        return render(scene, camera, settings, statistics);
+    }
+
+    rt::Canvas render(const gfx::World& world,
+                      const rt::Camera& camera,
+                      const RenderSettings& settings,
+                      SchedulerStatistics& statistics)
+    {
+        return render(gfx::CompiledScene{ world }, camera, settings, statistics);
+    }
+
+    rt::Canvas render(const gfx::CompiledScene& scene,
+                      const rt::Camera& camera,
+                      const RenderSettings& settings,
+                      SchedulerStatistics& statistics)
+    {
+        if (settings.packet_size == 0 || settings.packet_size > MAX_PACKET_SIZE) {
+            throw std::invalid_argument{ "Packet size must be between 1 and 4." };
+        }
+        if (settings.tracing_mode == TracingMode::Wavefront && settings.packet_size > 1) {
+            throw std::invalid_argument{ "Wavefront tracing cannot be combined with pixel block packets." };
+        }
+
+        rt::Canvas image{ camera.getViewportWidth(), camera.getViewportHeight() };
+
+        // Since the scene and camera are not modified during rendering and each tile covers a distinct set of
+        // pixels, the workers can write their results directly to the canvas without further locking
+        statistics = runTileTasks(camera, settings, [&](const Tile& tile) {
+            if (settings.tracing_mode == TracingMode::Wavefront) {
+                // The wavefront queues are kept on each worker thread, so their storage is reused across tiles
+                thread_local WavefrontRenderer wavefront_renderer{ };
+                wavefront_renderer.renderTile(scene, camera, tile, image);
+            } else if (settings.packet_size > 1) {
+                renderTile(scene, camera, tile, image, settings.packet_size);
+            } else {
+                renderTile(scene, camera, tile, image);
+            }
+        });
+
+        return image;
+    }
+
+    rt::Canvas render(const gfx::World& world,
+                      const rt::Camera& camera,
+                      const RenderSettings& settings,
+                      SchedulerStatistics& statistics,
+                      const HeatmapMetric heatmap_metric,
+                      std::vector<double>& pixel_costs)
+    {
+        return render(gfx::CompiledScene{ world }, camera, settings, statistics, heatmap_metric, pixel_costs);
+    }
+
+    rt::Canvas render(const gfx::CompiledScene& scene,
+                      const rt::Camera& camera,
+                      const RenderSettings& settings,
+                      SchedulerStatistics& statistics,
+                      const HeatmapMetric heatmap_metric,
+                      std::vector<double>& pixel_costs)
+    {
+        if (heatmap_metric == HeatmapMetric::IntersectionTests && !gfx::RenderStatisticsCollector::isEnabled()) {
+            throw std::invalid_argument{ "Intersection test heatmaps require render statistics to be enabled." };
+        }
+        if (settings.tracing_mode != TracingMode::Recursive || settings.packet_size > 1) {
+            throw std::invalid_argument{ "Heatmaps cannot be combined with wavefront tracing or packets." };
+        }
+
+        rt::Canvas image{ camera.getViewportWidth(), camera.getViewportHeight() };
+        pixel_costs.assign(image.width() * image.height(), 0.0);
+
+        // As with the canvas, each worker writes only to the costs of the pixels within its own tiles
+        statistics = runTileTasks(camera, settings, [&](const Tile& tile) {
+            renderTile(scene, camera, tile, image, heatmap_metric, pixel_costs);
+        });
+
+        return image;
+    }
+
+    void renderTile(const gfx::CompiledScene& scene,
+                    const rt::Camera& camera,
+                    const Tile& tile,
+                    const rt::Canvas& image)
+    {
+        for (size_t y = tile.y_min; y < tile.y_max; ++y)
+            for (size_t x = tile.x_min; x < tile.x_max; ++x) {
+                gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Primary);
+                image[x, y] = scene.calculatePixelColor(camera.castRay(x, y));
+            }
+    }
+
+    void renderTile(const gfx::CompiledScene& scene,
+                    const rt::Camera& camera,
+                    const Tile& tile,
+                    const rt::Canvas& image,
+                    const size_t packet_size)
+    {
+        if (packet_size == 0 || packet_size > MAX_PACKET_SIZE) {
+            throw std::invalid_argument{ "Packet size must be between 1 and 4." };
+        }
+
+        gfx::RayPacket packet{ };
+        std::array<gfx::Color, gfx::MAX_RAY_PACKET_SIZE> block_colors{ };
+        for (size_t block_y = tile.y_min; block_y < tile.y_max; block_y += packet_size)
+            for (size_t block_x = tile.x_min; block_x < tile.x_max; block_x += packet_size) {
+                const size_t block_x_max{ std::min(block_x + packet_size, tile.x_max) };
+                const size_t block_y_max{ std::min(block_y + packet_size, tile.y_max) };
+
+                // Gather the rays of the block in row-major order, then write the colors back in the same order
+                packet.clear();
+                for (size_t y = block_y; y < block_y_max; ++y)
+                    for (size_t x = block_x; x < block_x_max; ++x) {
+                        gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Primary);
+                        packet.addRay(camera.castRay(x, y));
+                    }
+
+                scene.calculatePixelColors(packet, block_colors);
+                size_t ray_index{ 0 };
+                for (size_t y = block_y; y < block_y_max; ++y)
+                    for (size_t x = block_x; x < block_x_max; ++x) {
+                        image[x, y] = block_colors[ray_index++];
+                    }
+            }
+    }
+
+    void renderTile(const gfx::CompiledScene& scene,
+                    const rt::Camera& camera,
+                    const Tile& tile,
+                    const rt::Canvas& image,
+                    const HeatmapMetric heatmap_metric,
+                    const std::span<double> pixel_costs)
+    {
+        for (size_t y = tile.y_min; y < tile.y_max; ++y)
+            for (size_t x = tile.x_min; x < tile.x_max; ++x) {
+                const size_t pixel_index{ y * image.width() + x };
+                gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Primary);
+                if (heatmap_metric == HeatmapMetric::RenderTime) {
+                    const auto start_time{ std::chrono::steady_clock::now() };
+                    image[x, y] = scene.calculatePixelColor(camera.castRay(x, y));
+                    const std::chrono::duration<double, std::micro> elapsed_time{
+                            std::chrono::steady_clock::now() - start_time };
+                    pixel_costs[pixel_index] = elapsed_time.count();
+                } else {
+                    const uint64_t start_count{ gfx::RenderStatisticsCollector::getThreadIntersectionTestCount() };
+                    image[x, y] = scene.calculatePixelColor(camera.castRay(x, y));
+                    pixel_costs[pixel_index] = static_cast<double>(
+                            gfx::RenderStatisticsCollector::getThreadIntersectionTestCount() - start_count);
+                }
+            }
+    }
+
+    rt::Canvas createHeatmap(const std::span<const double> pixel_costs, const size_t width, const size_t height)
+    {
+        if (pixel_costs.size() != width * height) {
+            throw std::invalid_argument{ "Pixel cost count must match the heatmap dimensions." };
+        }
+
+        // Scale the costs relative to the most expensive pixel, leaving the heatmap black if every cost is zero
+        const double max_cost{ pixel_costs.empty() ? 0.0 : *std::ranges::max_element(pixel_costs) };
+        rt::Canvas heatmap{ width, height };
+        if (max_cost <= 0.0) {
+            return heatmap;
+        }
+
+        for (size_t y = 0; y < height; ++y)
+            for (size_t x = 0; x < width; ++x) {
+                heatmap[x, y] = getHeatmapColor(pixel_costs[y * width + x] / max_cost);
+            }
+
+        return heatmap;
+    }
+
+    gfx::Color getHeatmapColor(const double normalized_cost)
+    {
+        // Interpolate linearly between evenly spaced color stops
+        static const std::array<gfx::Color, 5> color_stops{ gfx::Color{ 0, 0, 0 },
+                                                            gfx::Color{ 0, 0, 1 },
+                                                            gfx::Color{ 0, 1, 0 },
+                                                            gfx::Color{ 1, 1, 0 },
+                                                            gfx::Color{ 1, 0, 0 } };
+        constexpr size_t segment_count{ color_stops.size() - 1 };
+
+        const double scaled_cost{ std::clamp(normalized_cost, 0.0, 1.0) * static_cast<double>(segment_count) };
+        const size_t segment{ std::min(static_cast<size_t>(scaled_cost), segment_count - 1) };
+        const double t{ scaled_cost - static_cast<double>(segment) };
+
+        return color_stops[segment] + (color_stops[segment + 1] - color_stops[segment]) * t;
+    }
+
+    std::vector<Tile> partitionIntoTiles(const size_t viewport_width,
+                                         const size_t viewport_height,
+                                         const size_t tile_size)
+    {
+        if (tile_size == 0) {
+            throw std::invalid_argument{ "Tile size must be greater than zero." };
+        }
+
+        std::vector<Tile> tiles{ };
+        for (size_t y = 0; y < viewport_height; y += tile_size)
+            for (size_t x = 0; x < viewport_width; x += tile_size) {
+                tiles.push_back(Tile{ x,
+                                      y,
+                                      std::min(x + tile_size, viewport_width),
+                                      std::min(y + tile_size, viewport_height) });
+            }
+
+        return tiles;
+    }
+
+    size_t resolveThreadCount(const size_t requested_thread_count)
+    {
+        if (requested_thread_count > 0) {
+            return requested_thread_count;
+        }
+
+        // The hardware thread count may be reported as 0 if it cannot be determined
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
 }
\ No newline at end of file
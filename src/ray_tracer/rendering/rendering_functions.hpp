@@ -1,10 +1,138 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "canvas.hpp"
 #include "world.hpp"
+#include "compiled_scene.hpp"
 #include "camera.hpp"
 
 namespace rt {
-    // Returns a canvas containing the rendered image of a world from the viewpoint of the passed-in camera
+    /* Forward Declarations */
+    struct SchedulerStatistics;
+
+    // Default edge length, in pixels, of the square tiles the viewport is divided into for parallel rendering
+    constexpr size_t DEFAULT_TILE_SIZE{ 16 };
+
+    // Largest edge length, in pixels, of the square blocks whose primary rays are traced together as a packet,
+    // such that the rays of a block fit within a single ray packet
+    constexpr size_t MAX_PACKET_SIZE{ 4 };
+
+    // Orders in which the rays of a tile are traced
+    enum class TracingMode {
+        Recursive,  // Depth-first, following each pixel's reflected and refracted rays before moving to the next
+        Wavefront   // Breadth-first, tracing every ray of one bounce across the tile before any ray of the next
+    };
+
+    // Describes how a render should be divided up and distributed across threads
+    struct RenderSettings {
+        size_t thread_count{ 1 };   // A thread count of 0 uses one thread per hardware core
+        size_t tile_size{ DEFAULT_TILE_SIZE };
+        size_t packet_size{ 1 };    // Edge length of the pixel blocks traced as packets, 1 traces single rays
+        TracingMode tracing_mode{ TracingMode::Recursive };   // Packets of pixel blocks require recursive tracing
+    };
+
+    // A rectangular region of the viewport, spanning [x_min, x_max) and [y_min, y_max)
+    struct Tile {
+        size_t x_min{ 0 };
+        size_t y_min{ 0 };
+        size_t x_max{ 0 };
+        size_t y_max{ 0 };
+
+        bool operator==(const Tile& rhs) const = default;
+    };
+
+    // Measures of the cost of shading a pixel, recorded for each pixel to build a heatmap of a render
+    enum class HeatmapMetric {
+        RenderTime,         // Wall-clock time spent shading the pixel, in microseconds
+        IntersectionTests   // Number of ray-surface intersection tests, counted by the render statistics collector
+    };
+
+    /* Rendering Functions */
+
+    // Returns a canvas containing the rendered image of a world from the viewpoint of the passed-in camera. Each of
+    // the world rendering functions compiles the world before tracing any rays, and renders the compiled scene.
     [[nodiscard]] rt::Canvas render(const gfx::World& world, const rt::Camera& camera);
+    [[nodiscard]] rt::Canvas render(const gfx::CompiledScene& scene, const rt::Camera& camera);
+
+    // Returns a canvas containing the rendered image of a world from the viewpoint of the passed-in camera,
+    // dividing the viewport into tiles which are shaded in parallel according to the render settings
+    [[nodiscard]] rt::Canvas render(const gfx::World& world,
+                                    const rt::Camera& camera,
+                                    const RenderSettings& settings);
+    [[nodiscard]] rt::Canvas render(const gfx::CompiledScene& scene,
+                                    const rt::Camera& camera,
+                                    const RenderSettings& settings);
+
+    // Renders the world in parallel tiles according to the render settings, storing the per-worker tile
+    // scheduling statistics for the render in the passed-in statistics object
+    [[nodiscard]] rt::Canvas render(const gfx::World& world,
+                                    const rt::Camera& camera,
+                                    const RenderSettings& settings,
+                                    SchedulerStatistics& statistics);
+    [[nodiscard]] rt::Canvas render(const gfx::CompiledScene& scene,
+                                    const rt::Camera& camera,
+                                    const RenderSettings& settings,
+                                    SchedulerStatistics& statistics);
+
+    // Renders the world in parallel tiles according to the render settings, additionally storing the cost of
+    // shading each pixel under the passed-in metric in a row-major list of costs. Counting intersection tests
+    // requires the render statistics collector to be compiled in and enabled. Pixels are traced recursively with
+    // single rays, so that the cost of each pixel can be measured on its own, and settings requesting wavefront
+    // tracing or packets are rejected.
+    [[nodiscard]] rt::Canvas render(const gfx::World& world,
+                                    const rt::Camera& camera,
+                                    const RenderSettings& settings,
+                                    SchedulerStatistics& statistics,
+                                    HeatmapMetric heatmap_metric,
+                                    std::vector<double>& pixel_costs);
+    [[nodiscard]] rt::Canvas render(const gfx::CompiledScene& scene,
+                                    const rt::Camera& camera,
+                                    const RenderSettings& settings,
+                                    SchedulerStatistics& statistics,
+                                    HeatmapMetric heatmap_metric,
+                                    std::vector<double>& pixel_costs);
+
+    // Renders each pixel within a tile of the viewport, writing the results to the passed-in canvas
+    void renderTile(const gfx::CompiledScene& scene,
+                    const rt::Camera& camera,
+                    const Tile& tile,
+                    const rt::Canvas& image);
+
+    // Renders a tile of the viewport in square blocks of pixels, tracing the primary rays of each block together as
+    // a packet and writing the results to the passed-in canvas. Blocks are clipped along the right and bottom edges
+    // of the tile, and the image matches the one rendered with single rays.
+    void renderTile(const gfx::CompiledScene& scene,
+                    const rt::Camera& camera,
+                    const Tile& tile,
+                    const rt::Canvas& image,
+                    size_t packet_size);
+
+    // Renders each pixel within a tile of the viewport, writing the results to the passed-in canvas and the cost of
+    // shading each pixel to the matching entry of the row-major list of costs
+    void renderTile(const gfx::CompiledScene& scene,
+                    const rt::Camera& camera,
+                    const Tile& tile,
+                    const rt::Canvas& image,
+                    HeatmapMetric heatmap_metric,
+                    std::span<double> pixel_costs);
+
+    /* Heatmap Functions */
+
+    // Returns a canvas coloring each pixel by its cost relative to the most expensive pixel, from black for no cost
+    // through blue, green, and yellow to red for the highest cost
+    [[nodiscard]] rt::Canvas createHeatmap(std::span<const double> pixel_costs, size_t width, size_t height);
+
+    // Returns the heatmap color for a cost normalized to the range [0, 1]
+    [[nodiscard]] gfx::Color getHeatmapColor(double normalized_cost);
+
+    /* Tiling Functions */
+
+    // Returns a list of tiles covering a viewport of the passed-in dimensions in row-major order, clipping the
+    // tiles along the right and bottom edges of the viewport
+    [[nodiscard]] std::vector<Tile> partitionIntoTiles(size_t viewport_width, size_t viewport_height, size_t tile_size);
+
+    // Returns the number of threads to render with, resolving a requested count of 0 to the hardware thread count
+    [[nodiscard]] size_t resolveThreadCount(size_t requested_thread_count);
 }
\ No newline at end of file
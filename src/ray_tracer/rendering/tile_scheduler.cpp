@@ -0,0 +1,149 @@
+#include "tile_scheduler.hpp"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <thread>
+
+namespace rt {
+    size_t SchedulerStatistics::getTotalTilesRendered() const
+    {
+        size_t total{ 0 };
+        for (const auto& worker : workers) {
+            total += worker.tiles_rendered;
+        }
+        return total;
+    }
+
+    size_t SchedulerStatistics::getTotalTilesStolen() const
+    {
+        size_t total{ 0 };
+        for (const auto& worker : workers) {
+            total += worker.tiles_stolen;
+        }
+        return total;
+    }
+
+    TileScheduler::TileScheduler(const std::vector<Tile>& tiles, const size_t worker_count)
+    {
+        if (worker_count == 0) {
+            throw std::invalid_argument{ "Tile scheduler requires at least one worker." };
+        }
+
+        // Seed each worker with a contiguous run of tiles, so that the initial distribution matches a static
+        // split of the image and stealing only occurs when the cost of the runs is uneven
+        for (size_t worker_index = 0; worker_index < worker_count; ++worker_index) {
+            auto worker_queue{ std::make_unique<WorkerQueue>() };
+            const size_t first_tile{ worker_index * tiles.size() / worker_count };
+            const size_t last_tile{ (worker_index + 1) * tiles.size() / worker_count };
+            worker_queue->tiles.assign(tiles.begin() + first_tile, tiles.begin() + last_tile);
+            m_worker_queues.push_back(std::move(worker_queue));
+        }
+    }
+
+    size_t TileScheduler::getQueuedTileCount(const size_t worker_index) const
+    {
+        const WorkerQueue& worker_queue{ *m_worker_queues.at(worker_index) };
+        const std::lock_guard lock{ worker_queue.mutex };
+        return worker_queue.tiles.size();
+    }
+
+    SchedulerStatistics TileScheduler::run(const std::function<void(const Tile&)>& tile_task)
+    {
+        SchedulerStatistics statistics{ std::vector<WorkerStatistics>(this->getWorkerCount()) };
+        const auto start_time{ std::chrono::steady_clock::now() };
+
+        // Spawn the worker threads, with the calling thread acting as the first worker
+        std::vector<std::jthread> worker_threads{ };
+        for (size_t worker_index = 1; worker_index < this->getWorkerCount(); ++worker_index) {
+            worker_threads.emplace_back([this, worker_index, &tile_task, &statistics]() {
+                this->runWorker(worker_index, tile_task, statistics.workers[worker_index]);
+            });
+        }
+        this->runWorker(0, tile_task, statistics.workers[0]);
+
+        // Wait for the remaining workers to finish their last tiles
+        for (auto& worker_thread : worker_threads) {
+            worker_thread.join();
+        }
+
+        statistics.wall_time = std::chrono::steady_clock::now() - start_time;
+        return statistics;
+    }
+
+    void TileScheduler::runWorker(const size_t worker_index,
+                                  const std::function<void(const Tile&)>& tile_task,
+                                  WorkerStatistics& statistics)
+    {
+        while (true) {
+            // Prefer the worker's own tiles, only stealing once its queue has been drained
+            std::optional<Tile> tile{ this->popLocalTile(worker_index) };
+            if (!tile) {
+                tile = this->stealTile(worker_index);
+                if (!tile) {
+                    // No new tiles are ever queued, so every queue being empty means the work is complete
+                    return;
+                }
+                ++statistics.tiles_stolen;
+            }
+
+            const auto task_start_time{ std::chrono::steady_clock::now() };
+            tile_task(tile.value());
+            statistics.busy_time += std::chrono::steady_clock::now() - task_start_time;
+            ++statistics.tiles_rendered;
+        }
+    }
+
+    std::optional<Tile> TileScheduler::popLocalTile(const size_t worker_index)
+    {
+        WorkerQueue& worker_queue{ *m_worker_queues[worker_index] };
+        const std::lock_guard lock{ worker_queue.mutex };
+        if (worker_queue.tiles.empty()) {
+            return std::nullopt;
+        }
+
+        const Tile tile{ worker_queue.tiles.front() };
+        worker_queue.tiles.pop_front();
+        return tile;
+    }
+
+    std::optional<Tile> TileScheduler::stealTile(const size_t thief_index)
+    {
+        // Visit the other workers starting from the thief's neighbor so that thieves spread out across victims
+        const size_t worker_count{ this->getWorkerCount() };
+        for (size_t offset = 1; offset < worker_count; ++offset) {
+            WorkerQueue& victim_queue{ *m_worker_queues[(thief_index + offset) % worker_count] };
+            const std::lock_guard lock{ victim_queue.mutex };
+            if (!victim_queue.tiles.empty()) {
+                // Take from the opposite end to the owner, which is the tile the owner would have reached last
+                const Tile tile{ victim_queue.tiles.back() };
+                victim_queue.tiles.pop_back();
+                return tile;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::string formatSchedulerStatistics(const SchedulerStatistics& statistics)
+    {
+        using milliseconds = std::chrono::duration<double, std::milli>;
+
+        std::string output{ std::format("{:>8} {:>8} {:>8} {:>12} {:>8}\n",
+                                        "Worker", "Tiles", "Stolen", "Busy (ms)", "Util") };
+        const double wall_time_ms{ milliseconds{ statistics.wall_time }.count() };
+        for (size_t worker_index = 0; worker_index < statistics.workers.size(); ++worker_index) {
+            const WorkerStatistics& worker{ statistics.workers[worker_index] };
+            const double busy_time_ms{ milliseconds{ worker.busy_time }.count() };
+            const double utilization{ wall_time_ms > 0 ? 100.0 * busy_time_ms / wall_time_ms : 0.0 };
+            output += std::format("{:>8} {:>8} {:>8} {:>12.2f} {:>7.1f}%\n",
+                                  worker_index, worker.tiles_rendered, worker.tiles_stolen,
+                                  busy_time_ms, utilization);
+        }
+        output += std::format("{:>8} {:>8} {:>8} {:>12.2f}\n",
+                              "Total", statistics.getTotalTilesRendered(), statistics.getTotalTilesStolen(),
+                              wall_time_ms);
+
+        return output;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "rendering_functions.hpp"
+
+namespace rt {
+    // Per-worker counters recorded while the scheduler runs
+    struct WorkerStatistics {
+        size_t tiles_rendered{ 0 };    // Total tiles rendered by the worker, including stolen tiles
+        size_t tiles_stolen{ 0 };      // Tiles taken from another worker's queue
+        std::chrono::nanoseconds busy_time{ 0 };
+    };
+
+    // Aggregated counters for a single run of the scheduler
+    struct SchedulerStatistics {
+        std::vector<WorkerStatistics> workers{ };
+        std::chrono::nanoseconds wall_time{ 0 };
+
+        [[nodiscard]] size_t getTotalTilesRendered() const;
+        [[nodiscard]] size_t getTotalTilesStolen() const;
+    };
+
+    // Distributes tiles across a pool of worker threads, each with its own double-ended queue of tiles. Workers
+    // take tiles from the front of their own queue and, once it is empty, steal from the back of the other workers'
+    // queues, so threads which draw inexpensive regions of the image help finish the expensive ones
+    class TileScheduler
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor
+        TileScheduler() = delete;
+
+        // Standard Constructor
+        TileScheduler(const std::vector<Tile>& tiles, size_t worker_count);
+
+        // Copy Constructor
+        TileScheduler(const TileScheduler&) = delete;
+
+        /* Destructor */
+
+        ~TileScheduler() = default;
+
+        /* Assignment Operators */
+
+        TileScheduler& operator=(const TileScheduler&) = delete;
+
+        /* Accessors */
+
+        [[nodiscard]] size_t getWorkerCount() const
+        { return m_worker_queues.size(); }
+
+        // Returns the number of tiles remaining in a given worker's queue
+        [[nodiscard]] size_t getQueuedTileCount(size_t worker_index) const;
+
+        /* Scheduling Operations */
+
+        // Runs the passed-in task on every queued tile across the worker threads, using the calling thread as the
+        // first worker, and returns the statistics for the run. Each tile is processed exactly once.
+        SchedulerStatistics run(const std::function<void(const Tile&)>& tile_task);
+
+    private:
+        /* Helper Types */
+
+        struct WorkerQueue {
+            mutable std::mutex mutex{ };
+            std::deque<Tile> tiles{ };
+        };
+
+        /* Data Members */
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_worker_queues{ };
+
+        /* Helper Methods */
+
+        // Processes tiles until every queue is empty, recording the worker's activity to its statistics
+        void runWorker(size_t worker_index,
+                       const std::function<void(const Tile&)>& tile_task,
+                       WorkerStatistics& statistics);
+
+        // Removes and returns the tile at the front of a worker's own queue
+        [[nodiscard]] std::optional<Tile> popLocalTile(size_t worker_index);
+
+        // Removes and returns a tile from the back of another worker's queue, searching the other workers in order
+        [[nodiscard]] std::optional<Tile> stealTile(size_t thief_index);
+    };
+
+    /* Statistics Output */
+
+    // Returns a human-readable table summarizing the per-worker scheduler statistics
+    [[nodiscard]] std::string formatSchedulerStatistics(const SchedulerStatistics& statistics);
+}
@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+#include "tile_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Tests the standard constructor
+TEST(RayTracerTileScheduler, StandardConstructor)
+{
+    const std::vector<rt::Tile> tiles{ rt::partitionIntoTiles(64, 64, 16) };
+    const rt::TileScheduler scheduler{ tiles, 3 };
+
+    // Tiles should be distributed across the workers in contiguous runs
+    ASSERT_EQ(scheduler.getWorkerCount(), 3);
+    EXPECT_EQ(scheduler.getQueuedTileCount(0), 5);
+    EXPECT_EQ(scheduler.getQueuedTileCount(1), 5);
+    EXPECT_EQ(scheduler.getQueuedTileCount(2), 6);
+
+    // Test constructing a scheduler without any workers
+    EXPECT_THROW((rt::TileScheduler{ tiles, 0 }), std::invalid_argument);
+}
+
+// Tests that running the scheduler processes every tile exactly once
+TEST(RayTracerTileScheduler, RunProcessesEachTileOnce)
+{
+    const std::vector<rt::Tile> tiles{ rt::partitionIntoTiles(100, 60, 8) };
+    rt::TileScheduler scheduler{ tiles, 4 };
+
+    std::mutex processed_tiles_mutex{ };
+    std::vector<rt::Tile> processed_tiles{ };
+    const rt::SchedulerStatistics statistics{ scheduler.run([&](const rt::Tile& tile) {
+        const std::lock_guard lock{ processed_tiles_mutex };
+        processed_tiles.push_back(tile);
+    }) };
+
+    ASSERT_EQ(processed_tiles.size(), tiles.size());
+    for (const auto& tile : tiles) {
+        EXPECT_EQ(std::count(processed_tiles.begin(), processed_tiles.end(), tile), 1);
+    }
+    EXPECT_EQ(statistics.workers.size(), 4);
+    EXPECT_EQ(statistics.getTotalTilesRendered(), tiles.size());
+    for (size_t worker_index = 0; worker_index < scheduler.getWorkerCount(); ++worker_index) {
+        EXPECT_EQ(scheduler.getQueuedTileCount(worker_index), 0);
+    }
+}
+
+// Tests that idle workers steal tiles from a worker stuck on an expensive tile
+TEST(RayTracerTileScheduler, IdleWorkersStealTiles)
+{
+    const std::vector<rt::Tile> tiles{ rt::partitionIntoTiles(32, 32, 4) };
+    rt::TileScheduler scheduler{ tiles, 2 };
+
+    // The first tile in worker 0's queue blocks until every other tile has been processed, which is only
+    // possible if worker 1 steals the remainder of worker 0's queue. The other tiles wait for the first tile to
+    // start so that worker 1 cannot steal it before worker 0 reaches it.
+    std::atomic<bool> is_first_tile_started{ false };
+    std::atomic<size_t> processed_tile_count{ 0 };
+    const rt::SchedulerStatistics statistics{ scheduler.run([&](const rt::Tile& tile) {
+        if (tile == tiles.front()) {
+            is_first_tile_started = true;
+            while (processed_tile_count.load() < tiles.size() - 1) {
+                std::this_thread::yield();
+            }
+        } else {
+            while (!is_first_tile_started.load()) {
+                std::this_thread::yield();
+            }
+        }
+        ++processed_tile_count;
+    }) };
+
+    EXPECT_EQ(processed_tile_count.load(), tiles.size());
+    EXPECT_EQ(statistics.workers[0].tiles_rendered, 1);
+    EXPECT_EQ(statistics.workers[1].tiles_rendered, tiles.size() - 1);
+    EXPECT_EQ(statistics.workers[1].tiles_stolen, tiles.size() / 2 - 1);
+    EXPECT_EQ(statistics.getTotalTilesStolen(), tiles.size() / 2 - 1);
+}
\ No newline at end of file
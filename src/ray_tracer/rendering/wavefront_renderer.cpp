@@ -0,0 +1,221 @@
+#include "wavefront_renderer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+#include "ray_packet.hpp"
+#include "material.hpp"
+#include "shading_functions.hpp"
+#include "util_functions.hpp"
+#include "render_statistics.hpp"
+
+namespace rt {
+    void WavefrontRenderer::renderTile(const gfx::CompiledScene& scene,
+                                       const rt::Camera& camera,
+                                       const Tile& tile,
+                                       const rt::Canvas& image)
+    {
+        const size_t tile_width{ tile.x_max - tile.x_min };
+        const size_t tile_height{ tile.y_max - tile.y_min };
+        m_pixel_colors.assign(tile_width * tile_height, gfx::Color{ 0, 0, 0 });
+
+        // The first generation holds the primary ray of every pixel in the tile
+        m_ray_queue.clear();
+        for (size_t y = tile.y_min; y < tile.y_max; ++y)
+            for (size_t x = tile.x_min; x < tile.x_max; ++x) {
+                gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Primary);
+                const gfx::Ray primary_ray{ camera.castRay(x, y) };
+                m_ray_queue.push_back(QueuedRay{ primary_ray,
+                                                 getRaySortKey(primary_ray),
+                                                 (y - tile.y_min) * tile_width + (x - tile.x_min) });
+            }
+
+        // Each generation is one bounce deeper than the last, so the loop ends once every path has left the scene
+        // or run out of bounces
+        for (size_t depth = 0; !m_ray_queue.empty(); ++depth) {
+            for (size_t i = 0; i < m_ray_queue.size(); ++i) {
+                gfx::RenderStatisticsCollector::recordShadingDepth(depth);
+            }
+
+            this->intersectRayQueue(scene);
+            this->traceShadowRays(scene);
+            this->shadeHits(scene);
+            std::swap(m_ray_queue, m_next_ray_queue);
+        }
+
+        for (size_t y = tile.y_min; y < tile.y_max; ++y)
+            for (size_t x = tile.x_min; x < tile.x_max; ++x) {
+                image[x, y] = m_pixel_colors[(y - tile.y_min) * tile_width + (x - tile.x_min)];
+            }
+    }
+
+    void WavefrontRenderer::intersectRayQueue(const gfx::CompiledScene& scene)
+    {
+        std::sort(m_ray_queue.begin(), m_ray_queue.end(), [](const QueuedRay& lhs, const QueuedRay& rhs) {
+            return lhs.sort_key < rhs.sort_key;
+        });
+
+        // Consecutive rays in the sorted queue travel in similar directions, so they are traced together as packets
+        m_closest_hits.resize(m_ray_queue.size());
+        gfx::RayPacket packet{ };
+        for (size_t first_ray = 0; first_ray < m_ray_queue.size(); first_ray += gfx::MAX_RAY_PACKET_SIZE) {
+            const size_t last_ray{ std::min(first_ray + gfx::MAX_RAY_PACKET_SIZE, m_ray_queue.size()) };
+            packet.clear();
+            for (size_t i = first_ray; i < last_ray; ++i) {
+                packet.addRay(m_ray_queue[i].ray);
+            }
+            scene.getClosestHits(packet,
+                                 std::span{ m_closest_hits.begin() + static_cast<ptrdiff_t>(first_ray),
+                                            last_ray - first_ray });
+        }
+
+        // Pre-compute the shading values of each hit, dropping the rays which miss every object
+        m_detailed_hits.clear();
+        m_hit_ray_indices.clear();
+        for (size_t i = 0; i < m_ray_queue.size(); ++i) {
+            if (m_closest_hits[i]) {
+                m_detailed_hits.emplace_back(m_closest_hits[i].value(), m_ray_queue[i].ray);
+                m_hit_ray_indices.push_back(i);
+            }
+        }
+    }
+
+    void WavefrontRenderer::traceShadowRays(const gfx::CompiledScene& scene)
+    {
+        const gfx::PointLight& light_source{ scene.getLightSource() };
+        m_shadow_ray_queue.clear();
+        for (size_t hit_index = 0; hit_index < m_detailed_hits.size(); ++hit_index) {
+            const gfx::Vector4& over_point{ m_detailed_hits[hit_index].getOverPoint() };
+            const gfx::Vector4 light_source_displacement{ light_source.position - over_point };
+            const gfx::Ray shadow_ray{ over_point, gfx::normalize(light_source_displacement) };
+            gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Shadow);
+            m_shadow_ray_queue.push_back(QueuedShadowRay{ shadow_ray,
+                                                          getRaySortKey(shadow_ray),
+                                                          hit_index,
+                                                          light_source_displacement.magnitude() });
+        }
+
+        std::sort(m_shadow_ray_queue.begin(), m_shadow_ray_queue.end(),
+                  [](const QueuedShadowRay& lhs, const QueuedShadowRay& rhs) {
+                      return lhs.sort_key < rhs.sort_key;
+                  });
+
+        // A hit is shadowed if any object lies between it and the light. Unlike the rays of a generation, shadow rays
+        // are traced one at a time: they start from scattered hits and soon diverge, and a single ray tests all the
+        // children of a wide node in one box test, where a packet needs a box test per child for every group of rays.
+        // Sorting still places rays which visit the same nodes next to each other, so those nodes stay in the cache.
+        m_shadowed_hits.assign(m_detailed_hits.size(), false);
+        for (const QueuedShadowRay& shadow_ray : m_shadow_ray_queue) {
+            m_shadowed_hits[shadow_ray.hit_index] = scene.hasIntersectionWithin(shadow_ray.ray,
+                                                                                0,
+                                                                                shadow_ray.light_distance);
+        }
+    }
+
+    void WavefrontRenderer::shadeHits(const gfx::CompiledScene& scene)
+    {
+        m_next_ray_queue.clear();
+        for (size_t hit_index = 0; hit_index < m_detailed_hits.size(); ++hit_index) {
+            const gfx::DetailedIntersection& detailed_hit{ m_detailed_hits[hit_index] };
+            const QueuedRay& queued_ray{ m_ray_queue[m_hit_ray_indices[hit_index]] };
+            const gfx::Material& hit_material{ scene.getMaterial(detailed_hit) };
+            const gfx::MaterialProperties& hit_properties{ hit_material.getProperties() };
+
+            // The surface color reaches the pixel scaled by the weight of every bounce along the path
+            const gfx::CompiledTexture& hit_texture{ scene.getCompiledTexture(detailed_hit) };
+            const gfx::Color object_color{ detailed_hit.getObject().getObjectColorAt(detailed_hit.getOverPoint(),
+                                                                                     hit_texture) };
+            const gfx::Color surface_color{ gfx::calculateSurfaceColor(object_color,
+                                                                       hit_properties,
+                                                                       scene.getLightSource(),
+                                                                       detailed_hit.getOverPoint(),
+                                                                       detailed_hit.getSurfaceNormal(),
+                                                                       detailed_hit.getViewVector(),
+                                                                       m_shadowed_hits[hit_index]) };
+            m_pixel_colors[queued_ray.pixel_index] += surface_color * queued_ray.weight;
+            if (queued_ray.remaining_bounces <= 0)
+                continue;
+
+            // As in the recursive renderer, only transparent objects need the full list of intersections, which is
+            // used to determine the refractive indices at the hit
+            const bool is_reflective{ utils::areNotEqual(hit_properties.reflectivity, 0.0) };
+            const bool is_transparent{ utils::areNotEqual(hit_properties.transparency, 0.0) };
+            std::pair<double, double> refractive_indices{ 1.0, 1.0 };
+            if (is_transparent) {
+                scene.getAllIntersections(queued_ray.ray, m_possible_overlaps);
+                refractive_indices = gfx::getRefractiveIndices(detailed_hit, m_possible_overlaps);
+            }
+            const auto [ n1, n2 ] { refractive_indices };
+
+            // Apply the Fresnel effect for reflective transparent materials by splitting the weight between the
+            // reflected and refracted rays
+            double reflected_weight{ queued_ray.weight * hit_properties.reflectivity };
+            double refracted_weight{ queued_ray.weight * hit_properties.transparency };
+            if (utils::isGreater(hit_properties.reflectivity, 0.0) &&
+                utils::isGreater(hit_properties.transparency, 0.0))
+            {
+                const double reflectance{ gfx::calculateReflectance(detailed_hit.getViewVector(),
+                                                                    detailed_hit.getSurfaceNormal(),
+                                                                    n1, n2) };
+                reflected_weight *= reflectance;
+                refracted_weight *= 1 - reflectance;
+            }
+
+            if (is_reflective) {
+                const gfx::Ray reflection_ray{ detailed_hit.getOverPoint(), detailed_hit.getReflectionVector() };
+                gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Reflection);
+                m_next_ray_queue.push_back(QueuedRay{ reflection_ray,
+                                                      getRaySortKey(reflection_ray),
+                                                      queued_ray.pixel_index,
+                                                      reflected_weight,
+                                                      queued_ray.remaining_bounces - 1 });
+            }
+
+            if (is_transparent) {
+                const auto refraction_ray{ gfx::calculateRefractionRay(detailed_hit, n1, n2) };
+                if (refraction_ray) {
+                    gfx::RenderStatisticsCollector::recordRay(gfx::RayType::Refraction);
+                    m_next_ray_queue.push_back(QueuedRay{ refraction_ray.value(),
+                                                          getRaySortKey(refraction_ray.value()),
+                                                          queued_ray.pixel_index,
+                                                          refracted_weight,
+                                                          queued_ray.remaining_bounces - 1 });
+                }
+            }
+        }
+    }
+
+    uint64_t getRaySortKey(const gfx::Ray& ray)
+    {
+        // Spreads the lowest 10 bits of a value out so that two zero bits follow each one
+        const auto spread_bits{ [](uint64_t value) {
+            value &= 0x3ff;
+            value = (value | (value << 16)) & 0x030000ff;
+            value = (value | (value << 8)) & 0x0300f00f;
+            value = (value | (value << 4)) & 0x030c30c3;
+            value = (value | (value << 2)) & 0x09249249;
+            return value;
+        } };
+
+        // Quantize the magnitude of each direction component relative to the largest, which avoids normalizing
+        const gfx::Vector4& direction{ ray.getDirection() };
+        const std::array<double, 3> components{ direction.x(), direction.y(), direction.z() };
+        const double largest_component{ std::max({ std::fabs(components[0]),
+                                                   std::fabs(components[1]),
+                                                   std::fabs(components[2]) }) };
+        constexpr double quantization_scale{ 1023.0 };
+        uint64_t octant{ 0 };
+        uint64_t morton_code{ 0 };
+        for (size_t axis = 0; axis < 3; ++axis) {
+            octant |= static_cast<uint64_t>(std::signbit(components[axis])) << axis;
+            const double normalized_component{ largest_component > 0.0 ?
+                                                       std::fabs(components[axis]) / largest_component : 0.0 };
+            const auto quantized_component{ static_cast<uint64_t>(normalized_component * quantization_scale) };
+            morton_code |= spread_bits(quantized_component) << (2 - axis);
+        }
+
+        return (octant << 30) | morton_code;
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "canvas.hpp"
+#include "camera.hpp"
+#include "color.hpp"
+#include "ray.hpp"
+#include "intersection.hpp"
+#include "compiled_scene.hpp"
+#include "rendering_functions.hpp"
+
+namespace rt {
+    // Number of bounces each primary ray may spawn, matching the default depth of CompiledScene::calculatePixelColor
+    constexpr int WAVEFRONT_MAX_BOUNCES{ 5 };
+
+    // A ray waiting in a wavefront queue, along with the pixel its color contributes to
+    struct QueuedRay {
+        gfx::Ray ray{ };
+        uint64_t sort_key{ 0 };
+        size_t pixel_index{ 0 };    // Row-major index of the pixel within the tile being rendered
+        double weight{ 1.0 };       // Product of the reflectivities, transparencies, and Fresnel terms along the path
+        int remaining_bounces{ WAVEFRONT_MAX_BOUNCES };
+    };
+
+    // A ray cast from a hit towards the light source, along with the distance the light lies along it
+    struct QueuedShadowRay {
+        gfx::Ray ray{ };
+        uint64_t sort_key{ 0 };
+        size_t hit_index{ 0 };      // Index of the hit in the generation being shaded
+        double light_distance{ 0.0 };
+    };
+
+    // Renders tiles breadth-first rather than following each pixel's reflections and refractions depth-first. All
+    // rays of one generation are queued, sorted so that rays travelling in similar directions are intersected
+    // together in packets, and then shaded as a batch. Shading emits a batch of shadow rays, which are sorted and
+    // traced before the surface colors are calculated, along with the reflected and refracted rays of the next
+    // generation. Each ray carries the weight its color contributes to its pixel, which replaces the scaling done as
+    // the recursion unwinds, so the image matches the recursive renderer up to rounding. The queues are reused across
+    // tiles, so each worker thread should keep its own renderer.
+    class WavefrontRenderer
+    {
+    public:
+        /* Constructors */
+
+        // Default Constructor
+        WavefrontRenderer() = default;
+
+        // Copy Constructor
+        WavefrontRenderer(const WavefrontRenderer&) = delete;
+
+        /* Destructor */
+
+        ~WavefrontRenderer() = default;
+
+        /* Assignment Operators */
+
+        WavefrontRenderer& operator=(const WavefrontRenderer&) = delete;
+
+        /* Rendering Operations */
+
+        // Renders each pixel within a tile of the viewport, writing the results to the passed-in canvas
+        void renderTile(const gfx::CompiledScene& scene,
+                        const rt::Camera& camera,
+                        const Tile& tile,
+                        const rt::Canvas& image);
+
+    private:
+        /* Data Members */
+
+        std::vector<QueuedRay> m_ray_queue{ };
+        std::vector<QueuedRay> m_next_ray_queue{ };
+        std::vector<std::optional<gfx::Intersection>> m_closest_hits{ };
+        std::vector<gfx::DetailedIntersection> m_detailed_hits{ };
+        std::vector<size_t> m_hit_ray_indices{ };     // Maps each detailed hit to the ray in the queue that found it
+        std::vector<QueuedShadowRay> m_shadow_ray_queue{ };
+        std::vector<char> m_shadowed_hits{ };
+        std::vector<gfx::Intersection> m_possible_overlaps{ };
+        std::vector<gfx::Color> m_pixel_colors{ };
+
+        /* Helper Methods */
+
+        // Sorts the ray queue and finds the closest hit of each ray, tracing consecutive rays together as packets
+        void intersectRayQueue(const gfx::CompiledScene& scene);
+
+        // Queues a ray towards the light source from each hit, then sorts and traces the queue to find which hits
+        // are in shadow
+        void traceShadowRays(const gfx::CompiledScene& scene);
+
+        // Adds the surface color of each hit to its pixel and queues the reflected and refracted rays it spawns
+        void shadeHits(const gfx::CompiledScene& scene);
+    };
+
+    // Returns a key which orders rays by the octant of their direction and then by a Morton code of their direction,
+    // so that sorting a queue by key places rays travelling in similar directions next to each other
+    [[nodiscard]] uint64_t getRaySortKey(const gfx::Ray& ray);
+}
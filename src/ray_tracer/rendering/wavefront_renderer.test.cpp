@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include "wavefront_renderer.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "color.hpp"
+#include "material.hpp"
+#include "sphere.hpp"
+#include "plane.hpp"
+#include "vector4.hpp"
+#include "transform.hpp"
+#include "render_statistics.hpp"
+
+// Tests that rendering a world breadth-first produces the same image as the recursive renderer, including the
+// reflected and refracted rays traced through a glass sphere and a reflective floor
+TEST(RayTracerWavefrontRenderer, RenderWorldWavefront)
+{
+    gfx::World world{ gfx::PointLight{ gfx::Color{ 1, 1, 1 }, gfx::createPoint(-10, 10, -10) } };
+    for (int x = -2; x <= 2; ++x) {
+        world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(x * 1.5, 0, 1) * gfx::createScalingMatrix(0.6) });
+    }
+    const gfx::Material glass_material{ gfx::MaterialProperties{ .reflectivity = 0.5,
+                                                                 .transparency = 0.9,
+                                                                 .refractive_index = 1.5 } };
+    world.addObject(gfx::Sphere{ gfx::createTranslationMatrix(0.75, 0.25, -2) * gfx::createScalingMatrix(0.5),
+                                 glass_material });
+    world.addObject(gfx::Plane{ gfx::createTranslationMatrix(0, -1, 0),
+                                gfx::Material{ gfx::MaterialProperties{ .reflectivity = 0.3 } } });
+    world.finalize();
+
+    const gfx::Matrix4 view_transform_matrix{
+            gfx::createViewTransformMatrix(
+                    gfx::createPoint(0, 1.5, -6),
+                    gfx::createPoint(0, 0, 0),
+                    gfx::createVector(0, 1, 0)) };
+    const rt::Camera camera{ 37, 23, M_PI_2, view_transform_matrix };
+
+    // The weights along each path are multiplied out rather than applied as the recursion unwinds, so the images
+    // match up to rounding
+    const rt::Canvas image_expected{ rt::render(world, camera) };
+    const rt::Canvas image_actual{ rt::render(world, camera, rt::RenderSettings{
+            .thread_count = 2,
+            .tile_size = 10,
+            .tracing_mode = rt::TracingMode::Wavefront }) };
+    for (size_t y = 0; y < camera.getViewportHeight(); ++y)
+        for (size_t x = 0; x < camera.getViewportWidth(); ++x) {
+            EXPECT_EQ((image_actual[x, y]), (image_expected[x, y]));
+        }
+
+    // Test rendering a single tile with a renderer whose queues have already been used
+    const gfx::CompiledScene scene{ world };
+    rt::WavefrontRenderer renderer{ };
+    const rt::Canvas tile_image{ camera.getViewportWidth(), camera.getViewportHeight() };
+    renderer.renderTile(scene, camera, rt::Tile{ 0, 0, 37, 23 }, tile_image);
+    renderer.renderTile(scene, camera, rt::Tile{ 5, 3, 17, 11 }, tile_image);
+    EXPECT_EQ((tile_image[16, 10]), (image_expected[16, 10]));
+    EXPECT_EQ((tile_image[0, 0]), (image_expected[0, 0]));
+
+    EXPECT_THROW(static_cast<void>(rt::render(world, camera, rt::RenderSettings{
+                         .packet_size = 2,
+                         .tracing_mode = rt::TracingMode::Wavefront })),
+                 std::invalid_argument);
+}
+
+// Tests that the wavefront renderer traces the same rays as the recursive renderer
+TEST(RayTracerWavefrontRenderer, RayCounts)
+{
+    if constexpr (!gfx::RenderStatisticsCollector::IS_AVAILABLE) {
+        GTEST_SKIP() << "Render statistics are not compiled in";
+    }
+
+    const gfx::Material reflective_material{ gfx::MaterialProperties{ .reflectivity = 0.5 } };
+    gfx::Sphere sphere_a{ gfx::createTranslationMatrix(-1, 0, 0), reflective_material };
+    gfx::Sphere sphere_b{ gfx::createTranslationMatrix(1, 0, 0), reflective_material };
+    const gfx::World world{ sphere_a, sphere_b };
+    const rt::Camera camera{ 16, 16, M_PI_2, gfx::createViewTransformMatrix(gfx::createPoint(0, 0, -5),
+                                                                            gfx::createPoint(0, 0, 0),
+                                                                            gfx::createVector(0, 1, 0)) };
+
+    gfx::RenderStatisticsCollector::reset();
+    gfx::RenderStatisticsCollector::setEnabled(true);
+    const rt::Canvas image_recursive{ rt::render(world, camera, rt::RenderSettings{ }) };
+    const gfx::RenderStatistics statistics_recursive{ gfx::RenderStatisticsCollector::collect() };
+    gfx::RenderStatisticsCollector::reset();
+    const rt::Canvas image_wavefront{ rt::render(world, camera, rt::RenderSettings{
+            .tracing_mode = rt::TracingMode::Wavefront }) };
+    const gfx::RenderStatistics statistics_wavefront{ gfx::RenderStatisticsCollector::collect() };
+    gfx::RenderStatisticsCollector::setEnabled(false);
+    gfx::RenderStatisticsCollector::reset();
+
+    EXPECT_EQ(statistics_wavefront.ray_counts, statistics_recursive.ray_counts);
+    EXPECT_EQ(statistics_wavefront.recursion_depth_counts, statistics_recursive.recursion_depth_counts);
+}
+
+// Tests ordering rays by direction with the sort key
+TEST(RayTracerWavefrontRenderer, GetRaySortKey)
+{
+    // Rays with the same direction share a key regardless of their origin or the length of their direction
+    const gfx::Ray ray_a{ 0, 0, 0, 0.5, 1, 0.25 };
+    const gfx::Ray ray_b{ 3, -2, 7, 1, 2, 0.5 };
+    EXPECT_EQ(rt::getRaySortKey(ray_a), rt::getRaySortKey(ray_b));
+
+    // Rays in different octants are ordered by octant before direction
+    const gfx::Ray ray_c{ 0, 0, 0, 1, 1, 1 };
+    const gfx::Ray ray_d{ 0, 0, 0, -0.01, 1, 1 };
+    const gfx::Ray ray_e{ 0, 0, 0, 1, 1, -0.01 };
+    EXPECT_LT(rt::getRaySortKey(ray_c), rt::getRaySortKey(ray_d));
+    EXPECT_LT(rt::getRaySortKey(ray_d), rt::getRaySortKey(ray_e));
+
+    // Within an octant, rays with similar directions have closer keys than rays with distant directions
+    const gfx::Ray ray_f{ 0, 0, 0, 1, 0.98, 0.99 };
+    const gfx::Ray ray_g{ 0, 0, 0, 0, 0, 1 };
+    const uint64_t key_c{ rt::getRaySortKey(ray_c) };
+    EXPECT_LT(key_c - rt::getRaySortKey(ray_f), key_c - rt::getRaySortKey(ray_g));
+}